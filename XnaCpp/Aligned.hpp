@@ -0,0 +1,45 @@
+#ifndef _ALIGNED_HPP_
+#define _ALIGNED_HPP_
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Xna {
+
+	// Allocator whose blocks start on a TAlignment-byte boundary (at least alignof(T)), so SIMD code can use aligned
+	// loads on every element of a 16-byte type such as Vector3A, Matrix, Quaternion or Plane.
+	template <typename T, size_t TAlignment = 16>
+	struct AlignedAllocator {
+		using value_type = T;
+		static constexpr size_t Alignment = TAlignment < alignof(T) ? alignof(T) : TAlignment;
+
+		template <typename U>
+		struct rebind {
+			using other = AlignedAllocator<U, TAlignment>;
+		};
+
+		constexpr AlignedAllocator() noexcept = default;
+
+		template <typename U>
+		constexpr AlignedAllocator(AlignedAllocator<U, TAlignment> const&) noexcept {}
+
+		T* allocate(size_t count) {
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+		}
+
+		void deallocate(T* pointer, size_t) noexcept {
+			::operator delete(pointer, std::align_val_t(Alignment));
+		}
+
+		template <typename U>
+		constexpr bool operator ==(AlignedAllocator<U, TAlignment> const&) const noexcept {
+			return true;
+		}
+	};
+
+	template <typename T, size_t TAlignment = 16>
+	using AlignedVector = std::vector<T, AlignedAllocator<T, TAlignment>>;
+}
+
+#endif
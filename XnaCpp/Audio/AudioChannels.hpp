@@ -0,0 +1,15 @@
+#ifndef _AUDIOCHANNELS_HPP_
+#define _AUDIOCHANNELS_HPP_
+
+namespace Xna {
+	enum class AudioChannels {
+
+		// Single channel.
+		Mono = 1,
+
+		// Two channels, left then right.
+		Stereo = 2
+	};
+}
+
+#endif
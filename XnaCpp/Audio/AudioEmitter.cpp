@@ -0,0 +1,18 @@
+#include "AudioEmitter.hpp"
+
+//Constructors
+namespace Xna {
+	AudioEmitter::AudioEmitter() :
+		Forward(Vector3::Forward), Position(Vector3::Zero), Up(Vector3::Up), Velocity(Vector3::Zero) {}
+}
+
+//Functions
+namespace Xna {
+	float AudioEmitter::DopplerScale() const {
+		return _dopplerScale;
+	}
+
+	void AudioEmitter::DopplerScale(float value) {
+		_dopplerScale = value < 0 ? 0 : value;
+	}
+}
@@ -0,0 +1,26 @@
+#ifndef _AUDIOEMITTER_HPP_
+#define _AUDIOEMITTER_HPP_
+
+#include "../Vector3.hpp"
+
+namespace Xna {
+
+	// Position and motion of a 3D sound source.
+	struct AudioEmitter {
+		Vector3 Forward;
+		Vector3 Position;
+		Vector3 Up;
+		Vector3 Velocity;
+
+		AudioEmitter();
+
+		// Scales the Doppler shift of this emitter. Negative values are stored as 0.
+		float DopplerScale() const;
+		void DopplerScale(float value);
+
+	private:
+		float _dopplerScale{ 1.0f };
+	};
+}
+
+#endif
@@ -0,0 +1,7 @@
+#include "AudioListener.hpp"
+
+//Constructors
+namespace Xna {
+	AudioListener::AudioListener() :
+		Forward(Vector3::Forward), Position(Vector3::Zero), Up(Vector3::Up), Velocity(Vector3::Zero) {}
+}
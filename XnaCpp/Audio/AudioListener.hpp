@@ -0,0 +1,19 @@
+#ifndef _AUDIOLISTENER_HPP_
+#define _AUDIOLISTENER_HPP_
+
+#include "../Vector3.hpp"
+
+namespace Xna {
+
+	// Position and orientation of the ear that 3D sounds are panned and attenuated for.
+	struct AudioListener {
+		Vector3 Forward;
+		Vector3 Position;
+		Vector3 Up;
+		Vector3 Velocity;
+
+		AudioListener();
+	};
+}
+
+#endif
@@ -0,0 +1,776 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "AudioMixer.hpp"
+#include "../MathHelper.hpp"
+#include "../Simd.hpp"
+#include "../Profiler.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		constexpr double fixedOne = 4294967296.0;
+		constexpr float fractionScale = 1.0f / 4294967296.0f;
+
+		// Equal power pan law, scaled so a centered sound plays at unit gain on both sides.
+		void panGains(float pan, float& left, float& right) {
+			auto angle = (MathHelper::Clamp(pan, -1.0f, 1.0f) + 1.0f) * MathHelper::PiOVER4;
+			left = MathHelper::Min(1.0f, std::cos(angle) * 1.41421356f);
+			right = MathHelper::Min(1.0f, std::sin(angle) * 1.41421356f);
+		}
+
+		// Frames from position, in 32.32 fixed point, whose next sample is still inside a source of length frames.
+		size_t safeFrames(uint64_t position, uint64_t step, size_t length) {
+			auto limit = static_cast<uint64_t>(length - 1) << 32;
+
+			if (position >= limit)
+				return 0;
+
+			return static_cast<size_t>((limit - position + step - 1) / step);
+		}
+
+		// Adds frameCount linearly interpolated frames of source0 to left and source1 to right, with gains ramping
+		// by delta per frame. Both samples of every frame must be in range.
+		void resample(float const* source0, float const* source1, uint64_t position, uint64_t step, size_t frameCount,
+			float* left, float* right, float gainLeft, float deltaLeft, float gainRight, float deltaRight) {
+			size_t i = 0;
+#if XNA_AVX2
+			auto stereo = source0 != source1;
+			auto lanes = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+
+			for (; i + 8 <= frameCount; i += 8) {
+				alignas(32) int32_t indices[8];
+				alignas(32) float fractions[8];
+
+				for (size_t lane = 0; lane < 8; ++lane) {
+					auto p = position + (i + lane) * step;
+					indices[lane] = static_cast<int32_t>(p >> 32);
+					fractions[lane] = static_cast<uint32_t>(p) * fractionScale;
+				}
+
+				auto index = _mm256_load_si256(reinterpret_cast<__m256i const*>(indices));
+				auto fraction = _mm256_load_ps(fractions);
+				auto offset = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), lanes);
+				auto gainL = _mm256_add_ps(_mm256_set1_ps(gainLeft), _mm256_mul_ps(_mm256_set1_ps(deltaLeft), offset));
+				auto gainR = _mm256_add_ps(_mm256_set1_ps(gainRight), _mm256_mul_ps(_mm256_set1_ps(deltaRight), offset));
+
+				auto a = _mm256_i32gather_ps(source0, index, 4);
+				auto b = _mm256_i32gather_ps(source0 + 1, index, 4);
+				auto value0 = _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), fraction));
+				auto value1 = value0;
+
+				if (stereo) {
+					a = _mm256_i32gather_ps(source1, index, 4);
+					b = _mm256_i32gather_ps(source1 + 1, index, 4);
+					value1 = _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), fraction));
+				}
+
+				_mm256_storeu_ps(left + i, _mm256_add_ps(_mm256_loadu_ps(left + i), _mm256_mul_ps(value0, gainL)));
+				_mm256_storeu_ps(right + i, _mm256_add_ps(_mm256_loadu_ps(right + i), _mm256_mul_ps(value1, gainR)));
+			}
+#elif XNA_SSE2
+			auto stereo = source0 != source1;
+			auto lanes = _mm_setr_ps(0, 1, 2, 3);
+
+			for (; i + 4 <= frameCount; i += 4) {
+				float a0[4];
+				float b0[4];
+				float a1[4];
+				float b1[4];
+				float fractions[4];
+
+				for (size_t lane = 0; lane < 4; ++lane) {
+					auto p = position + (i + lane) * step;
+					auto index = static_cast<size_t>(p >> 32);
+					fractions[lane] = static_cast<uint32_t>(p) * fractionScale;
+					a0[lane] = source0[index];
+					b0[lane] = source0[index + 1];
+
+					if (stereo) {
+						a1[lane] = source1[index];
+						b1[lane] = source1[index + 1];
+					}
+				}
+
+				auto fraction = _mm_loadu_ps(fractions);
+				auto offset = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), lanes);
+				auto gainL = _mm_add_ps(_mm_set1_ps(gainLeft), _mm_mul_ps(_mm_set1_ps(deltaLeft), offset));
+				auto gainR = _mm_add_ps(_mm_set1_ps(gainRight), _mm_mul_ps(_mm_set1_ps(deltaRight), offset));
+
+				auto a = _mm_loadu_ps(a0);
+				auto value0 = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b0), a), fraction));
+				auto value1 = value0;
+
+				if (stereo) {
+					a = _mm_loadu_ps(a1);
+					value1 = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b1), a), fraction));
+				}
+
+				_mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), _mm_mul_ps(value0, gainL)));
+				_mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), _mm_mul_ps(value1, gainR)));
+			}
+#endif
+			for (; i < frameCount; ++i) {
+				auto p = position + i * step;
+				auto index = static_cast<size_t>(p >> 32);
+				auto fraction = static_cast<uint32_t>(p) * fractionScale;
+				auto value0 = source0[index] + (source0[index + 1] - source0[index]) * fraction;
+				auto value1 = source1[index] + (source1[index + 1] - source1[index]) * fraction;
+
+				left[i] += value0 * (gainLeft + deltaLeft * i);
+				right[i] += value1 * (gainRight + deltaRight * i);
+			}
+		}
+
+		void interleave(float const* left, float const* right, float* destination, size_t frameCount) {
+			size_t i = 0;
+#if XNA_SSE2
+			for (; i + 4 <= frameCount; i += 4) {
+				auto l = _mm_loadu_ps(left + i);
+				auto r = _mm_loadu_ps(right + i);
+				_mm_storeu_ps(destination + i * 2, _mm_unpacklo_ps(l, r));
+				_mm_storeu_ps(destination + i * 2 + 4, _mm_unpackhi_ps(l, r));
+			}
+#endif
+			for (; i < frameCount; ++i) {
+				destination[i * 2] = left[i];
+				destination[i * 2 + 1] = right[i];
+			}
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	AudioMixer::AudioMixer(int32_t sampleRate, size_t voiceCount, size_t commandCapacity) :
+		_sampleRate(sampleRate > 0 ? sampleRate : 48000),
+		_voiceCount(std::clamp(voiceCount, size_t{ 1 }, size_t{ 0xFFFF })) {
+		_voices = std::make_unique<Voice[]>(_voiceCount);
+
+		// Free list entries are index + 1 so that 0 marks the end; the upper half of the head is an ABA tag.
+		for (size_t i = 0; i < _voiceCount; ++i)
+			_voices[i].Next.store(i + 1 < _voiceCount ? static_cast<uint32_t>(i + 2) : 0, std::memory_order_relaxed);
+
+		_freeHead.store(1, std::memory_order_relaxed);
+
+		size_t capacity = 2;
+		while (capacity < commandCapacity)
+			capacity <<= 1;
+
+		_commands = std::make_unique<CommandSlot[]>(capacity);
+		_commandMask = capacity - 1;
+
+		for (size_t i = 0; i < capacity; ++i)
+			_commands[i].Sequence.store(i, std::memory_order_relaxed);
+
+		_playing.reserve(_voiceCount);
+		_left.resize(BlockSize);
+		_right.resize(BlockSize);
+	}
+
+	AudioMixer::~AudioMixer() {
+		Stop();
+	}
+
+	AudioMixer::Voice::~Voice() {
+		delete[] Buffers.load(std::memory_order_relaxed);
+	}
+}
+
+//Functions
+namespace Xna {
+	int32_t AudioMixer::SampleRate() const {
+		return _sampleRate;
+	}
+
+	size_t AudioMixer::VoiceCount() const {
+		return _voiceCount;
+	}
+
+	size_t AudioMixer::ActiveVoiceCount() const {
+		return _activeCount.load(std::memory_order_relaxed);
+	}
+
+	uint32_t AudioMixer::Play(std::shared_ptr<SoundEffect const> const& sound, float volume, float pitch, float pan, bool isLooped) {
+		if (!sound || sound->FrameCount() == 0 || sound->SampleRate() <= 0)
+			return InvalidVoice;
+
+		auto index = allocate();
+
+		if (index == InvalidVoice)
+			return InvalidVoice;
+
+		auto& voice = _voices[index];
+		voice.Sound = sound;
+		voice.Streaming.store(false, std::memory_order_relaxed);
+
+		return start(index, volume, pitch, pan, isLooped);
+	}
+
+	uint32_t AudioMixer::PlayDynamic(int32_t sampleRate, AudioChannels channels, BufferNeededCallback bufferNeeded,
+		float volume, float pitch, float pan) {
+		if (sampleRate <= 0 || (channels != AudioChannels::Mono && channels != AudioChannels::Stereo))
+			return InvalidVoice;
+
+		auto index = allocate();
+
+		if (index == InvalidVoice)
+			return InvalidVoice;
+
+		auto& voice = _voices[index];
+
+		if (!voice.Buffers.load(std::memory_order_relaxed)) {
+			auto buffers = new BufferSlot[MaxPendingBuffers];
+
+			for (size_t i = 0; i < MaxPendingBuffers; ++i)
+				buffers[i].Sequence.store(i, std::memory_order_relaxed);
+
+			voice.Buffers.store(buffers, std::memory_order_release);
+		}
+
+		voice.Sound.reset();
+		voice.BufferNeeded = std::move(bufferNeeded);
+		voice.StreamSampleRate.store(sampleRate, std::memory_order_relaxed);
+		voice.StreamChannels.store(channels, std::memory_order_relaxed);
+		voice.Streaming.store(true, std::memory_order_release);
+
+		return start(index, volume, pitch, pan, false);
+	}
+
+	bool AudioMixer::SubmitBuffer(uint32_t voice, vector<uint8_t> const& buffer) {
+		auto slot = find(voice);
+
+		if (!slot)
+			return false;
+
+		return submit(voice, std::make_shared<SoundEffect const>(buffer,
+			slot->StreamSampleRate.load(std::memory_order_relaxed), slot->StreamChannels.load(std::memory_order_relaxed)));
+	}
+
+	bool AudioMixer::SubmitBuffer(uint32_t voice, vector<float> const& samples) {
+		auto slot = find(voice);
+
+		if (!slot)
+			return false;
+
+		return submit(voice, std::make_shared<SoundEffect const>(samples,
+			slot->StreamSampleRate.load(std::memory_order_relaxed), slot->StreamChannels.load(std::memory_order_relaxed)));
+	}
+
+	size_t AudioMixer::PendingBufferCount(uint32_t voice) const {
+		auto slot = find(voice);
+
+		if (!slot || !slot->Streaming.load(std::memory_order_acquire))
+			return 0;
+
+		return slot->PendingBuffers.load(std::memory_order_relaxed);
+	}
+
+	bool AudioMixer::Stop(uint32_t voice) {
+		return post(CommandType::Stop, voice);
+	}
+
+	bool AudioMixer::Pause(uint32_t voice) {
+		return post(CommandType::Pause, voice);
+	}
+
+	bool AudioMixer::Resume(uint32_t voice) {
+		return post(CommandType::Resume, voice);
+	}
+
+	bool AudioMixer::Volume(uint32_t voice, float value) {
+		return post(CommandType::Volume, voice, MathHelper::Clamp(value, 0.0f, 1.0f));
+	}
+
+	bool AudioMixer::Pitch(uint32_t voice, float value) {
+		return post(CommandType::Pitch, voice, MathHelper::Clamp(value, -1.0f, 1.0f));
+	}
+
+	bool AudioMixer::Pan(uint32_t voice, float value) {
+		return post(CommandType::Pan, voice, MathHelper::Clamp(value, -1.0f, 1.0f));
+	}
+
+	bool AudioMixer::IsLooped(uint32_t voice, bool value) {
+		return post(CommandType::Looped, voice, value ? 1.0f : 0.0f);
+	}
+
+	bool AudioMixer::Apply3D(uint32_t voice, AudioListener const& listener, AudioEmitter const& emitter) {
+		auto offset = emitter.Position - listener.Position;
+		auto distance = offset.Length();
+		auto pan = 0.0f;
+		auto doppler = 1.0f;
+
+		if (distance > 1e-6f) {
+			auto direction = offset / distance;
+			auto right = Vector3::Normalize(Vector3::Cross(listener.Forward, listener.Up));
+
+			if (!std::isnan(right.X))
+				pan = MathHelper::Clamp(Vector3::Dot(direction, right), -1.0f, 1.0f);
+
+			// OpenAL's Doppler model, with both velocities projected on the listener to emitter axis.
+			auto speed = SoundEffect::SpeedOfSound();
+			auto factor = SoundEffect::DopplerScale() * emitter.DopplerScale();
+
+			if (factor > 0) {
+				auto limit = speed / factor;
+				auto listenerSpeed = MathHelper::Min(-Vector3::Dot(listener.Velocity, direction), limit);
+				auto emitterSpeed = MathHelper::Min(-Vector3::Dot(emitter.Velocity, direction), limit);
+				doppler = MathHelper::Clamp((speed - factor * listenerSpeed) / (speed - factor * emitterSpeed), 0.5f, 2.0f);
+
+				if (std::isnan(doppler))
+					doppler = 1.0f;
+			}
+		}
+
+		auto reference = SoundEffect::DistanceScale();
+		auto attenuation = distance > reference ? reference / distance : 1.0f;
+		float left;
+		float right;
+		panGains(pan, left, right);
+
+		return post(CommandType::Spatial, voice, left * attenuation, right * attenuation, doppler);
+	}
+
+	SoundState AudioMixer::State(uint32_t voice) const {
+		auto slot = find(voice);
+		return slot ? slot->State.load(std::memory_order_relaxed) : SoundState::Stopped;
+	}
+
+	void AudioMixer::Mix(float* destination, size_t frameCount) {
+		XNA_PROFILE_ZONE("AudioMixer::Mix");
+
+		Command command;
+		while (pop(command))
+			apply(command);
+
+		auto masterVolume = SoundEffect::MasterVolume();
+
+		for (size_t offset = 0; offset < frameCount; offset += BlockSize) {
+			auto count = std::min(BlockSize, frameCount - offset);
+			std::fill_n(_left.data(), count, 0.0f);
+			std::fill_n(_right.data(), count, 0.0f);
+
+			for (size_t i = 0; i < _playing.size();) {
+				auto index = _playing[i];
+				auto& voice = _voices[index];
+
+				if (voice.State.load(std::memory_order_relaxed) == SoundState::Paused || mixVoice(voice, count, masterVolume)) {
+					++i;
+					continue;
+				}
+
+				release(index);
+				_playing[i] = _playing.back();
+				_playing.pop_back();
+			}
+
+			interleave(_left.data(), _right.data(), destination + offset * 2, count);
+		}
+	}
+
+	bool AudioMixer::Render(AudioSink& sink, size_t frameCount) {
+		vector<float> buffer(frameCount * 2);
+		Mix(buffer.data(), frameCount);
+		return sink.Write(buffer.data(), frameCount);
+	}
+
+	bool AudioMixer::Start(std::shared_ptr<AudioSink> const& sink, size_t blockFrames, bool realTime) {
+		if (!sink || blockFrames == 0 || _running.exchange(true))
+			return false;
+
+		_thread = std::thread([this, sink, blockFrames, realTime]() {
+			vector<float> buffer(blockFrames * 2);
+			auto period = std::chrono::duration<double>(static_cast<double>(blockFrames) / _sampleRate);
+			auto deadline = std::chrono::steady_clock::now();
+
+			while (_running.load(std::memory_order_relaxed)) {
+				Mix(buffer.data(), blockFrames);
+
+				if (!sink->Write(buffer.data(), blockFrames))
+					break;
+
+				if (realTime) {
+					deadline += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+					std::this_thread::sleep_until(deadline);
+				}
+			}
+			});
+
+		return true;
+	}
+
+	void AudioMixer::Stop() {
+		_running.store(false);
+
+		if (_thread.joinable())
+			_thread.join();
+	}
+
+	bool AudioMixer::IsRunning() const {
+		return _running.load(std::memory_order_relaxed);
+	}
+}
+
+//Private
+namespace Xna {
+	// The slot is invisible to the mixer until the Play command is consumed, so plain writes are safe here.
+	uint32_t AudioMixer::start(uint32_t index, float volume, float pitch, float pan, bool isLooped) {
+		auto& voice = _voices[index];
+		voice.Position = 0;
+		voice.Volume = MathHelper::Clamp(volume, 0.0f, 1.0f);
+		voice.Pitch = MathHelper::Clamp(pitch, -1.0f, 1.0f);
+		voice.Pan = MathHelper::Clamp(pan, -1.0f, 1.0f);
+		voice.Looped = isLooped;
+		voice.Spatial = false;
+		voice.Doppler = 1.0f;
+		voice.Started = false;
+		voice.State.store(SoundState::Playing, std::memory_order_relaxed);
+
+		auto handle = (voice.Generation.load(std::memory_order_relaxed) & 0xFFFF) << 16 | index;
+		voice.Handle = handle;
+
+		if (!post(CommandType::Play, handle)) {
+			release(index);
+			return InvalidVoice;
+		}
+
+		return handle;
+	}
+
+	// Same bounded multi-producer queue as post(), one per streaming voice, drained by the mixer.
+	bool AudioMixer::submit(uint32_t voice, std::shared_ptr<SoundEffect const> buffer) {
+		auto slot = find(voice);
+
+		if (!slot || buffer->FrameCount() == 0 || !slot->Streaming.load(std::memory_order_acquire))
+			return false;
+
+		auto buffers = slot->Buffers.load(std::memory_order_acquire);
+		// Counted first so the mixer can never finish the buffer before it is counted.
+		slot->PendingBuffers.fetch_add(1, std::memory_order_relaxed);
+
+		auto position = slot->BufferEnqueue.load(std::memory_order_relaxed);
+		BufferSlot* entry;
+
+		while (true) {
+			entry = &buffers[position & (MaxPendingBuffers - 1)];
+			auto sequence = entry->Sequence.load(std::memory_order_acquire);
+			auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (difference == 0) {
+				if (slot->BufferEnqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0) {
+				slot->PendingBuffers.fetch_sub(1, std::memory_order_relaxed);
+				return false;
+			}
+			else {
+				position = slot->BufferEnqueue.load(std::memory_order_relaxed);
+			}
+		}
+
+		entry->Voice = voice;
+		entry->Buffer = std::move(buffer);
+		entry->Sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	// Makes the next queued buffer current, dropping any sent to an earlier use of the slot.
+	bool AudioMixer::nextBuffer(Voice& voice) {
+		auto buffers = voice.Buffers.load(std::memory_order_relaxed);
+
+		while (true) {
+			auto& entry = buffers[voice.BufferDequeue & (MaxPendingBuffers - 1)];
+
+			if (entry.Sequence.load(std::memory_order_acquire) != voice.BufferDequeue + 1)
+				return false;
+
+			auto buffer = std::move(entry.Buffer);
+			auto owner = entry.Voice;
+			entry.Sequence.store(voice.BufferDequeue + MaxPendingBuffers, std::memory_order_release);
+			++voice.BufferDequeue;
+
+			if (owner == voice.Handle) {
+				voice.Sound = std::move(buffer);
+				return true;
+			}
+
+			voice.PendingBuffers.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	SoundEffect const* AudioMixer::peekBuffer(Voice const& voice) const {
+		auto const& entry = voice.Buffers.load(std::memory_order_relaxed)[voice.BufferDequeue & (MaxPendingBuffers - 1)];
+
+		if (entry.Sequence.load(std::memory_order_acquire) != voice.BufferDequeue + 1 || entry.Voice != voice.Handle)
+			return nullptr;
+
+		return entry.Buffer.get();
+	}
+
+	void AudioMixer::finishBuffer(Voice& voice) {
+		voice.Sound.reset();
+		auto pending = voice.PendingBuffers.fetch_sub(1, std::memory_order_relaxed) - 1;
+
+		if (voice.BufferNeeded && pending <= 2)
+			voice.BufferNeeded(voice.Handle);
+	}
+
+	void AudioMixer::discardBuffers(Voice& voice) {
+		while (nextBuffer(voice))
+			voice.Sound.reset();
+
+		voice.PendingBuffers.store(0, std::memory_order_relaxed);
+	}
+
+	// Bounded multi-producer queue (Vyukov): each slot's sequence tells producers and the consumer whose turn it is.
+	bool AudioMixer::post(CommandType type, uint32_t voice, float value0, float value1, float value2) {
+		if (type != CommandType::Play && !find(voice))
+			return false;
+
+		auto position = _enqueuePosition.load(std::memory_order_relaxed);
+		CommandSlot* slot;
+
+		while (true) {
+			slot = &_commands[position & _commandMask];
+			auto sequence = slot->Sequence.load(std::memory_order_acquire);
+			auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (difference == 0) {
+				if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0) {
+				return false;
+			}
+			else {
+				position = _enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->Value.Type = type;
+		slot->Value.Voice = voice;
+		slot->Value.Values[0] = value0;
+		slot->Value.Values[1] = value1;
+		slot->Value.Values[2] = value2;
+		slot->Sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	bool AudioMixer::pop(Command& command) {
+		auto& slot = _commands[_dequeuePosition & _commandMask];
+
+		if (slot.Sequence.load(std::memory_order_acquire) != _dequeuePosition + 1)
+			return false;
+
+		command = slot.Value;
+		slot.Sequence.store(_dequeuePosition + _commandMask + 1, std::memory_order_release);
+		++_dequeuePosition;
+
+		return true;
+	}
+
+	AudioMixer::Voice* AudioMixer::find(uint32_t voice) {
+		auto index = voice & 0xFFFF;
+
+		if (voice == InvalidVoice || index >= _voiceCount
+			|| (_voices[index].Generation.load(std::memory_order_acquire) & 0xFFFF) != voice >> 16)
+			return nullptr;
+
+		return &_voices[index];
+	}
+
+	AudioMixer::Voice const* AudioMixer::find(uint32_t voice) const {
+		return const_cast<AudioMixer*>(this)->find(voice);
+	}
+
+	uint32_t AudioMixer::allocate() {
+		auto head = _freeHead.load(std::memory_order_acquire);
+
+		while (true) {
+			auto entry = static_cast<uint32_t>(head);
+
+			if (entry == 0)
+				return InvalidVoice;
+
+			auto next = _voices[entry - 1].Next.load(std::memory_order_relaxed);
+			auto replacement = ((head >> 32) + 1) << 32 | next;
+
+			if (_freeHead.compare_exchange_weak(head, replacement, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				_activeCount.fetch_add(1, std::memory_order_relaxed);
+				return entry - 1;
+			}
+		}
+	}
+
+	void AudioMixer::release(uint32_t index) {
+		auto& voice = _voices[index];
+		voice.Generation.fetch_add(1, std::memory_order_release);
+		voice.State.store(SoundState::Stopped, std::memory_order_relaxed);
+		voice.Sound.reset();
+		voice.BufferNeeded = nullptr;
+
+		auto head = _freeHead.load(std::memory_order_relaxed);
+
+		while (true) {
+			voice.Next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+			auto replacement = ((head >> 32) + 1) << 32 | (index + 1);
+
+			if (_freeHead.compare_exchange_weak(head, replacement, std::memory_order_release, std::memory_order_relaxed))
+				break;
+		}
+
+		_activeCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void AudioMixer::apply(Command const& command) {
+		auto voice = find(command.Voice);
+
+		if (!voice)
+			return;
+
+		switch (command.Type) {
+		case CommandType::Play:
+			_playing.push_back(command.Voice & 0xFFFF);
+			break;
+		case CommandType::Stop: {
+			auto index = command.Voice & 0xFFFF;
+
+			if (voice->Streaming.load(std::memory_order_relaxed))
+				discardBuffers(*voice);
+			auto playing = std::find(_playing.begin(), _playing.end(), index);
+
+			if (playing != _playing.end()) {
+				*playing = _playing.back();
+				_playing.pop_back();
+			}
+
+			release(index);
+			break;
+		}
+		case CommandType::Pause:
+			voice->State.store(SoundState::Paused, std::memory_order_relaxed);
+			break;
+		case CommandType::Resume:
+			voice->State.store(SoundState::Playing, std::memory_order_relaxed);
+			break;
+		case CommandType::Volume:
+			voice->Volume = command.Values[0];
+			break;
+		case CommandType::Pitch:
+			voice->Pitch = command.Values[0];
+			break;
+		case CommandType::Pan:
+			voice->Pan = command.Values[0];
+			voice->Spatial = false;
+			voice->Doppler = 1.0f;
+			break;
+		case CommandType::Looped:
+			voice->Looped = command.Values[0] != 0;
+			break;
+		case CommandType::Spatial:
+			voice->SpatialLeft = command.Values[0];
+			voice->SpatialRight = command.Values[1];
+			voice->Doppler = command.Values[2];
+			voice->Spatial = true;
+			break;
+		}
+	}
+
+	// Returns false once a voice that does not loop has played to its end. Streaming voices go on to their next
+	// queued buffer instead, and play silence while none is queued.
+	bool AudioMixer::mixVoice(Voice& voice, size_t frameCount, float masterVolume) {
+		auto streaming = voice.Streaming.load(std::memory_order_relaxed);
+
+		if (streaming && !voice.Sound && !nextBuffer(voice)) {
+			if (voice.BufferNeeded)
+				voice.BufferNeeded(voice.Handle);
+
+			return true;
+		}
+
+		float targetLeft;
+		float targetRight;
+
+		if (voice.Spatial) {
+			targetLeft = voice.SpatialLeft;
+			targetRight = voice.SpatialRight;
+		}
+		else {
+			panGains(voice.Pan, targetLeft, targetRight);
+		}
+
+		targetLeft *= voice.Volume * masterVolume;
+		targetRight *= voice.Volume * masterVolume;
+
+		if (!voice.Started) {
+			voice.GainLeft = targetLeft;
+			voice.GainRight = targetRight;
+			voice.Started = true;
+		}
+
+		auto deltaLeft = (targetLeft - voice.GainLeft) / frameCount;
+		auto deltaRight = (targetRight - voice.GainRight) / frameCount;
+		size_t done = 0;
+
+		while (done < frameCount) {
+			if (!voice.Sound && (!streaming || !nextBuffer(voice)))
+				break;
+
+			auto const& sound = *voice.Sound;
+			auto length = sound.FrameCount();
+			auto ratio = static_cast<double>(sound.SampleRate()) / _sampleRate * std::exp2(voice.Pitch) * voice.Doppler;
+			auto step = std::max(static_cast<uint64_t>(ratio * fixedOne), uint64_t{ 1 });
+			auto source0 = sound.Samples(0);
+			auto source1 = sound.Samples(1);
+			auto end = static_cast<uint64_t>(length) << 32;
+
+			if (voice.Position >= end) {
+				if (streaming) {
+					// Keeps the fractional position so the next buffer continues without a seam.
+					voice.Position -= end;
+					finishBuffer(voice);
+					continue;
+				}
+
+				if (!voice.Looped)
+					return false;
+
+				voice.Position %= end;
+			}
+
+			auto gainLeft = voice.GainLeft + deltaLeft * done;
+			auto gainRight = voice.GainRight + deltaRight * done;
+			auto count = std::min(safeFrames(voice.Position, step, length), frameCount - done);
+
+			if (count > 0) {
+				resample(source0, source1, voice.Position, step, count,
+					_left.data() + done, _right.data() + done, gainLeft, deltaLeft, gainRight, deltaRight);
+				voice.Position += count * step;
+				done += count;
+				continue;
+			}
+
+			// The last frame interpolates toward the loop start or the next queued buffer, or toward silence.
+			auto next = streaming ? peekBuffer(voice) : (voice.Looped ? &sound : nullptr);
+			auto next0 = next ? next->Samples(0)[0] : 0.0f;
+			auto next1 = next ? next->Samples(1)[0] : 0.0f;
+			auto index = static_cast<size_t>(voice.Position >> 32);
+			auto fraction = static_cast<uint32_t>(voice.Position) * fractionScale;
+
+			_left[done] += (source0[index] + (next0 - source0[index]) * fraction) * gainLeft;
+			_right[done] += (source1[index] + (next1 - source1[index]) * fraction) * gainRight;
+			voice.Position += step;
+			++done;
+		}
+
+		voice.GainLeft = targetLeft;
+		voice.GainRight = targetRight;
+
+		return true;
+	}
+}
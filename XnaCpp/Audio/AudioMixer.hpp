@@ -0,0 +1,180 @@
+#ifndef _AUDIOMIXER_HPP_
+#define _AUDIOMIXER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "AudioChannels.hpp"
+#include "AudioEmitter.hpp"
+#include "AudioListener.hpp"
+#include "AudioSink.hpp"
+#include "SoundEffect.hpp"
+#include "SoundState.hpp"
+
+namespace Xna {
+
+	// Mixes SoundEffect voices into a stereo float stream on the CPU.
+	// Voices come from a fixed pool and are addressed by handles that go stale once the voice stops.
+	// Play, Stop and the other voice functions may be called from any thread: they never lock and only post
+	// commands to a bounded queue that Mix() drains, so they return false (or InvalidVoice) when the pool or the
+	// queue is full. Mix(), Render() and the thread started by Start() are the single consumer.
+	// Voices are resampled with linear interpolation and their gains ramp across each block to avoid clicks.
+	// Streaming voices, as with DynamicSoundEffectInstance, play buffers submitted while they run, back to back.
+	class AudioMixer {
+	public:
+		static constexpr uint32_t InvalidVoice = 0xFFFFFFFFu;
+		static constexpr size_t BlockSize = 256;
+		// Buffers a streaming voice can queue behind the one playing.
+		static constexpr size_t MaxPendingBuffers = 64;
+
+		// Called on the mixing thread with the voice handle; it must not block, but may call SubmitBuffer.
+		using BufferNeededCallback = std::function<void(uint32_t voice)>;
+
+		AudioMixer(int32_t sampleRate = 48000, size_t voiceCount = 64, size_t commandCapacity = 1024);
+		~AudioMixer();
+
+		AudioMixer(AudioMixer const&) = delete;
+		AudioMixer& operator =(AudioMixer const&) = delete;
+
+		int32_t SampleRate() const;
+		size_t VoiceCount() const;
+		// Voices handed out by Play() that have not stopped yet.
+		size_t ActiveVoiceCount() const;
+
+		// Pitch is in octaves, from -1 to 1; pan runs from -1 (left) to 1 (right).
+		uint32_t Play(std::shared_ptr<SoundEffect const> const& sound, float volume = 1.0f, float pitch = 0.0f, float pan = 0.0f, bool isLooped = false);
+		// Starts a streaming voice that plays buffers of the given format as they are submitted and plays silence
+		// while none are queued. bufferNeeded, when set, runs each time a buffer finishes with two or fewer left, and
+		// once per mixed block while the voice is starved. Looping does not apply to streaming voices.
+		uint32_t PlayDynamic(int32_t sampleRate, AudioChannels channels, BufferNeededCallback bufferNeeded = nullptr,
+			float volume = 1.0f, float pitch = 0.0f, float pan = 0.0f);
+		// Queues 16-bit little-endian interleaved PCM, or interleaved float samples, in the voice's format.
+		// Returns false for stale or non-streaming voices, empty buffers and full queues.
+		bool SubmitBuffer(uint32_t voice, std::vector<uint8_t> const& buffer);
+		bool SubmitBuffer(uint32_t voice, std::vector<float> const& samples);
+		// Submitted buffers that have not finished playing, including the current one; 0 for non-streaming voices.
+		size_t PendingBufferCount(uint32_t voice) const;
+
+		bool Stop(uint32_t voice);
+		bool Pause(uint32_t voice);
+		bool Resume(uint32_t voice);
+		bool Volume(uint32_t voice, float value);
+		bool Pitch(uint32_t voice, float value);
+		bool Pan(uint32_t voice, float value);
+		bool IsLooped(uint32_t voice, bool value);
+
+		// Replaces the pan of the voice with the direction, distance attenuation and Doppler shift of the emitter
+		// relative to the listener, using the SoundEffect distance, Doppler and speed of sound settings.
+		bool Apply3D(uint32_t voice, AudioListener const& listener, AudioEmitter const& emitter);
+
+		// Stopped for stale handles. Play takes effect at once; other changes once Mix() has applied them.
+		SoundState State(uint32_t voice) const;
+
+		// Writes frameCount interleaved stereo frames.
+		void Mix(float* destination, size_t frameCount);
+		bool Render(AudioSink& sink, size_t frameCount);
+
+		// Renders blocks of blockFrames into the sink on a dedicated thread, paced to the sample rate when realTime is set.
+		bool Start(std::shared_ptr<AudioSink> const& sink, size_t blockFrames = 1024, bool realTime = true);
+		void Stop();
+		bool IsRunning() const;
+
+	private:
+		enum class CommandType : uint8_t {
+			Play,
+			Stop,
+			Pause,
+			Resume,
+			Volume,
+			Pitch,
+			Pan,
+			Looped,
+			Spatial
+		};
+
+		struct Command {
+			CommandType Type;
+			uint32_t Voice;
+			float Values[3];
+		};
+
+		struct CommandSlot {
+			std::atomic<size_t> Sequence;
+			Command Value;
+		};
+
+		// Entries carry the submitting handle, so buffers sent to a voice after it was reused are dropped.
+		struct BufferSlot {
+			std::atomic<size_t> Sequence;
+			uint32_t Voice;
+			std::shared_ptr<SoundEffect const> Buffer;
+		};
+
+		struct Voice {
+			~Voice();
+
+			std::shared_ptr<SoundEffect const> Sound;
+			std::atomic<uint32_t> Generation{ 0 };
+			std::atomic<SoundState> State{ SoundState::Stopped };
+			std::atomic<uint32_t> Next{ 0 };
+			uint64_t Position{ 0 };
+			float Volume{ 1 };
+			float Pitch{ 0 };
+			float Pan{ 0 };
+			float SpatialLeft{ 1 };
+			float SpatialRight{ 1 };
+			float Doppler{ 1 };
+			float GainLeft{ 0 };
+			float GainRight{ 0 };
+			bool Looped{ false };
+			bool Spatial{ false };
+			bool Started{ false };
+			uint32_t Handle{ InvalidVoice };
+			// Streaming state. Buffers is allocated by the first PlayDynamic on the slot and kept for later ones.
+			std::atomic<bool> Streaming{ false };
+			std::atomic<int32_t> StreamSampleRate{ 0 };
+			std::atomic<AudioChannels> StreamChannels{ AudioChannels::Mono };
+			std::atomic<BufferSlot*> Buffers{ nullptr };
+			std::atomic<size_t> BufferEnqueue{ 0 };
+			size_t BufferDequeue{ 0 };
+			std::atomic<size_t> PendingBuffers{ 0 };
+			BufferNeededCallback BufferNeeded;
+		};
+
+		bool post(CommandType type, uint32_t voice, float value0 = 0, float value1 = 0, float value2 = 0);
+		bool pop(Command& command);
+		Voice* find(uint32_t voice);
+		Voice const* find(uint32_t voice) const;
+		uint32_t start(uint32_t index, float volume, float pitch, float pan, bool isLooped);
+		bool submit(uint32_t voice, std::shared_ptr<SoundEffect const> buffer);
+		bool nextBuffer(Voice& voice);
+		SoundEffect const* peekBuffer(Voice const& voice) const;
+		void finishBuffer(Voice& voice);
+		void discardBuffers(Voice& voice);
+		uint32_t allocate();
+		void release(uint32_t index);
+		void apply(Command const& command);
+		bool mixVoice(Voice& voice, size_t frameCount, float masterVolume);
+
+		int32_t _sampleRate{ 48000 };
+		std::unique_ptr<Voice[]> _voices;
+		size_t _voiceCount{ 0 };
+		std::atomic<uint64_t> _freeHead{ 0 };
+		std::atomic<size_t> _activeCount{ 0 };
+		std::unique_ptr<CommandSlot[]> _commands;
+		size_t _commandMask{ 0 };
+		std::atomic<size_t> _enqueuePosition{ 0 };
+		size_t _dequeuePosition{ 0 };
+		std::vector<uint32_t> _playing;
+		std::vector<float> _left;
+		std::vector<float> _right;
+		std::thread _thread;
+		std::atomic<bool> _running{ false };
+	};
+}
+
+#endif
@@ -0,0 +1,30 @@
+#include <cmath>
+#include "AudioSink.hpp"
+#include "../Simd.hpp"
+
+//Static
+namespace Xna {
+	void AudioSink::ConvertToInt16(float const* source, int16_t* destination, size_t count) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto scale = _mm_set1_ps(32767.0f);
+		auto minimum = _mm_set1_ps(-32768.0f);
+		auto maximum = _mm_set1_ps(32767.0f);
+
+		// Clamped before cvtps, which turns values beyond int32 into INT32_MIN. cvtps rounds like nearbyint below.
+		auto convert = [&](float const* samples) {
+			auto value = _mm_mul_ps(_mm_loadu_ps(samples), scale);
+			value = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+			return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(value, minimum), maximum));
+		};
+
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packs_epi32(convert(source + i), convert(source + i + 4)));
+#endif
+		for (; i < count; ++i) {
+			auto value = source[i] * 32767.0f;
+			value = value != value ? 0.0f : value < -32768.0f ? -32768.0f : value > 32767.0f ? 32767.0f : value;
+			destination[i] = static_cast<int16_t>(std::nearbyint(value));
+		}
+	}
+}
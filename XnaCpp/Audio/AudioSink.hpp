@@ -0,0 +1,24 @@
+#ifndef _AUDIOSINK_HPP_
+#define _AUDIOSINK_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Xna {
+
+	// Destination for mixed audio: interleaved stereo float frames in [-1, 1], as AudioMixer produces.
+	class AudioSink {
+	public:
+		virtual ~AudioSink() = default;
+
+		// Returns false when the frames could not be written.
+		virtual bool Write(float const* samples, size_t frameCount) = 0;
+
+		static constexpr size_t Channels = 2;
+
+		// Converts count samples to 16-bit PCM, clamping and rounding to nearest even. NaN becomes 0.
+		static void ConvertToInt16(float const* source, int16_t* destination, size_t count);
+	};
+}
+
+#endif
@@ -0,0 +1,22 @@
+#include "PcmSink.hpp"
+
+//Constructors
+namespace Xna {
+	PcmSink::PcmSink(std::ostream& stream) :
+		_stream(stream) {}
+}
+
+//Functions
+namespace Xna {
+	bool PcmSink::Write(float const* samples, size_t frameCount) {
+		auto count = frameCount * Channels;
+
+		if (_buffer.size() < count)
+			_buffer.resize(count);
+
+		ConvertToInt16(samples, _buffer.data(), count);
+		_stream.write(reinterpret_cast<char const*>(_buffer.data()), static_cast<std::streamsize>(count * sizeof(int16_t)));
+
+		return static_cast<bool>(_stream);
+	}
+}
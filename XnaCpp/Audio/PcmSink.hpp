@@ -0,0 +1,24 @@
+#ifndef _PCMSINK_HPP_
+#define _PCMSINK_HPP_
+
+#include <ostream>
+#include <vector>
+#include "AudioSink.hpp"
+
+namespace Xna {
+
+	// Writes the mixer's stereo output as headerless 16-bit little-endian interleaved PCM to a stream that must
+	// outlive the sink.
+	class PcmSink : public AudioSink {
+	public:
+		PcmSink(std::ostream& stream);
+
+		bool Write(float const* samples, size_t frameCount) override;
+
+	private:
+		std::ostream& _stream;
+		std::vector<int16_t> _buffer;
+	};
+}
+
+#endif
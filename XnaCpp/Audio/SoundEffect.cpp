@@ -0,0 +1,202 @@
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "SoundEffect.hpp"
+
+using CSharp::TimeSpan;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		std::atomic<float> masterVolume{ 1.0f };
+		std::atomic<float> distanceScale{ 1.0f };
+		std::atomic<float> dopplerScale{ 1.0f };
+		std::atomic<float> speedOfSound{ 343.5f };
+
+		uint32_t readUInt32(uint8_t const* data) {
+			return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+		}
+
+		uint16_t readUInt16(uint8_t const* data) {
+			return static_cast<uint16_t>(data[0] | (data[1] << 8));
+		}
+
+		float readSample(uint8_t const* data, uint16_t bitsPerSample, bool isFloat) {
+			switch (bitsPerSample) {
+			case 8:
+				return (data[0] - 128) / 128.0f;
+			case 16:
+				return static_cast<int16_t>(readUInt16(data)) / 32768.0f;
+			case 24:
+				return static_cast<int32_t>((data[0] << 8) | (data[1] << 16) | (static_cast<uint32_t>(data[2]) << 24)) / 2147483648.0f;
+			case 32:
+				if (isFloat) {
+					float value;
+					auto bits = readUInt32(data);
+					std::memcpy(&value, &bits, sizeof(value));
+					return value;
+				}
+
+				return static_cast<int32_t>(readUInt32(data)) / 2147483648.0f;
+			}
+
+			return 0;
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	SoundEffect::SoundEffect(vector<uint8_t> const& buffer, int32_t sampleRate, AudioChannels channels) :
+		_sampleRate(sampleRate), _channels(channels) {
+		auto channelCount = static_cast<size_t>(channels);
+		auto frames = buffer.size() / (2 * channelCount);
+
+		for (size_t c = 0; c < channelCount; ++c) {
+			_samples[c].resize(frames);
+
+			for (size_t i = 0; i < frames; ++i)
+				_samples[c][i] = static_cast<int16_t>(readUInt16(buffer.data() + (i * channelCount + c) * 2)) / 32768.0f;
+		}
+	}
+
+	SoundEffect::SoundEffect(vector<float> const& samples, int32_t sampleRate, AudioChannels channels) :
+		_sampleRate(sampleRate), _channels(channels) {
+		auto channelCount = static_cast<size_t>(channels);
+		auto frames = samples.size() / channelCount;
+
+		for (size_t c = 0; c < channelCount; ++c) {
+			_samples[c].resize(frames);
+
+			for (size_t i = 0; i < frames; ++i)
+				_samples[c][i] = samples[i * channelCount + c];
+		}
+	}
+}
+
+//Functions
+namespace Xna {
+	int32_t SoundEffect::SampleRate() const {
+		return _sampleRate;
+	}
+
+	AudioChannels SoundEffect::Channels() const {
+		return _channels;
+	}
+
+	size_t SoundEffect::FrameCount() const {
+		return _samples[0].size();
+	}
+
+	TimeSpan SoundEffect::Duration() const {
+		if (_sampleRate <= 0)
+			return TimeSpan();
+
+		return TimeSpan(static_cast<int64_t>(FrameCount() * static_cast<double>(TimeSpan::TicksPerSecond) / _sampleRate));
+	}
+
+	float const* SoundEffect::Samples(int32_t channel) const {
+		return _samples[channel > 0 && _channels == AudioChannels::Stereo ? 1 : 0].data();
+	}
+}
+
+//Static
+namespace Xna {
+	std::shared_ptr<SoundEffect> SoundEffect::FromWav(uint8_t const* data, size_t size) {
+		if (!data || size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0)
+			return nullptr;
+
+		uint16_t format = 0;
+		uint16_t channels = 0;
+		uint32_t sampleRate = 0;
+		uint16_t bitsPerSample = 0;
+		uint8_t const* samples = nullptr;
+		size_t samplesSize = 0;
+
+		for (size_t offset = 12; offset + 8 <= size;) {
+			auto chunkSize = static_cast<size_t>(readUInt32(data + offset + 4));
+			auto body = data + offset + 8;
+			auto available = size - offset - 8;
+
+			if (std::memcmp(data + offset, "fmt ", 4) == 0 && chunkSize >= 16 && chunkSize <= available) {
+				format = readUInt16(body);
+				channels = readUInt16(body + 2);
+				sampleRate = readUInt32(body + 4);
+				bitsPerSample = readUInt16(body + 14);
+
+				// WAVE_FORMAT_EXTENSIBLE keeps the real format in the first two bytes of the sub-format GUID.
+				if (format == 0xFFFE && chunkSize >= 26)
+					format = readUInt16(body + 24);
+			}
+			else if (std::memcmp(data + offset, "data", 4) == 0) {
+				samples = body;
+				samplesSize = chunkSize < available ? chunkSize : available;
+			}
+
+			offset += 8 + chunkSize + (chunkSize & 1);
+		}
+
+		auto isFloat = format == 3;
+
+		if (!samples || (format != 1 && !isFloat) || (channels != 1 && channels != 2) || sampleRate == 0
+			|| (isFloat && bitsPerSample != 32)
+			|| (bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32))
+			return nullptr;
+
+		auto bytesPerSample = bitsPerSample / 8u;
+		auto frames = samplesSize / (bytesPerSample * channels);
+		vector<float> interleaved(frames * channels);
+
+		for (size_t i = 0; i < interleaved.size(); ++i)
+			interleaved[i] = readSample(samples + i * bytesPerSample, bitsPerSample, isFloat);
+
+		return std::make_shared<SoundEffect>(interleaved, static_cast<int32_t>(sampleRate), static_cast<AudioChannels>(channels));
+	}
+
+	std::shared_ptr<SoundEffect> SoundEffect::FromFile(std::string const& path) {
+		std::ifstream stream(path, std::ios::binary);
+
+		if (!stream)
+			return nullptr;
+
+		vector<uint8_t> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+		return FromWav(data.data(), data.size());
+	}
+
+	float SoundEffect::MasterVolume() {
+		return masterVolume.load(std::memory_order_relaxed);
+	}
+
+	void SoundEffect::MasterVolume(float value) {
+		masterVolume.store(value < 0 ? 0 : value > 1 ? 1 : value, std::memory_order_relaxed);
+	}
+
+	float SoundEffect::DistanceScale() {
+		return distanceScale.load(std::memory_order_relaxed);
+	}
+
+	void SoundEffect::DistanceScale(float value) {
+		if (value > 0)
+			distanceScale.store(value, std::memory_order_relaxed);
+	}
+
+	float SoundEffect::DopplerScale() {
+		return dopplerScale.load(std::memory_order_relaxed);
+	}
+
+	void SoundEffect::DopplerScale(float value) {
+		if (value >= 0)
+			dopplerScale.store(value, std::memory_order_relaxed);
+	}
+
+	float SoundEffect::SpeedOfSound() {
+		return speedOfSound.load(std::memory_order_relaxed);
+	}
+
+	void SoundEffect::SpeedOfSound(float value) {
+		if (value > 0)
+			speedOfSound.store(value, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef _SOUNDEFFECT_HPP_
+#define _SOUNDEFFECT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "AudioChannels.hpp"
+#include "../CSharp/TimeSpan.hpp"
+
+namespace Xna {
+
+	// Decoded audio held as one float buffer per channel, ready for AudioMixer to resample.
+	class SoundEffect {
+	public:
+		// 16-bit little-endian interleaved PCM, as in XNA.
+		SoundEffect(std::vector<uint8_t> const& buffer, int32_t sampleRate, AudioChannels channels);
+
+		// Interleaved float samples in [-1, 1].
+		SoundEffect(std::vector<float> const& samples, int32_t sampleRate, AudioChannels channels);
+
+		// Parses a RIFF WAVE file with 8, 16, 24 or 32-bit integer or 32-bit float samples and one or two channels.
+		// Returns nullptr when the data is not such a file.
+		static std::shared_ptr<SoundEffect> FromWav(uint8_t const* data, size_t size);
+		static std::shared_ptr<SoundEffect> FromFile(std::string const& path);
+
+		int32_t SampleRate() const;
+		AudioChannels Channels() const;
+
+		// Length in sample frames.
+		size_t FrameCount() const;
+		CSharp::TimeSpan Duration() const;
+
+		// Samples of one channel; FrameCount() values are readable.
+		float const* Samples(int32_t channel) const;
+
+		static float MasterVolume();
+		static void MasterVolume(float value);
+
+		// Distance at which 3D sounds start to attenuate.
+		static float DistanceScale();
+		static void DistanceScale(float value);
+
+		static float DopplerScale();
+		static void DopplerScale(float value);
+
+		// In world units per second.
+		static float SpeedOfSound();
+		static void SpeedOfSound(float value);
+
+	private:
+		std::vector<float> _samples[2];
+		int32_t _sampleRate{ 0 };
+		AudioChannels _channels{ AudioChannels::Mono };
+	};
+}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef _SOUNDSTATE_HPP_
+#define _SOUNDSTATE_HPP_
+
+namespace Xna {
+	enum class SoundState {
+
+		// The sound is playing.
+		Playing,
+
+		// The sound is paused and keeps its position.
+		Paused,
+
+		// The sound is not playing.
+		Stopped
+	};
+}
+
+#endif
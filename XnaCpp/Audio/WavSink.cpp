@@ -0,0 +1,86 @@
+#include "WavSink.hpp"
+
+//Private
+namespace Xna {
+	namespace {
+		void writeUInt32(std::ostream& stream, uint32_t value) {
+			char bytes[4] = { static_cast<char>(value), static_cast<char>(value >> 8), static_cast<char>(value >> 16), static_cast<char>(value >> 24) };
+			stream.write(bytes, 4);
+		}
+
+		void writeUInt16(std::ostream& stream, uint16_t value) {
+			char bytes[2] = { static_cast<char>(value), static_cast<char>(value >> 8) };
+			stream.write(bytes, 2);
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	WavSink::WavSink(std::string const& path, int32_t sampleRate) :
+		_stream(path, std::ios::binary | std::ios::trunc), _sampleRate(sampleRate) {
+		if (_stream)
+			writeHeader();
+	}
+
+	WavSink::~WavSink() {
+		Close();
+	}
+}
+
+//Functions
+namespace Xna {
+	bool WavSink::IsOpen() const {
+		return _stream.is_open();
+	}
+
+	size_t WavSink::FramesWritten() const {
+		return _framesWritten;
+	}
+
+	bool WavSink::Write(float const* samples, size_t frameCount) {
+		if (!_stream.is_open())
+			return false;
+
+		auto count = frameCount * Channels;
+
+		if (_buffer.size() < count)
+			_buffer.resize(count);
+
+		ConvertToInt16(samples, _buffer.data(), count);
+		_stream.write(reinterpret_cast<char const*>(_buffer.data()), static_cast<std::streamsize>(count * sizeof(int16_t)));
+		_framesWritten += frameCount;
+
+		return static_cast<bool>(_stream);
+	}
+
+	void WavSink::Close() {
+		if (!_stream.is_open())
+			return;
+
+		_stream.seekp(0);
+		writeHeader();
+		_stream.close();
+	}
+}
+
+//Private
+namespace Xna {
+	void WavSink::writeHeader() {
+		auto blockAlign = static_cast<uint32_t>(Channels) * 2;
+		auto dataSize = static_cast<uint32_t>(_framesWritten * blockAlign);
+
+		_stream.write("RIFF", 4);
+		writeUInt32(_stream, 36 + dataSize);
+		_stream.write("WAVEfmt ", 8);
+		writeUInt32(_stream, 16);
+		writeUInt16(_stream, 1);
+		writeUInt16(_stream, static_cast<uint16_t>(Channels));
+		writeUInt32(_stream, static_cast<uint32_t>(_sampleRate));
+		writeUInt32(_stream, static_cast<uint32_t>(_sampleRate) * blockAlign);
+		writeUInt16(_stream, static_cast<uint16_t>(blockAlign));
+		writeUInt16(_stream, 16);
+		_stream.write("data", 4);
+		writeUInt32(_stream, dataSize);
+	}
+}
@@ -0,0 +1,33 @@
+#ifndef _WAVSINK_HPP_
+#define _WAVSINK_HPP_
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "AudioSink.hpp"
+
+namespace Xna {
+
+	// Writes the mixer's stereo output as a 16-bit PCM RIFF WAVE file. The header sizes are patched by Close(), which the destructor calls.
+	class WavSink : public AudioSink {
+	public:
+		WavSink(std::string const& path, int32_t sampleRate);
+		~WavSink() override;
+
+		bool IsOpen() const;
+		size_t FramesWritten() const;
+
+		bool Write(float const* samples, size_t frameCount) override;
+		void Close();
+
+	private:
+		std::ofstream _stream;
+		std::vector<int16_t> _buffer;
+		int32_t _sampleRate{ 0 };
+		size_t _framesWritten{ 0 };
+
+		void writeHeader();
+	};
+}
+
+#endif
@@ -0,0 +1,50 @@
+#include "BitReader.hpp"
+
+//Constructors
+namespace Xna {
+	BitReader::BitReader(std::vector<uint8_t> const& data) :
+		_data(data.data()), _length(data.size()) {}
+}
+
+//Functions
+namespace Xna {
+	size_t BitReader::Position() const {
+		return _offset * 8 - _scratchBits;
+	}
+
+	bool BitReader::EndOfStream() const {
+		return Position() >= _length * 8;
+	}
+
+	uint32_t BitReader::Read(int32_t bits) {
+		if (bits <= 0)
+			return 0;
+
+		if (_scratchBits < bits)
+			fill();
+
+		auto value = static_cast<uint32_t>(bits < 32 ? _scratch & ((uint64_t{ 1 } << bits) - 1) : _scratch);
+
+		_scratch >>= bits;
+		_scratchBits -= bits;
+
+		return value;
+	}
+
+	bool BitReader::ReadBoolean() {
+		return Read(1) != 0;
+	}
+}
+
+//Private
+namespace Xna {
+	void BitReader::fill() {
+		// Past the end the offset keeps advancing so Position() stays consistent, but only zeros are loaded.
+		while (_scratchBits <= 56) {
+			uint64_t byte = _offset < _length ? _data[_offset] : 0;
+			_scratch |= byte << _scratchBits;
+			_scratchBits += 8;
+			++_offset;
+		}
+	}
+}
@@ -0,0 +1,33 @@
+#ifndef _BITREADER_HPP_
+#define _BITREADER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+
+	// Reads values written by BitWriter. Reading past the end of the buffer returns zero bits.
+	// The buffer must outlive the reader.
+	class BitReader {
+	public:
+		BitReader(std::vector<uint8_t> const& data);
+
+		size_t Position() const;
+		bool EndOfStream() const;
+
+		uint32_t Read(int32_t bits);
+		bool ReadBoolean();
+
+	private:
+		uint8_t const* _data{ nullptr };
+		size_t _length{ 0 };
+		size_t _offset{ 0 };
+		uint64_t _scratch{ 0 };
+		int32_t _scratchBits{ 0 };
+
+		void fill();
+	};
+}
+
+#endif
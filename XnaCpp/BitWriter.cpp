@@ -0,0 +1,57 @@
+#include "BitWriter.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	BitWriter::BitWriter() {}
+}
+
+//Functions
+namespace Xna {
+	size_t BitWriter::BitCount() const {
+		return _data.size() * 8 + _scratchBits;
+	}
+
+	size_t BitWriter::ByteCount() const {
+		return (BitCount() + 7) / 8;
+	}
+
+	void BitWriter::Write(uint32_t value, int32_t bits) {
+		if (bits <= 0)
+			return;
+
+		if (bits < 32)
+			value &= (1u << bits) - 1;
+
+		_scratch |= static_cast<uint64_t>(value) << _scratchBits;
+		_scratchBits += bits;
+
+		if (_scratchBits >= 32) {
+			for (int32_t i = 0; i < 4; ++i)
+				_data.push_back(static_cast<uint8_t>(_scratch >> (i * 8)));
+
+			_scratch >>= 32;
+			_scratchBits -= 32;
+		}
+	}
+
+	void BitWriter::Write(bool value) {
+		Write(value ? 1u : 0u, 1);
+	}
+
+	void BitWriter::Clear() {
+		_data.clear();
+		_scratch = 0;
+		_scratchBits = 0;
+	}
+
+	vector<uint8_t> BitWriter::ToArray() const {
+		auto result = _data;
+
+		for (int32_t i = 0; i < _scratchBits; i += 8)
+			result.push_back(static_cast<uint8_t>(_scratch >> i));
+
+		return result;
+	}
+}
@@ -0,0 +1,30 @@
+#ifndef _BITWRITER_HPP_
+#define _BITWRITER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+
+	// Appends values of up to 32 bits to a byte buffer, least significant bit first.
+	class BitWriter {
+	public:
+		BitWriter();
+
+		size_t BitCount() const;
+		size_t ByteCount() const;
+
+		void Write(uint32_t value, int32_t bits);
+		void Write(bool value);
+		void Clear();
+		std::vector<uint8_t> ToArray() const;
+
+	private:
+		std::vector<uint8_t> _data;
+		uint64_t _scratch{ 0 };
+		int32_t _scratchBits{ 0 };
+	};
+}
+
+#endif
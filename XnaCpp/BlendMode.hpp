@@ -0,0 +1,24 @@
+#ifndef _BLENDMODE_HPP_
+#define _BLENDMODE_HPP_
+
+namespace Xna {
+	enum class BlendMode {
+
+		// The source replaces the destination.
+		Opaque,
+
+		// Blending for premultiplied alpha: source + destination * (1 - source alpha). Same as BlendState.AlphaBlend.
+		AlphaBlend,
+
+		// Blending for straight alpha: source * source alpha + destination * (1 - source alpha). Same as BlendState.NonPremultiplied.
+		NonPremultiplied,
+
+		// The source is weighted by its alpha and added to the destination. Same as BlendState.Additive.
+		Additive,
+
+		// The source is modulated by the destination.
+		Multiply
+	};
+}
+
+#endif
@@ -2,6 +2,9 @@
 #include "BoundingBox.hpp"
 #include "BoundingSphere.hpp"
 #include "Ray.hpp"
+#include "Profiler.hpp"
+#include "SimdDispatch.hpp"
+#include "Vector3A.hpp"
 
 using std::vector;
 
@@ -83,7 +86,7 @@ namespace Xna {
         return _matrix;
     }
 
-    void BoundingFrustum::SetMatrix(Matrix value) {
+    void BoundingFrustum::SetMatrix(Matrix const& value) {
         _matrix = value;
         CreatePlanes();
         CreateCorners();
@@ -114,6 +117,7 @@ namespace Xna {
     }    
 
     ContainmentType BoundingFrustum::Contains(BoundingBox const& box) const {
+        XNA_PROFILE_ZONE("BoundingFrustum::Contains");
 
         bool intersects = false;
 
@@ -158,6 +162,8 @@ namespace Xna {
     }
 
     ContainmentType BoundingFrustum::Contains(BoundingSphere const& sphere) const {
+        XNA_PROFILE_ZONE("BoundingFrustum::Contains");
+
         bool intersects = false;
 
         for (size_t i = 0; i < PlaneCount; ++i)
@@ -177,6 +183,24 @@ namespace Xna {
         return intersects ? ContainmentType::Intersects : ContainmentType::Contains;
     }
 
+    void BoundingFrustum::Contains(AlignedVector<Vector3A> const& spheres, size_t sourceIndex, vector<ContainmentType>& results,
+        size_t destinationIndex, size_t length) const {
+        XNA_PROFILE_ZONE("BoundingFrustum::Contains");
+
+        if (sourceIndex > spheres.size() || length > spheres.size() - sourceIndex
+            || destinationIndex > results.size() || length > results.size() - destinationIndex)
+            return;
+
+        if (length == 0)
+            return;
+
+        Simd::Dispatch::Active().ContainsSpheres(_planes.data(), spheres.data() + sourceIndex, results.data() + destinationIndex, length);
+    }
+
+    void BoundingFrustum::Contains(AlignedVector<Vector3A> const& spheres, vector<ContainmentType>& results) const {
+        Contains(spheres, 0, results, 0, results.size());
+    }
+
     ContainmentType BoundingFrustum::Contains(Vector3 const& point) const {
         for (size_t i = 0; i < PlaneCount; ++i)
         {
@@ -9,12 +9,14 @@
 #include "PlaneIntersectionType.hpp"
 #include "CSharp/Nullable.hpp"
 #include "Plane.hpp"
+#include "Aligned.hpp"
 
 namespace Xna {
 
 	struct BoundingBox;
 	struct BoundingSphere;
 	struct Ray;
+	struct Vector3A;
 
 	class BoundingFrustum {
 	public:
@@ -27,7 +29,7 @@ namespace Xna {
 		friend bool operator !=(BoundingFrustum const& a, BoundingFrustum const& b);
 
 		Matrix GetMatrix() const;
-		void SetMatrix(Matrix value);
+		void SetMatrix(Matrix const& value);
 		Plane Near() const;
 		Plane Far() const;
 		Plane Left() const;
@@ -38,6 +40,10 @@ namespace Xna {
 		ContainmentType Contains(BoundingFrustum const& frustum) const;
 		ContainmentType Contains(BoundingSphere const& sphere) const;
 		ContainmentType Contains(Vector3 const& point) const;
+		// Contains(BoundingSphere) for spheres packed as Vector3A centers with the radius in W, four per SIMD step.
+		void Contains(AlignedVector<Vector3A> const& spheres, size_t sourceIndex, std::vector<ContainmentType>& results,
+			size_t destinationIndex, size_t length) const;
+		void Contains(AlignedVector<Vector3A> const& spheres, std::vector<ContainmentType>& results) const;
 		bool Equals(BoundingFrustum const& other) const;
 		std::vector<Vector3> GetCorners() const;
 		void GetCorners(std::vector<Vector3>& corners) const;
@@ -5,11 +5,13 @@
 #include "Plane.hpp"
 #include "Ray.hpp"
 #include "Matrix.hpp"
+#include "VectorExpression.hpp"
 
 using std::numeric_limits;
 using std::max;
 using CSharp::Nullable;
 using CSharp::csnull;
+using Xna::Expressions::Lazy;
 
 namespace Xna {
 	BoundingSphere::BoundingSphere() {}
@@ -103,9 +105,7 @@ namespace Xna {
 
 			if (sqDist > sqRadius) {
 				auto distance = sqrtf(sqDist);
-				auto direction = diff / distance;
-				auto G = center - radius * direction;
-				center = (G + pt) / 2;
+				center = (Lazy(center) - radius * (Lazy(diff) / distance) + pt) / 2.0f;
 				radius = Vector3::Distance(pt, center);
 				sqRadius = radius * radius;
 			}
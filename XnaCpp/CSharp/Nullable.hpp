@@ -1,43 +1,102 @@
 #ifndef _NULLABLE_HPP_
 #define _NULLABLE_HPP_
 
+#include <limits>
+#include <optional>
+
 namespace CSharp {	
 
+	// The C# null literal; converts to any Nullable<T>.
 	struct CSNullable {
-		CSNullable() = default;
+		constexpr CSNullable() = default;
 
-		bool HasValue() const {
-			return _hasValue;
+		constexpr bool HasValue() const {
+			return false;
 		}
-
-	protected:
-		bool _hasValue{ false };	
 	};
 
-	static const CSNullable csnull = CSNullable();	
+	inline constexpr CSNullable csnull = CSNullable();
 
+	// Trivially copyable whenever T is, and convertible to and from std::optional<T>.
 	template <typename T> 
-	struct Nullable : CSNullable {
-		Nullable() = default;
+	struct Nullable {
+		constexpr Nullable() = default;
 
-		Nullable(CSNullable nullable) {}
+		constexpr Nullable(CSNullable) {}
 
-		Nullable(T value) :
-			_value(value) {
-			_hasValue = true;
-		}
+		constexpr Nullable(std::nullopt_t) {}
 
-		bool HasValue() const {
+		constexpr Nullable(T value) :
+			_value(value), _hasValue(true) {}
+
+		constexpr Nullable(std::optional<T> const& value) :
+			_value(value.value_or(T())), _hasValue(value.has_value()) {}
+
+		constexpr bool HasValue() const {
 			return _hasValue;
 		}
 
-		T Value() const {
+		constexpr T Value() const {
 			return _value;
 		}
 
+		constexpr T GetValueOrDefault() const {
+			return _hasValue ? _value : T();
+		}
+
+		constexpr T GetValueOrDefault(T defaultValue) const {
+			return _hasValue ? _value : defaultValue;
+		}
+
+		constexpr operator std::optional<T>() const {
+			return _hasValue ? std::optional<T>(_value) : std::nullopt;
+		}
+
+	private:
+		T _value{};
+		bool _hasValue{ false };
+	};
+
+	// A single float with NaN meaning null, so it travels in a register and an array of them is a float array the
+	// batch intersection kernels write directly. Value() of a null is NaN, so comparisons on it are false like C#'s
+	// lifted operators. Assigning NaN yields null.
+	template <>
+	struct Nullable<float> {
+		constexpr Nullable() = default;
+
+		constexpr Nullable(CSNullable) {}
+
+		constexpr Nullable(std::nullopt_t) {}
+
+		constexpr Nullable(float value) :
+			_value(value) {}
+
+		constexpr Nullable(std::optional<float> const& value) :
+			_value(value.value_or(std::numeric_limits<float>::quiet_NaN())) {}
+
+		constexpr bool HasValue() const {
+			return _value == _value;
+		}
+
+		constexpr float Value() const {
+			return _value;
+		}
+
+		constexpr float GetValueOrDefault() const {
+			return HasValue() ? _value : 0.0f;
+		}
+
+		constexpr float GetValueOrDefault(float defaultValue) const {
+			return HasValue() ? _value : defaultValue;
+		}
+
+		constexpr operator std::optional<float>() const {
+			return HasValue() ? std::optional<float>(_value) : std::nullopt;
+		}
+
 	private:
-		T _value;
+		float _value{ std::numeric_limits<float>::quiet_NaN() };
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
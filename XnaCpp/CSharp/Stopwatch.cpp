@@ -0,0 +1,72 @@
+#include <chrono>
+#include "Stopwatch.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+namespace CSharp {
+	const int64_t Stopwatch::Frequency = Clock::period::den / Clock::period::num;
+	const bool Stopwatch::IsHighResolution = Clock::period::den / Clock::period::num >= TimeSpan::TicksPerSecond;
+
+	//----- Constructors -----
+
+	Stopwatch::Stopwatch() {}
+
+	//----- Static -----
+
+	Stopwatch Stopwatch::StartNew() {
+		Stopwatch stopwatch;
+		stopwatch.Start();
+		return stopwatch;
+	}
+
+	int64_t Stopwatch::GetTimestamp() {
+		return Clock::now().time_since_epoch().count();
+	}
+
+	//----- Functions -----
+
+	TimeSpan Stopwatch::Elapsed() const {
+		// Timestamps are in clock periods; TimeSpan ticks are 100 ns.
+		auto duration = Clock::duration(ElapsedTicks());
+		return TimeSpan(std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, TimeSpan::TicksPerSecond>>>(duration).count());
+	}
+
+	int64_t Stopwatch::ElapsedMilliseconds() const {
+		return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::duration(ElapsedTicks())).count();
+	}
+
+	int64_t Stopwatch::ElapsedTicks() const {
+		return _isRunning ? _elapsed + (GetTimestamp() - _startTimestamp) : _elapsed;
+	}
+
+	bool Stopwatch::IsRunning() const {
+		return _isRunning;
+	}
+
+	void Stopwatch::Reset() {
+		_elapsed = 0;
+		_isRunning = false;
+	}
+
+	void Stopwatch::Restart() {
+		_elapsed = 0;
+		_startTimestamp = GetTimestamp();
+		_isRunning = true;
+	}
+
+	void Stopwatch::Start() {
+		if (_isRunning)
+			return;
+
+		_startTimestamp = GetTimestamp();
+		_isRunning = true;
+	}
+
+	void Stopwatch::Stop() {
+		if (!_isRunning)
+			return;
+
+		_elapsed += GetTimestamp() - _startTimestamp;
+		_isRunning = false;
+	}
+}
@@ -0,0 +1,36 @@
+#ifndef _STOPWATCH_HPP_
+#define _STOPWATCH_HPP_
+
+#include <stdint.h>
+#include "TimeSpan.hpp"
+
+namespace CSharp {
+	// Measures elapsed time with the monotonic steady clock.
+	class Stopwatch {
+	public:
+		static const int64_t Frequency;
+		static const bool IsHighResolution;
+
+		Stopwatch();
+
+		static Stopwatch StartNew();
+		static int64_t GetTimestamp();
+
+		TimeSpan Elapsed() const;
+		int64_t ElapsedMilliseconds() const;
+		int64_t ElapsedTicks() const;
+		bool IsRunning() const;
+
+		void Reset();
+		void Restart();
+		void Start();
+		void Stop();
+
+	private:
+		int64_t _elapsed{ 0 };
+		int64_t _startTimestamp{ 0 };
+		bool _isRunning{ false };
+	};
+}
+
+#endif
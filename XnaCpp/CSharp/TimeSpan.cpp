@@ -22,12 +22,12 @@ namespace CSharp {
 		_ticks(DayToTicks(days, hours, minutes, seconds, milliseconds)) {}
 
 	//----- Operators -----
-	TimeSpan TimeSpan::operator- (TimeSpan const& t) {
-		return TimeSpan(-t._ticks);
+	TimeSpan TimeSpan::operator- () const {
+		return Negate();
 	}
 
-	TimeSpan TimeSpan::operator+ (TimeSpan const& t) {
-		return t;
+	TimeSpan TimeSpan::operator+ () const {
+		return *this;
 	}
 
 	TimeSpan operator+ (TimeSpan const& t1, TimeSpan const& t2) {
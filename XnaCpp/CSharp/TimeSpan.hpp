@@ -21,8 +21,8 @@ namespace CSharp {
 		TimeSpan(int32_t days, int32_t hours, int32_t minutes, int32_t seconds);
 		TimeSpan(int32_t days, int32_t hours, int32_t minutes, int32_t seconds, int32_t milliseconds);
 
-		TimeSpan operator -(TimeSpan const& t);
-		TimeSpan operator +(TimeSpan const& t);
+		TimeSpan operator -() const;
+		TimeSpan operator +() const;
 		friend TimeSpan operator +(TimeSpan const& t1, TimeSpan const& t2);
 		friend TimeSpan operator -(TimeSpan const& t1, TimeSpan const& t2);
 		friend bool operator ==(TimeSpan const& t1, TimeSpan const& t2);
@@ -0,0 +1,305 @@
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include "ColorSpace.hpp"
+#include "Color.hpp"
+#include "MathHelper.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+#include "Simd.hpp"
+#include "SimdDispatch.hpp"
+
+using std::array;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		array<float, 256> createDecodeTable() {
+			array<float, 256> table{};
+
+			for (size_t i = 0; i < table.size(); ++i)
+				table[i] = ColorSpace::SrgbToLinearExact(static_cast<float>(i) / 255.0F);
+
+			return table;
+		}
+
+		const array<float, 256> decodeTable = createDecodeTable();
+
+		// Polynomial fit of ((s + 0.055) / 1.055)^2.4 over the curved segment.
+		inline float fastDecode(float value) {
+			value = MathHelper::Clamp(value, 0.0F, 1.0F);
+
+			if (value <= 0.04045F)
+				return value * (1.0F / 12.92F);
+
+			return value * (value * (value * 0.305306011F + 0.682171111F) + 0.012522878F);
+		}
+
+		// Weighted sum of x^(1/2), x^(1/4) and x^(1/8) fitted to 1.055 * x^(1/2.4) - 0.055.
+		inline float fastEncode(float value) {
+			value = MathHelper::Clamp(value, 0.0F, 1.0F);
+
+			if (value <= 0.0031308F)
+				return value * 12.92F;
+
+			auto s1 = std::sqrt(value);
+			auto s2 = std::sqrt(s1);
+			auto s3 = std::sqrt(s2);
+
+			return 0.662002687F * s1 + 0.684122060F * s2 - 0.323583601F * s3 - 0.0225411470F * value;
+		}
+
+		inline uint32_t toByte(float value) {
+			return static_cast<uint32_t>(MathHelper::Clamp(value, 0.0F, 1.0F) * 255.0F + 0.5F);
+		}
+
+#if XNA_SSE2
+		inline __m128 select(__m128 mask, __m128 a, __m128 b) {
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+
+		inline __m128 fastDecode(__m128 value) {
+			value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0F));
+
+			auto low = _mm_mul_ps(value, _mm_set1_ps(1.0F / 12.92F));
+			auto high = _mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(0.305306011F)), _mm_set1_ps(0.682171111F));
+			high = _mm_add_ps(_mm_mul_ps(value, high), _mm_set1_ps(0.012522878F));
+			high = _mm_mul_ps(value, high);
+
+			return select(_mm_cmple_ps(value, _mm_set1_ps(0.04045F)), low, high);
+		}
+
+		inline __m128 fastEncode(__m128 value) {
+			value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0F));
+
+			auto s1 = _mm_sqrt_ps(value);
+			auto s2 = _mm_sqrt_ps(s1);
+			auto s3 = _mm_sqrt_ps(s2);
+
+			auto low = _mm_mul_ps(value, _mm_set1_ps(12.92F));
+			auto high = _mm_mul_ps(s1, _mm_set1_ps(0.662002687F));
+			high = _mm_add_ps(high, _mm_mul_ps(s2, _mm_set1_ps(0.684122060F)));
+			high = _mm_sub_ps(high, _mm_mul_ps(s3, _mm_set1_ps(0.323583601F)));
+			high = _mm_sub_ps(high, _mm_mul_ps(value, _mm_set1_ps(0.0225411470F)));
+
+			return select(_mm_cmple_ps(value, _mm_set1_ps(0.0031308F)), low, high);
+		}
+
+		inline __m128 alphaMask() {
+			return _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+		}
+#endif
+
+		void decodeFloats(float const* source, float* destination, size_t count) {
+			Simd::Dispatch::Active().SrgbToLinear(source, destination, count);
+		}
+
+		void encodeFloats(float const* source, float* destination, size_t count) {
+			Simd::Dispatch::Active().LinearToSrgb(source, destination, count);
+		}
+	}
+}
+
+//Static
+namespace Xna {
+	float ColorSpace::SrgbToLinearExact(float value) {
+		if (value <= 0.04045F)
+			return value / 12.92F;
+
+		return static_cast<float>(std::pow((value + 0.055) / 1.055, 2.4));
+	}
+
+	float ColorSpace::LinearToSrgbExact(float value) {
+		if (value <= 0.0031308F)
+			return value * 12.92F;
+
+		return static_cast<float>(1.055 * std::pow(static_cast<double>(value), 1.0 / 2.4) - 0.055);
+	}
+
+	float ColorSpace::SrgbToLinear(uint8_t value) {
+		return decodeTable[value];
+	}
+
+	float ColorSpace::SrgbToLinear(float value) {
+		return fastDecode(value);
+	}
+
+	float ColorSpace::LinearToSrgb(float value) {
+		return fastEncode(value);
+	}
+
+	Vector3 ColorSpace::SrgbToLinear(Vector3 const& value) {
+		return Vector3(fastDecode(value.X), fastDecode(value.Y), fastDecode(value.Z));
+	}
+
+	Vector4 ColorSpace::SrgbToLinear(Vector4 const& value) {
+		return Vector4(fastDecode(value.X), fastDecode(value.Y), fastDecode(value.Z), value.W);
+	}
+
+	Vector4 ColorSpace::SrgbToLinear(Color const& color) {
+		return Vector4(
+			decodeTable[color.R()],
+			decodeTable[color.G()],
+			decodeTable[color.B()],
+			color.A() / 255.0F);
+	}
+
+	Vector3 ColorSpace::LinearToSrgb(Vector3 const& value) {
+		return Vector3(fastEncode(value.X), fastEncode(value.Y), fastEncode(value.Z));
+	}
+
+	Vector4 ColorSpace::LinearToSrgb(Vector4 const& value) {
+		return Vector4(fastEncode(value.X), fastEncode(value.Y), fastEncode(value.Z), value.W);
+	}
+
+	Color ColorSpace::ToSrgbColor(Vector3 const& value) {
+		return ToSrgbColor(Vector4(value, 1.0F));
+	}
+
+	Color ColorSpace::ToSrgbColor(Vector4 const& value) {
+		return Color(
+			(toByte(value.W) << 24)
+			| (toByte(fastEncode(value.Z)) << 16)
+			| (toByte(fastEncode(value.Y)) << 8)
+			| toByte(fastEncode(value.X)));
+	}
+
+	void ColorSpace::SrgbToLinear(vector<Color> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = SrgbToLinear(sourceArray[sourceIndex + i]);
+	}
+
+	void ColorSpace::SrgbToLinear(vector<Color> const& sourceArray, vector<Vector4>& destinationArray) {
+		SrgbToLinear(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void ColorSpace::SrgbToLinear(vector<Vector3> const& sourceArray, size_t sourceIndex,
+		vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) {
+
+		if (length == 0)
+			return;
+
+		decodeFloats(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex].X, length * 3);
+	}
+
+	void ColorSpace::SrgbToLinear(vector<Vector3> const& sourceArray, vector<Vector3>& destinationArray) {
+		SrgbToLinear(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void ColorSpace::SrgbToLinear(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+
+#if XNA_SSE2
+		auto mask = alphaMask();
+
+		for (size_t i = 0; i < length; ++i) {
+			auto value = _mm_loadu_ps(&sourceArray[sourceIndex + i].X);
+			_mm_storeu_ps(&destinationArray[destinationIndex + i].X, select(mask, value, fastDecode(value)));
+		}
+#else
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = SrgbToLinear(sourceArray[sourceIndex + i]);
+#endif
+	}
+
+	void ColorSpace::SrgbToLinear(vector<Vector4> const& sourceArray, vector<Vector4>& destinationArray) {
+		SrgbToLinear(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void ColorSpace::LinearToSrgb(vector<Vector3> const& sourceArray, size_t sourceIndex,
+		vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) {
+
+		if (length == 0)
+			return;
+
+		encodeFloats(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex].X, length * 3);
+	}
+
+	void ColorSpace::LinearToSrgb(vector<Vector3> const& sourceArray, vector<Vector3>& destinationArray) {
+		LinearToSrgb(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void ColorSpace::LinearToSrgb(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+
+#if XNA_SSE2
+		auto mask = alphaMask();
+
+		for (size_t i = 0; i < length; ++i) {
+			auto value = _mm_loadu_ps(&sourceArray[sourceIndex + i].X);
+			_mm_storeu_ps(&destinationArray[destinationIndex + i].X, select(mask, value, fastEncode(value)));
+		}
+#else
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = LinearToSrgb(sourceArray[sourceIndex + i]);
+#endif
+	}
+
+	void ColorSpace::LinearToSrgb(vector<Vector4> const& sourceArray, vector<Vector4>& destinationArray) {
+		LinearToSrgb(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void ColorSpace::ToSrgbColor(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Color>& destinationArray, size_t destinationIndex, size_t length) {
+
+#if XNA_SSE2
+		auto mask = alphaMask();
+		auto zero = _mm_setzero_ps();
+		auto one = _mm_set1_ps(1.0F);
+		auto scale = _mm_set1_ps(255.0F);
+		auto half = _mm_set1_ps(0.5F);
+
+		for (size_t i = 0; i < length; ++i) {
+			auto value = _mm_loadu_ps(&sourceArray[sourceIndex + i].X);
+			value = select(mask, _mm_min_ps(_mm_max_ps(value, zero), one), fastEncode(value));
+
+			auto bytes = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), half));
+			bytes = _mm_packs_epi32(bytes, bytes);
+			bytes = _mm_packus_epi16(bytes, bytes);
+
+			destinationArray[destinationIndex + i] = Color(static_cast<uint32_t>(_mm_cvtsi128_si32(bytes)));
+		}
+#else
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = ToSrgbColor(sourceArray[sourceIndex + i]);
+#endif
+	}
+
+	void ColorSpace::ToSrgbColor(vector<Vector4> const& sourceArray, vector<Color>& destinationArray) {
+		ToSrgbColor(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	SrgbErrorReport ColorSpace::MaxError(size_t samples) {
+		SrgbErrorReport report;
+
+		for (size_t i = 0; i < decodeTable.size(); ++i) {
+			auto exact = std::pow((i / 255.0 + 0.055) / 1.055, 2.4);
+			if (i / 255.0 <= 0.04045)
+				exact = i / 255.0 / 12.92;
+
+			report.MaxTableError = MathHelper::Max(report.MaxTableError, static_cast<float>(std::abs(decodeTable[i] - exact)));
+		}
+
+		if (samples == 0)
+			return report;
+
+		for (size_t i = 0; i <= samples; ++i) {
+			auto value = static_cast<float>(i) / static_cast<float>(samples);
+
+			auto decoded = SrgbToLinearExact(value);
+			auto encoded = LinearToSrgbExact(value);
+			auto fastEncoded = fastEncode(value);
+
+			report.MaxDecodeError = MathHelper::Max(report.MaxDecodeError, std::abs(fastDecode(value) - decoded));
+			report.MaxEncodeError = MathHelper::Max(report.MaxEncodeError, std::abs(fastEncoded - encoded));
+
+			auto byteError = std::abs(static_cast<int32_t>(toByte(fastEncoded)) - static_cast<int32_t>(toByte(encoded)));
+			report.MaxEncodeByteError = MathHelper::Max(report.MaxEncodeByteError, byteError);
+		}
+
+		return report;
+	}
+}
@@ -0,0 +1,63 @@
+#ifndef _COLORSPACE_HPP_
+#define _COLORSPACE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+
+	struct Color;
+	struct Vector3;
+	struct Vector4;
+
+	// Maximum absolute error of the fast conversions against the exact sRGB transfer functions.
+	struct SrgbErrorReport {
+		float MaxTableError{ 0 };
+		float MaxDecodeError{ 0 };
+		float MaxEncodeError{ 0 };
+		int32_t MaxEncodeByteError{ 0 };
+	};
+
+	// Conversions between gamma-encoded sRGB and linear values.
+	// Alpha is always linear and is copied unchanged.
+	class ColorSpace {
+	public:
+		static float SrgbToLinearExact(float value);
+		static float LinearToSrgbExact(float value);
+
+		static float SrgbToLinear(uint8_t value);
+		static float SrgbToLinear(float value);
+		static float LinearToSrgb(float value);
+		static Vector3 SrgbToLinear(Vector3 const& value);
+		static Vector4 SrgbToLinear(Vector4 const& value);
+		static Vector4 SrgbToLinear(Color const& color);
+		static Vector3 LinearToSrgb(Vector3 const& value);
+		static Vector4 LinearToSrgb(Vector4 const& value);
+		static Color ToSrgbColor(Vector3 const& value);
+		static Color ToSrgbColor(Vector4 const& value);
+
+		static void SrgbToLinear(std::vector<Color> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void SrgbToLinear(std::vector<Color> const& sourceArray, std::vector<Vector4>& destinationArray);
+		static void SrgbToLinear(std::vector<Vector3> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length);
+		static void SrgbToLinear(std::vector<Vector3> const& sourceArray, std::vector<Vector3>& destinationArray);
+		static void SrgbToLinear(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void SrgbToLinear(std::vector<Vector4> const& sourceArray, std::vector<Vector4>& destinationArray);
+		static void LinearToSrgb(std::vector<Vector3> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length);
+		static void LinearToSrgb(std::vector<Vector3> const& sourceArray, std::vector<Vector3>& destinationArray);
+		static void LinearToSrgb(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void LinearToSrgb(std::vector<Vector4> const& sourceArray, std::vector<Vector4>& destinationArray);
+		static void ToSrgbColor(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Color>& destinationArray, size_t destinationIndex, size_t length);
+		static void ToSrgbColor(std::vector<Vector4> const& sourceArray, std::vector<Color>& destinationArray);
+
+		static SrgbErrorReport MaxError(size_t samples = 65536);
+	};
+}
+
+#endif
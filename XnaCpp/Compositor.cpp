@@ -0,0 +1,268 @@
+#include <cstring>
+#include "Compositor.hpp"
+#include "Color.hpp"
+#include "MathHelper.hpp"
+#include "Parallel.hpp"
+#include "Point.hpp"
+#include "PixelMath.hpp"
+#include "Rectangle.hpp"
+#include "Simd.hpp"
+#include "Profiler.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		using Detail::packed;
+		using Detail::mul255;
+
+		inline uint32_t saturate(uint32_t value) {
+			return value > 255 ? 255 : value;
+		}
+
+		template <BlendMode Mode>
+		inline uint32_t blendChannel(uint32_t s, uint32_t d, uint32_t sa) {
+			switch (Mode) {
+			case BlendMode::Opaque:
+				return s;
+			case BlendMode::AlphaBlend:
+				return saturate(s + mul255(d, 255 - sa));
+			case BlendMode::NonPremultiplied:
+				return saturate(mul255(s, sa) + mul255(d, 255 - sa));
+			case BlendMode::Additive:
+				return saturate(mul255(s, sa) + d);
+			case BlendMode::Multiply:
+				return mul255(s, d);
+			}
+
+			return s;
+		}
+
+		template <BlendMode Mode>
+		inline uint32_t blendPixel(uint32_t source, uint32_t destination) {
+			auto sa = source >> 24;
+			uint32_t result = 0;
+
+			for (uint32_t shift = 0; shift < 32; shift += 8) {
+				auto channel = blendChannel<Mode>((source >> shift) & 0xFF, (destination >> shift) & 0xFF, sa);
+				result |= channel << shift;
+			}
+
+			return result;
+		}
+
+#if XNA_SSE2
+		inline __m128i mul255(__m128i a, __m128i b) {
+			auto t = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+			return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+		}
+
+		inline __m128i broadcastAlpha(__m128i value) {
+			return _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, 0xFF), 0xFF);
+		}
+
+		// Operates on two pixels widened to 16-bit lanes; sums never exceed 510 and saturate on packing.
+		template <BlendMode Mode>
+		inline __m128i blendWide(__m128i s, __m128i d) {
+			auto full = _mm_set1_epi16(255);
+
+			switch (Mode) {
+			case BlendMode::Opaque:
+				return s;
+			case BlendMode::AlphaBlend:
+				return _mm_add_epi16(s, mul255(d, _mm_sub_epi16(full, broadcastAlpha(s))));
+			case BlendMode::NonPremultiplied: {
+				auto sa = broadcastAlpha(s);
+				return _mm_add_epi16(mul255(s, sa), mul255(d, _mm_sub_epi16(full, sa)));
+			}
+			case BlendMode::Additive:
+				return _mm_add_epi16(mul255(s, broadcastAlpha(s)), d);
+			case BlendMode::Multiply:
+				return mul255(s, d);
+			}
+
+			return s;
+		}
+#endif
+
+		template <BlendMode Mode>
+		void blendRow(Color const* source, Color* destination, size_t count) {
+			size_t i = 0;
+#if XNA_SSE2
+			auto zero = _mm_setzero_si128();
+
+			for (; i + 4 <= count; i += 4) {
+				auto s = _mm_loadu_si128(reinterpret_cast<__m128i const*>(source + i));
+				auto d = _mm_loadu_si128(reinterpret_cast<__m128i const*>(destination + i));
+
+				auto low = blendWide<Mode>(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+				auto high = blendWide<Mode>(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+			}
+#endif
+			for (; i < count; ++i)
+				destination[i] = Color(blendPixel<Mode>(packed(source[i]), packed(destination[i])));
+		}
+
+		void blendRow(BlendMode mode, Color const* source, Color* destination, size_t count) {
+			switch (mode) {
+			case BlendMode::Opaque:
+				std::memcpy(destination, source, count * sizeof(Color));
+				break;
+			case BlendMode::AlphaBlend:
+				blendRow<BlendMode::AlphaBlend>(source, destination, count);
+				break;
+			case BlendMode::NonPremultiplied:
+				blendRow<BlendMode::NonPremultiplied>(source, destination, count);
+				break;
+			case BlendMode::Additive:
+				blendRow<BlendMode::Additive>(source, destination, count);
+				break;
+			case BlendMode::Multiply:
+				blendRow<BlendMode::Multiply>(source, destination, count);
+				break;
+			}
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	Compositor::Compositor() {}
+
+	Compositor::Compositor(BlendMode mode) :
+		_mode(mode) {}
+}
+
+//Static
+namespace Xna {
+	Color Compositor::Blend(Color const& source, Color const& destination, BlendMode mode) {
+		Color result = destination;
+		blendRow(mode, &source, &result, 1);
+		return result;
+	}
+
+	void Compositor::Blend(Color const* source, Color* destination, size_t count, BlendMode mode) {
+		blendRow(mode, source, destination, count);
+	}
+}
+
+//Functions
+namespace Xna {
+	BlendMode Compositor::Mode() const {
+		return _mode;
+	}
+
+	void Compositor::Mode(BlendMode value) {
+		_mode = value;
+	}
+
+	int32_t Compositor::TileSize() const {
+		return _tileSize;
+	}
+
+	void Compositor::TileSize(int32_t value) {
+		_tileSize = MathHelper::Max(value, 1);
+	}
+
+	size_t Compositor::ThreadCount() const {
+		return _threadCount;
+	}
+
+	void Compositor::ThreadCount(size_t value) {
+		_threadCount = value;
+	}
+
+	void Compositor::Blend(vector<Color> const& source, vector<Color>& destination) const {
+		XNA_PROFILE_ZONE("Compositor::Blend");
+
+		auto count = source.size() < destination.size() ? source.size() : destination.size();
+		auto chunk = static_cast<size_t>(_tileSize) * static_cast<size_t>(_tileSize);
+		auto chunks = (count + chunk - 1) / chunk;
+
+		Parallel::For(0, chunks, _threadCount, [&](size_t index) {
+			auto offset = index * chunk;
+			auto length = count - offset < chunk ? count - offset : chunk;
+			blendRow(_mode, source.data() + offset, destination.data() + offset, length);
+			});
+	}
+
+	void Compositor::Blend(vector<Color> const& source, int32_t sourceWidth, Rectangle const& sourceRectangle,
+		vector<Color>& destination, int32_t destinationWidth, Point const& destinationPosition) const {
+
+		if (sourceWidth <= 0 || destinationWidth <= 0)
+			return;
+
+		auto sourceBounds = Rectangle(0, 0, sourceWidth, static_cast<int32_t>(source.size() / sourceWidth));
+		auto destinationBounds = Rectangle(0, 0, destinationWidth, static_cast<int32_t>(destination.size() / destinationWidth));
+
+		auto clippedSource = Rectangle::Intersect(sourceRectangle, sourceBounds);
+
+		auto target = Rectangle(
+			destinationPosition.X + clippedSource.X - sourceRectangle.X,
+			destinationPosition.Y + clippedSource.Y - sourceRectangle.Y,
+			clippedSource.Width,
+			clippedSource.Height);
+
+		auto clippedTarget = Rectangle::Intersect(target, destinationBounds);
+
+		if (clippedTarget.IsEmpty() || clippedTarget.Width <= 0 || clippedTarget.Height <= 0)
+			return;
+
+		auto sourceX = clippedSource.X + clippedTarget.X - target.X;
+		auto sourceY = clippedSource.Y + clippedTarget.Y - target.Y;
+
+		blendRegion(
+			source.data() + static_cast<size_t>(sourceY) * sourceWidth + sourceX, static_cast<size_t>(sourceWidth),
+			destination.data() + static_cast<size_t>(clippedTarget.Y) * destinationWidth + clippedTarget.X, static_cast<size_t>(destinationWidth),
+			clippedTarget.Width, clippedTarget.Height);
+	}
+
+	void Compositor::Fill(Color const& color, vector<Color>& destination, int32_t destinationWidth, Rectangle const& rectangle) const {
+		if (destinationWidth <= 0)
+			return;
+
+		auto destinationBounds = Rectangle(0, 0, destinationWidth, static_cast<int32_t>(destination.size() / destinationWidth));
+		auto clipped = Rectangle::Intersect(rectangle, destinationBounds);
+
+		if (clipped.Width <= 0 || clipped.Height <= 0)
+			return;
+
+		// Every row reads the same run of source pixels.
+		vector<Color> row(static_cast<size_t>(clipped.Width), color);
+
+		blendRegion(
+			row.data(), 0,
+			destination.data() + static_cast<size_t>(clipped.Y) * destinationWidth + clipped.X, static_cast<size_t>(destinationWidth),
+			clipped.Width, clipped.Height);
+	}
+}
+
+//Private
+namespace Xna {
+	void Compositor::blendRegion(Color const* source, size_t sourceStride,
+		Color* destination, size_t destinationStride, int32_t width, int32_t height) const {
+		XNA_PROFILE_ZONE("Compositor::blendRegion");
+
+		auto tile = _tileSize;
+		auto bands = static_cast<size_t>((height + tile - 1) / tile);
+
+		Parallel::For(0, bands, _threadCount, [&](size_t band) {
+			auto top = static_cast<int32_t>(band) * tile;
+			auto bottom = MathHelper::Min(top + tile, height);
+
+			for (int32_t left = 0; left < width; left += tile) {
+				auto count = static_cast<size_t>(MathHelper::Min(tile, width - left));
+
+				for (int32_t y = top; y < bottom; ++y) {
+					blendRow(_mode,
+						source + y * sourceStride + left,
+						destination + y * destinationStride + left,
+						count);
+				}
+			}
+			});
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef _COMPOSITOR_HPP_
+#define _COMPOSITOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BlendMode.hpp"
+
+namespace Xna {
+
+	struct Color;
+	struct Point;
+	struct Rectangle;
+
+	// Blends Color buffers on the CPU. Buffers are row-major with the given width in pixels;
+	// work is split into tiles of TileSize() pixels and row bands of tiles may run on several threads.
+	class Compositor {
+	public:
+		static constexpr int32_t DefaultTileSize = 64;
+
+		Compositor();
+		Compositor(BlendMode mode);
+
+		static Color Blend(Color const& source, Color const& destination, BlendMode mode);
+		static void Blend(Color const* source, Color* destination, size_t count, BlendMode mode);
+
+		BlendMode Mode() const;
+		void Mode(BlendMode value);
+		int32_t TileSize() const;
+		void TileSize(int32_t value);
+		size_t ThreadCount() const;
+		void ThreadCount(size_t value);
+
+		void Blend(std::vector<Color> const& source, std::vector<Color>& destination) const;
+		void Blend(std::vector<Color> const& source, int32_t sourceWidth, Rectangle const& sourceRectangle,
+			std::vector<Color>& destination, int32_t destinationWidth, Point const& destinationPosition) const;
+		void Fill(Color const& color, std::vector<Color>& destination, int32_t destinationWidth, Rectangle const& rectangle) const;
+
+	private:
+		BlendMode _mode{ BlendMode::AlphaBlend };
+		int32_t _tileSize{ DefaultTileSize };
+		size_t _threadCount{ 1 };
+
+		void blendRegion(Color const* source, size_t sourceStride,
+			Color* destination, size_t destinationStride, int32_t width, int32_t height) const;
+	};
+}
+
+#endif
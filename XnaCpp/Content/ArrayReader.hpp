@@ -0,0 +1,75 @@
+#ifndef _ARRAYREADER_HPP_
+#define _ARRAYREADER_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "ContentReader.hpp"
+#include "ContentTypeReader.hpp"
+
+namespace Xna {
+
+	// Port of ArrayReader<T>; produces a std::vector<T>. Blittable value types are copied in one block
+	// straight from the mapped or decompressed XNB data.
+	template <typename T>
+	class ArrayReader : public ContentTypeReader {
+	public:
+		ArrayReader(ContentTypeReaderOf<T> const* elementReader) :
+			_elementReader(elementReader) {}
+
+		std::string ReaderName() const override {
+			return "Microsoft.Xna.Framework.Content.ArrayReader`1[[" + _elementReader->TargetName() + "]]";
+		}
+
+		std::string TargetName() const override {
+			return _elementReader->TargetName() + "[]";
+		}
+
+		std::type_index TargetType() const override {
+			return typeid(std::vector<T>);
+		}
+
+		bool TargetIsValueType() const override {
+			return false;
+		}
+
+		std::shared_ptr<void> Read(ContentReader& input) override {
+			auto count = input.ReadUInt32();
+			auto result = std::make_shared<std::vector<T>>();
+
+			if (_elementReader->TargetIsValueType() && _elementReader->IsBlittable() && std::is_trivially_copyable_v<T>) {
+				if (count > input.Remaining() / sizeof(T)) {
+					input.Fail();
+					return result;
+				}
+
+				result->resize(count);
+				input.ReadBytes(result->data(), count * sizeof(T));
+
+				return result;
+			}
+
+			// Every element takes at least one byte, which bounds the reservation for corrupt counts.
+			result->reserve(count < input.Remaining() ? count : input.Remaining());
+
+			for (uint32_t i = 0; i < count && !input.HasError(); ++i) {
+				if (_elementReader->TargetIsValueType()) {
+					result->push_back(_elementReader->ReadValue(input));
+					continue;
+				}
+
+				auto element = input.template ReadObject<T>();
+				result->push_back(element ? *element : T());
+			}
+
+			return result;
+		}
+
+	private:
+		ContentTypeReaderOf<T> const* _elementReader{ nullptr };
+	};
+}
+
+#endif
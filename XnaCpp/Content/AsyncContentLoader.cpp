@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include "AsyncContentLoader.hpp"
+#include "../Parallel.hpp"
+#include "../Profiler.hpp"
+
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		// Touches one byte per page so the page faults are taken on the I/O thread rather than by a decoder.
+		void prefetch(MemoryMappedFile const& file) {
+			constexpr size_t pageSize = 4096;
+			auto data = file.Data();
+			uint8_t sum = 0;
+
+			for (size_t i = 0; i < file.Size(); i += pageSize)
+				sum ^= static_cast<uint8_t const volatile*>(data)[i];
+
+			(void)sum;
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	AsyncContentLoader::AsyncContentLoader(ContentManager& content, size_t threadCount) :
+		_content(content) {
+		if (threadCount == 0)
+			threadCount = Parallel::ProcessorCount();
+
+		_workers.reserve(threadCount);
+
+		for (size_t i = 0; i < threadCount; ++i)
+			_workers.emplace_back(&AsyncContentLoader::workerLoop, this);
+
+		_ioThread = std::thread(&AsyncContentLoader::ioLoop, this);
+	}
+
+	AsyncContentLoader::~AsyncContentLoader() {
+		vector<shared_ptr<ContentLoadRequest>> queued;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+			queued.swap(_requests);
+		}
+
+		_requestAvailable.notify_all();
+
+		for (auto& request : queued)
+			request->Cancel();
+
+		_ioThread.join();
+
+		// Files the I/O thread already mapped are still decoded so their futures resolve.
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopWorkers = true;
+		}
+
+		_decodeAvailable.notify_all();
+
+		for (auto& worker : _workers)
+			worker.join();
+	}
+}
+
+//Functions
+namespace Xna {
+	shared_ptr<ContentLoadRequest> AsyncContentLoader::LoadAsync(string const& assetName, std::type_index type, int32_t priority,
+		std::function<void(shared_ptr<void> const&)> callback) {
+		return enqueue(assetName, type, priority, std::move(callback));
+	}
+
+	size_t AsyncContentLoader::BatchSize() const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _batchSize;
+	}
+
+	void AsyncContentLoader::BatchSize(size_t value) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		_batchSize = value == 0 ? 1 : value;
+	}
+
+	size_t AsyncContentLoader::ThreadCount() const {
+		return _workers.size();
+	}
+
+	size_t AsyncContentLoader::PendingCount() const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _outstanding;
+	}
+
+	void AsyncContentLoader::CancelAll() {
+		vector<shared_ptr<ContentLoadRequest>> queued;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			queued.swap(_requests);
+		}
+
+		for (auto& request : queued)
+			request->Cancel();
+	}
+
+	void AsyncContentLoader::WaitIdle() {
+		std::unique_lock<std::mutex> lock(_mutex);
+		_idle.wait(lock, [&]() { return _outstanding == 0; });
+	}
+}
+
+//Static
+namespace Xna {
+	ContentLoadBenchmarkResult AsyncContentLoader::Benchmark(string const& rootDirectory,
+		vector<std::pair<string, std::type_index>> const& assets, size_t threadCount) {
+		using Clock = std::chrono::steady_clock;
+
+		ContentLoadBenchmarkResult result;
+		result.AssetCount = assets.size();
+
+		auto evict = [&]() {
+			ContentManager paths(rootDirectory);
+			auto evicted = true;
+
+			for (auto const& asset : assets)
+				evicted = MemoryMappedFile::Evict(paths.assetPath(ContentManager::NormalizeAssetName(asset.first))) && evicted;
+
+			return evicted;
+		};
+
+		result.ColdCache = evict();
+
+		{
+			ContentManager content(rootDirectory);
+			auto start = Clock::now();
+
+			for (auto const& asset : assets) {
+				if (!content.load(asset.first, asset.second))
+					++result.FailedCount;
+			}
+
+			result.SerialMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		}
+
+		result.ColdCache = evict() && result.ColdCache;
+
+		{
+			ContentManager content(rootDirectory);
+			std::atomic<size_t> failed{ 0 };
+			auto start = Clock::now();
+
+			{
+				AsyncContentLoader loader(content, threadCount);
+
+				for (auto const& asset : assets) {
+					loader.LoadAsync(asset.first, asset.second, 0, [&](shared_ptr<void> const& value) {
+						if (!value)
+							failed.fetch_add(1, std::memory_order_relaxed);
+						});
+				}
+
+				loader.WaitIdle();
+			}
+
+			result.ParallelMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			result.FailedCount = std::max(result.FailedCount, failed.load());
+		}
+
+		if (result.ParallelMilliseconds > 0)
+			result.Speedup = result.SerialMilliseconds / result.ParallelMilliseconds;
+
+		return result;
+	}
+}
+
+//Private
+namespace Xna {
+	bool AsyncContentLoader::runsAfter(shared_ptr<ContentLoadRequest> const& a, shared_ptr<ContentLoadRequest> const& b) {
+		// Heap order: higher priority first, then earlier requests.
+		if (a->_priority != b->_priority)
+			return a->_priority < b->_priority;
+
+		return a->_sequence > b->_sequence;
+	}
+
+	bool AsyncContentLoader::decodesAfter(DecodeJob const& a, DecodeJob const& b) {
+		return runsAfter(a.Request, b.Request);
+	}
+
+	shared_ptr<ContentLoadRequest> AsyncContentLoader::enqueue(string const& assetName, std::type_index type, int32_t priority,
+		std::function<void(shared_ptr<void> const&)> complete) {
+		auto onComplete = [this, complete = std::move(complete)](shared_ptr<void> const& asset) {
+			if (complete)
+				complete(asset);
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				--_outstanding;
+			}
+
+			_idle.notify_all();
+		};
+
+		auto name = ContentManager::NormalizeAssetName(assetName);
+		shared_ptr<ContentLoadRequest> request;
+		bool stopping;
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			request = std::make_shared<ContentLoadRequest>(name, type, priority, _sequence++, std::move(onComplete));
+			++_outstanding;
+			stopping = _stopping;
+
+			if (!stopping) {
+				_requests.push_back(request);
+				std::push_heap(_requests.begin(), _requests.end(), runsAfter);
+			}
+		}
+
+		// Too late to load; the future resolves to nullptr.
+		if (stopping)
+			request->Cancel();
+		else
+			_requestAvailable.notify_one();
+
+		return request;
+	}
+
+	void AsyncContentLoader::ioLoop() {
+		vector<shared_ptr<ContentLoadRequest>> batch;
+
+		for (;;) {
+			batch.clear();
+
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_requestAvailable.wait(lock, [&]() { return _stopping || !_requests.empty(); });
+
+				if (_stopping)
+					return;
+
+				while (!_requests.empty() && batch.size() < _batchSize) {
+					std::pop_heap(_requests.begin(), _requests.end(), runsAfter);
+					auto request = std::move(_requests.back());
+					_requests.pop_back();
+
+					// Past this point the request can no longer be canceled.
+					if (request->beginLoading())
+						batch.push_back(std::move(request));
+				}
+			}
+
+			XNA_PROFILE_ZONE("AsyncContentLoader::ioBatch");
+
+			// Neighbouring names tend to be neighbouring files on disk.
+			std::sort(batch.begin(), batch.end(), [](auto const& a, auto const& b) {
+				return a->AssetName() < b->AssetName();
+				});
+
+			for (auto& request : batch) {
+				shared_ptr<void> asset;
+
+				if (_content.findCachedAsset(request->AssetName(), request->_type, asset)) {
+					request->finish(asset ? ContentLoadStatus::Completed : ContentLoadStatus::Failed, asset);
+					continue;
+				}
+
+				auto file = std::make_shared<MemoryMappedFile>(_content.assetPath(request->AssetName()));
+
+				if (!file->IsOpen()) {
+					request->finish(ContentLoadStatus::Failed, nullptr);
+					continue;
+				}
+
+				prefetch(*file);
+
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_decodeJobs.push_back({ request, file });
+					std::push_heap(_decodeJobs.begin(), _decodeJobs.end(), decodesAfter);
+				}
+
+				_decodeAvailable.notify_one();
+			}
+		}
+	}
+
+	void AsyncContentLoader::workerLoop() {
+		for (;;) {
+			DecodeJob job;
+
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_decodeAvailable.wait(lock, [&]() { return _stopWorkers || !_decodeJobs.empty(); });
+
+				if (_decodeJobs.empty())
+					return;
+
+				std::pop_heap(_decodeJobs.begin(), _decodeJobs.end(), decodesAfter);
+				job = std::move(_decodeJobs.back());
+				_decodeJobs.pop_back();
+			}
+
+			XNA_PROFILE_ZONE("AsyncContentLoader::decode");
+
+			auto& request = *job.Request;
+			shared_ptr<void> asset;
+
+			// Type readers may still throw on a damaged file, e.g. bad_alloc for a huge element count; that fails the
+			// request rather than ending the process.
+			try {
+				asset = _content.ReadAsset(request.AssetName(), job.File->Data(), job.File->Size(), request._type);
+			}
+			catch (...) {
+				asset = nullptr;
+			}
+
+			job.File.reset();
+
+			if (asset)
+				asset = _content.cacheAsset(request.AssetName(), asset, request._type);
+
+			request.finish(asset ? ContentLoadStatus::Completed : ContentLoadStatus::Failed, asset);
+		}
+	}
+}
@@ -0,0 +1,128 @@
+#ifndef _ASYNCCONTENTLOADER_HPP_
+#define _ASYNCCONTENTLOADER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include "ContentLoadRequest.hpp"
+#include "ContentManager.hpp"
+#include "MemoryMappedFile.hpp"
+
+namespace Xna {
+
+	template <typename T>
+	struct ContentLoadHandle {
+		std::shared_future<std::shared_ptr<T>> Future;
+		std::shared_ptr<ContentLoadRequest> Request;
+	};
+
+	struct ContentLoadBenchmarkResult {
+		size_t AssetCount{ 0 };
+		size_t FailedCount{ 0 };
+		double SerialMilliseconds{ 0 };
+		double ParallelMilliseconds{ 0 };
+		double Speedup{ 0 };
+		// False when some file could not be dropped from the OS cache before a pass, which may then have run warm.
+		bool ColdCache{ false };
+	};
+
+	// Loads assets of a ContentManager in the background. One I/O thread takes the highest priority requests
+	// in batches, maps their files in name order and faults the pages in; decode workers then decompress and
+	// deserialize them in priority order. Results land in the manager's cache, so each completed load holds a
+	// reference exactly as ContentManager::Load does. Callbacks run on the worker that finished the request,
+	// before its future becomes ready. Higher priorities load first; equal priorities load in request order.
+	class AsyncContentLoader {
+	public:
+		// threadCount decode workers, 0 uses every processor.
+		AsyncContentLoader(ContentManager& content, size_t threadCount = 0);
+
+		// Cancels queued requests and waits for the ones already loading.
+		~AsyncContentLoader();
+
+		AsyncContentLoader(AsyncContentLoader const&) = delete;
+		AsyncContentLoader& operator =(AsyncContentLoader const&) = delete;
+
+		template <typename T>
+		ContentLoadHandle<T> LoadAsync(std::string const& assetName, int32_t priority = 0,
+			std::function<void(std::shared_ptr<T> const&)> callback = nullptr) {
+			auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+
+			ContentLoadHandle<T> handle;
+			handle.Future = promise->get_future().share();
+			handle.Request = enqueue(assetName, typeid(T), priority, [promise, callback](std::shared_ptr<void> const& asset) {
+				auto result = std::static_pointer_cast<T>(asset);
+
+				if (callback)
+					callback(result);
+
+				promise->set_value(result);
+				});
+
+			return handle;
+		}
+
+		// Type-erased form of LoadAsync for callers that pick the asset type at run time.
+		std::shared_ptr<ContentLoadRequest> LoadAsync(std::string const& assetName, std::type_index type, int32_t priority,
+			std::function<void(std::shared_ptr<void> const&)> callback);
+
+		// How many requests the I/O thread maps per batch.
+		size_t BatchSize() const;
+		void BatchSize(size_t value);
+
+		size_t ThreadCount() const;
+		size_t PendingCount() const;
+
+		void CancelAll();
+
+		// Blocks until every request made so far has completed, failed or been canceled.
+		void WaitIdle();
+
+		// Loads the assets once through ContentManager::Load and once through an AsyncContentLoader, each with a
+		// fresh ContentManager, and reports the wall clock time of both. The files are evicted from the OS cache
+		// before each pass, so both include disk time; see MemoryMappedFile::Evict.
+		static ContentLoadBenchmarkResult Benchmark(std::string const& rootDirectory,
+			std::vector<std::pair<std::string, std::type_index>> const& assets, size_t threadCount = 0);
+
+	private:
+		struct DecodeJob {
+			std::shared_ptr<ContentLoadRequest> Request;
+			std::shared_ptr<MemoryMappedFile> File;
+		};
+
+		ContentManager& _content;
+		std::vector<std::thread> _workers;
+		std::thread _ioThread;
+		std::vector<std::shared_ptr<ContentLoadRequest>> _requests;
+		std::vector<DecodeJob> _decodeJobs;
+		mutable std::mutex _mutex;
+		std::condition_variable _requestAvailable;
+		std::condition_variable _decodeAvailable;
+		std::condition_variable _idle;
+		uint64_t _sequence{ 0 };
+		size_t _outstanding{ 0 };
+		size_t _batchSize{ 8 };
+		bool _stopping{ false };
+		bool _stopWorkers{ false };
+
+		static bool runsAfter(std::shared_ptr<ContentLoadRequest> const& a, std::shared_ptr<ContentLoadRequest> const& b);
+		static bool decodesAfter(DecodeJob const& a, DecodeJob const& b);
+
+		std::shared_ptr<ContentLoadRequest> enqueue(std::string const& assetName, std::type_index type, int32_t priority,
+			std::function<void(std::shared_ptr<void> const&)> complete);
+		void ioLoop();
+		void workerLoop();
+	};
+}
+
+#endif
@@ -0,0 +1,57 @@
+#include "ContentLoadRequest.hpp"
+
+using std::shared_ptr;
+using std::string;
+
+//Constructors
+namespace Xna {
+	ContentLoadRequest::ContentLoadRequest(string const& assetName, std::type_index type, int32_t priority, uint64_t sequence,
+		std::function<void(shared_ptr<void> const&)> complete) :
+		_assetName(assetName), _type(type), _priority(priority), _sequence(sequence), _complete(std::move(complete)) {}
+}
+
+//Functions
+namespace Xna {
+	string const& ContentLoadRequest::AssetName() const {
+		return _assetName;
+	}
+
+	int32_t ContentLoadRequest::Priority() const {
+		return _priority;
+	}
+
+	ContentLoadStatus ContentLoadRequest::Status() const {
+		return _status.load(std::memory_order_acquire);
+	}
+
+	bool ContentLoadRequest::Cancel() {
+		auto expected = ContentLoadStatus::Queued;
+
+		if (!_status.compare_exchange_strong(expected, ContentLoadStatus::Canceled, std::memory_order_acq_rel))
+			return false;
+
+		if (_complete)
+			_complete(nullptr);
+
+		return true;
+	}
+
+	bool ContentLoadRequest::IsCanceled() const {
+		return Status() == ContentLoadStatus::Canceled;
+	}
+}
+
+//Private
+namespace Xna {
+	bool ContentLoadRequest::beginLoading() {
+		auto expected = ContentLoadStatus::Queued;
+		return _status.compare_exchange_strong(expected, ContentLoadStatus::Loading, std::memory_order_acq_rel);
+	}
+
+	void ContentLoadRequest::finish(ContentLoadStatus status, shared_ptr<void> const& asset) {
+		_status.store(status, std::memory_order_release);
+
+		if (_complete)
+			_complete(status == ContentLoadStatus::Completed ? asset : nullptr);
+	}
+}
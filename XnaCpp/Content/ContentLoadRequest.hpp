@@ -0,0 +1,45 @@
+#ifndef _CONTENTLOADREQUEST_HPP_
+#define _CONTENTLOADREQUEST_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include "ContentLoadStatus.hpp"
+
+namespace Xna {
+
+	// One queued asset load of an AsyncContentLoader. Completes exactly once, with a null asset unless
+	// the status is Completed.
+	class ContentLoadRequest {
+	public:
+		ContentLoadRequest(std::string const& assetName, std::type_index type, int32_t priority, uint64_t sequence,
+			std::function<void(std::shared_ptr<void> const&)> complete);
+
+		std::string const& AssetName() const;
+		int32_t Priority() const;
+		ContentLoadStatus Status() const;
+
+		// Succeeds while the request is still queued; its future then resolves to nullptr right away.
+		bool Cancel();
+		bool IsCanceled() const;
+
+	private:
+		friend class AsyncContentLoader;
+
+		std::string _assetName;
+		std::type_index _type;
+		int32_t _priority{ 0 };
+		uint64_t _sequence{ 0 };
+		std::function<void(std::shared_ptr<void> const&)> _complete;
+		std::atomic<ContentLoadStatus> _status{ ContentLoadStatus::Queued };
+
+		bool beginLoading();
+		void finish(ContentLoadStatus status, std::shared_ptr<void> const& asset);
+	};
+}
+
+#endif
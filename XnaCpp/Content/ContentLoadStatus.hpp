@@ -0,0 +1,24 @@
+#ifndef _CONTENTLOADSTATUS_HPP_
+#define _CONTENTLOADSTATUS_HPP_
+
+namespace Xna {
+	enum class ContentLoadStatus {
+
+		// Waiting for the I/O thread or a decode worker.
+		Queued,
+
+		// The file is being read or deserialized; it can no longer be canceled.
+		Loading,
+
+		// The asset was loaded or found in the cache.
+		Completed,
+
+		// The file was missing or malformed, or the asset has another type.
+		Failed,
+
+		// Canceled while still queued.
+		Canceled
+	};
+}
+
+#endif
@@ -0,0 +1,270 @@
+#include <new>
+#include <vector>
+#include "ContentManager.hpp"
+#include "ContentReader.hpp"
+#include "Lz4Decoder.hpp"
+#include "LzxDecoder.hpp"
+#include "MemoryMappedFile.hpp"
+#include "../Profiler.hpp"
+
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		constexpr size_t HeaderSize = 10;
+		constexpr size_t CompressedHeaderSize = 14;
+
+		// Most output a byte of compressed input can decode to. An LZ4 match gains at most 255 bytes per length
+		// byte. An LZX chunk takes at least 3 bytes, 2 of header and 1 of data, for at most a 0x8000 byte frame;
+		// chunks with larger frames have a 5 byte header.
+		constexpr size_t MaxLz4Expansion = 255;
+		constexpr size_t MaxLzxExpansion = (0x8000 + 2) / 3;
+
+		int32_t readInt32(uint8_t const* data) {
+			return static_cast<int32_t>(data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24));
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	ContentManager::ContentManager() {}
+
+	ContentManager::ContentManager(string const& rootDirectory) :
+		_rootDirectory(rootDirectory) {}
+
+	ContentManager::~ContentManager() {}
+}
+
+//Functions
+namespace Xna {
+	string ContentManager::RootDirectory() const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _rootDirectory;
+	}
+
+	void ContentManager::RootDirectory(string const& value) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		_rootDirectory = value;
+	}
+
+	ContentTypeReaderManager& ContentManager::TypeReaders() {
+		return _typeReaders;
+	}
+
+	bool ContentManager::UnloadAsset(string const& assetName) {
+		auto name = NormalizeAssetName(assetName);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _assets.find(name);
+
+		if (it == _assets.end())
+			return false;
+
+		if (--it->second.References <= 0)
+			_assets.erase(it);
+
+		return true;
+	}
+
+	void ContentManager::Unload() {
+		std::lock_guard<std::mutex> lock(_mutex);
+		_assets.clear();
+	}
+
+	bool ContentManager::IsLoaded(string const& assetName) const {
+		auto name = NormalizeAssetName(assetName);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _assets.find(name) != _assets.end();
+	}
+
+	int32_t ContentManager::ReferenceCount(string const& assetName) const {
+		auto name = NormalizeAssetName(assetName);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _assets.find(name);
+
+		return it == _assets.end() ? 0 : it->second.References;
+	}
+
+	size_t ContentManager::LoadedAssetCount() const {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _assets.size();
+	}
+
+	shared_ptr<void> ContentManager::ReadAsset(string const& assetName, uint8_t const* data, size_t size, std::type_index type) {
+		XNA_PROFILE_ZONE("ContentManager::ReadAsset");
+
+		if (!data || size < HeaderSize || data[0] != 'X' || data[1] != 'N' || data[2] != 'B')
+			return nullptr;
+
+		// Xbox 360 content is big-endian.
+		if (data[3] == 'x')
+			return nullptr;
+
+		auto version = data[4];
+		auto flags = data[5];
+		auto xnbLength = readInt32(data + 6);
+
+		if ((version != 4 && version != 5) || xnbLength < static_cast<int32_t>(HeaderSize) || static_cast<size_t>(xnbLength) > size)
+			return nullptr;
+
+		auto compressedLzx = (flags & ContentCompressedLzx) != 0;
+		auto compressedLz4 = (flags & ContentCompressedLz4) != 0;
+
+		if (!compressedLzx && !compressedLz4) {
+			// Read in place from the caller's buffer, which is usually the mapped file.
+			ContentReader reader(this, data + HeaderSize, static_cast<size_t>(xnbLength) - HeaderSize, assetName, version);
+
+			if (!reader.initializeTypeReaders(_typeReaders))
+				return nullptr;
+
+			return reader.readAsset(type);
+		}
+
+		if (xnbLength < static_cast<int32_t>(CompressedHeaderSize))
+			return nullptr;
+
+		auto decompressedSize = readInt32(data + HeaderSize);
+
+		if (decompressedSize < 0)
+			return nullptr;
+
+		auto compressed = data + CompressedHeaderSize;
+		auto compressedSize = static_cast<size_t>(xnbLength) - CompressedHeaderSize;
+
+		// The size comes from the file; refuse sizes the payload could not decode to before allocating them.
+		auto expansion = compressedLzx ? MaxLzxExpansion : MaxLz4Expansion;
+
+		if ((static_cast<size_t>(decompressedSize) + expansion - 1) / expansion > compressedSize)
+			return nullptr;
+
+		vector<uint8_t> decompressed;
+
+		try {
+			decompressed.resize(static_cast<size_t>(decompressedSize));
+		}
+		catch (std::bad_alloc const&) {
+			return nullptr;
+		}
+
+		{
+			XNA_PROFILE_ZONE("ContentManager::Decompress");
+
+			auto decoded = compressedLzx
+				? LzxDecoder::DecompressXnb(compressed, compressedSize, decompressed.data(), decompressed.size())
+				: Lz4Decoder::Decompress(compressed, compressedSize, decompressed.data(), decompressed.size());
+
+			if (!decoded)
+				return nullptr;
+		}
+
+		ContentReader reader(this, decompressed.data(), decompressed.size(), assetName, version);
+
+		if (!reader.initializeTypeReaders(_typeReaders))
+			return nullptr;
+
+		return reader.readAsset(type);
+	}
+}
+
+//Static
+namespace Xna {
+	string ContentManager::NormalizeAssetName(string const& assetName) {
+		auto name = assetName;
+
+		for (auto& c : name) {
+			if (c == '\\')
+				c = '/';
+		}
+
+		constexpr char extension[] = ".xnb";
+		constexpr size_t extensionLength = sizeof(extension) - 1;
+
+		if (name.size() > extensionLength && name.compare(name.size() - extensionLength, extensionLength, extension) == 0)
+			name.resize(name.size() - extensionLength);
+
+		return name;
+	}
+}
+
+//Private
+namespace Xna {
+	shared_ptr<void> ContentManager::load(string const& assetName, std::type_index type) {
+		XNA_PROFILE_ZONE("ContentManager::Load");
+
+		auto name = NormalizeAssetName(assetName);
+
+		if (name.empty())
+			return nullptr;
+
+		shared_ptr<void> asset;
+
+		if (findCachedAsset(name, type, asset))
+			return asset;
+
+		MemoryMappedFile file(assetPath(name));
+
+		if (!file.IsOpen())
+			return nullptr;
+
+		asset = ReadAsset(name, file.Data(), file.Size(), type);
+
+		if (!asset)
+			return nullptr;
+
+		return cacheAsset(name, asset, type);
+	}
+
+	string ContentManager::assetPath(string const& assetName) const {
+		auto root = RootDirectory();
+
+		if (!root.empty() && root.back() != '/' && root.back() != '\\')
+			root += '/';
+
+		return root + assetName + ".xnb";
+	}
+
+	bool ContentManager::findCachedAsset(string const& assetName, std::type_index type, shared_ptr<void>& asset) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _assets.find(assetName);
+
+		if (it == _assets.end())
+			return false;
+
+		// A name cached as another type is a failed load, not a reason to read the file again.
+		if (it->second.Type != type) {
+			asset = nullptr;
+			return true;
+		}
+
+		++it->second.References;
+		asset = it->second.Asset;
+
+		return true;
+	}
+
+	shared_ptr<void> ContentManager::cacheAsset(string const& assetName, shared_ptr<void> const& asset, std::type_index type) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto& entry = _assets[assetName];
+
+		// Another thread may have finished the same asset first; keep a single instance.
+		if (entry.Asset) {
+			if (entry.Type != type)
+				return nullptr;
+
+			++entry.References;
+			return entry.Asset;
+		}
+
+		entry.Asset = asset;
+		entry.Type = type;
+		entry.References = 1;
+
+		return asset;
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef _CONTENTMANAGER_HPP_
+#define _CONTENTMANAGER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include "ContentTypeReaderManager.hpp"
+
+namespace Xna {
+
+	// Port of the XNA ContentManager. Assets are loaded from memory-mapped "<RootDirectory>/<name>.xnb"
+	// files, LZX and LZ4 payloads are decoded frame by frame into one buffer, and each asset is cached by
+	// name with a reference count: every Load() adds a reference and every UnloadAsset() drops one.
+	// Failures return nullptr instead of throwing. Cache operations are thread-safe.
+	class ContentManager {
+	public:
+		ContentManager();
+		ContentManager(std::string const& rootDirectory);
+		virtual ~ContentManager();
+
+		std::string RootDirectory() const;
+		void RootDirectory(std::string const& value);
+
+		ContentTypeReaderManager& TypeReaders();
+
+		// Returns the cached asset or reads it, adding a reference either way.
+		// Returns nullptr when the file is missing or malformed, or when the asset is not a T.
+		template <typename T>
+		std::shared_ptr<T> Load(std::string const& assetName) {
+			return std::static_pointer_cast<T>(load(assetName, typeid(T)));
+		}
+
+		// Drops one reference; the cache releases the asset when none remain. Holders of the pointer keep it alive.
+		bool UnloadAsset(std::string const& assetName);
+
+		// Releases every cached asset regardless of its reference count.
+		void Unload();
+
+		bool IsLoaded(std::string const& assetName) const;
+		int32_t ReferenceCount(std::string const& assetName) const;
+		size_t LoadedAssetCount() const;
+
+		// Deserializes an XNB image of the given asset without touching the cache. Returns nullptr on failure.
+		std::shared_ptr<void> ReadAsset(std::string const& assetName, uint8_t const* data, size_t size, std::type_index type);
+
+		// Flags stored in the sixth byte of an XNB header.
+		static constexpr uint8_t ContentCompressedLzx = 0x80;
+		static constexpr uint8_t ContentCompressedLz4 = 0x40;
+
+		// Asset names use forward slashes and carry no ".xnb" extension.
+		static std::string NormalizeAssetName(std::string const& assetName);
+
+	private:
+		friend class AsyncContentLoader;
+
+		struct Entry {
+			std::shared_ptr<void> Asset;
+			std::type_index Type{ typeid(void) };
+			int32_t References{ 0 };
+		};
+
+		std::unordered_map<std::string, Entry> _assets;
+		std::string _rootDirectory;
+		ContentTypeReaderManager _typeReaders;
+		mutable std::mutex _mutex;
+
+		std::shared_ptr<void> load(std::string const& assetName, std::type_index type);
+		std::string assetPath(std::string const& assetName) const;
+		bool findCachedAsset(std::string const& assetName, std::type_index type, std::shared_ptr<void>& asset);
+		std::shared_ptr<void> cacheAsset(std::string const& assetName, std::shared_ptr<void> const& asset, std::type_index type);
+	};
+}
+
+#endif
@@ -0,0 +1,333 @@
+#include <cstring>
+#include "ContentReader.hpp"
+#include "ContentTypeReader.hpp"
+#include "ContentTypeReaderManager.hpp"
+#include "../BoundingSphere.hpp"
+#include "../Color.hpp"
+#include "../Matrix.hpp"
+#include "../Quaternion.hpp"
+#include "../Vector2.hpp"
+#include "../Vector3.hpp"
+#include "../Vector4.hpp"
+
+using std::shared_ptr;
+using std::string;
+
+//Constructors
+namespace Xna {
+	ContentReader::ContentReader(Xna::ContentManager* manager, uint8_t const* data, size_t size, string const& assetName, int32_t version) :
+		_manager(manager), _assetName(assetName), _data(data), _size(size), _version(version) {}
+}
+
+//Functions
+namespace Xna {
+	ContentManager* ContentReader::GetContentManager() const {
+		return _manager;
+	}
+
+	string const& ContentReader::AssetName() const {
+		return _assetName;
+	}
+
+	int32_t ContentReader::Version() const {
+		return _version;
+	}
+
+	bool ContentReader::HasError() const {
+		return _hasError;
+	}
+
+	void ContentReader::Fail() {
+		_hasError = true;
+		_position = _size;
+	}
+
+	size_t ContentReader::Position() const {
+		return _position;
+	}
+
+	size_t ContentReader::Remaining() const {
+		return _size - _position;
+	}
+
+	uint8_t ContentReader::ReadByte() {
+		return readPrimitive<uint8_t>();
+	}
+
+	bool ContentReader::ReadBoolean() {
+		return readPrimitive<uint8_t>() != 0;
+	}
+
+	int16_t ContentReader::ReadInt16() {
+		return readPrimitive<int16_t>();
+	}
+
+	uint16_t ContentReader::ReadUInt16() {
+		return readPrimitive<uint16_t>();
+	}
+
+	int32_t ContentReader::ReadInt32() {
+		return readPrimitive<int32_t>();
+	}
+
+	uint32_t ContentReader::ReadUInt32() {
+		return readPrimitive<uint32_t>();
+	}
+
+	int64_t ContentReader::ReadInt64() {
+		return readPrimitive<int64_t>();
+	}
+
+	uint64_t ContentReader::ReadUInt64() {
+		return readPrimitive<uint64_t>();
+	}
+
+	float ContentReader::ReadSingle() {
+		return readPrimitive<float>();
+	}
+
+	double ContentReader::ReadDouble() {
+		return readPrimitive<double>();
+	}
+
+	int32_t ContentReader::Read7BitEncodedInt() {
+		uint32_t result = 0;
+
+		for (int32_t shift = 0; shift < 35; shift += 7) {
+			auto value = ReadByte();
+			result |= static_cast<uint32_t>(value & 0x7F) << shift;
+
+			if ((value & 0x80) == 0)
+				return static_cast<int32_t>(result);
+		}
+
+		Fail();
+		return 0;
+	}
+
+	string ContentReader::ReadString() {
+		auto length = Read7BitEncodedInt();
+
+		if (length < 0 || static_cast<size_t>(length) > Remaining()) {
+			Fail();
+			return string();
+		}
+
+		string result(reinterpret_cast<char const*>(_data + _position), static_cast<size_t>(length));
+		_position += static_cast<size_t>(length);
+
+		return result;
+	}
+
+	bool ContentReader::ReadBytes(void* destination, size_t count) {
+		if (count > Remaining()) {
+			Fail();
+			std::memset(destination, 0, count);
+			return false;
+		}
+
+		if (count != 0)
+			std::memcpy(destination, _data + _position, count);
+
+		_position += count;
+		return true;
+	}
+
+	Vector2 ContentReader::ReadVector2() {
+		Vector2 result;
+		result.X = ReadSingle();
+		result.Y = ReadSingle();
+		return result;
+	}
+
+	Vector3 ContentReader::ReadVector3() {
+		Vector3 result;
+		result.X = ReadSingle();
+		result.Y = ReadSingle();
+		result.Z = ReadSingle();
+		return result;
+	}
+
+	Vector4 ContentReader::ReadVector4() {
+		Vector4 result;
+		result.X = ReadSingle();
+		result.Y = ReadSingle();
+		result.Z = ReadSingle();
+		result.W = ReadSingle();
+		return result;
+	}
+
+	Matrix ContentReader::ReadMatrix() {
+		Matrix result;
+		result.M11 = ReadSingle();
+		result.M12 = ReadSingle();
+		result.M13 = ReadSingle();
+		result.M14 = ReadSingle();
+		result.M21 = ReadSingle();
+		result.M22 = ReadSingle();
+		result.M23 = ReadSingle();
+		result.M24 = ReadSingle();
+		result.M31 = ReadSingle();
+		result.M32 = ReadSingle();
+		result.M33 = ReadSingle();
+		result.M34 = ReadSingle();
+		result.M41 = ReadSingle();
+		result.M42 = ReadSingle();
+		result.M43 = ReadSingle();
+		result.M44 = ReadSingle();
+		return result;
+	}
+
+	Quaternion ContentReader::ReadQuaternion() {
+		Quaternion result;
+		result.X = ReadSingle();
+		result.Y = ReadSingle();
+		result.Z = ReadSingle();
+		result.W = ReadSingle();
+		return result;
+	}
+
+	Color ContentReader::ReadColor() {
+		auto r = ReadByte();
+		auto g = ReadByte();
+		auto b = ReadByte();
+		auto a = ReadByte();
+		return Color(r, g, b, a);
+	}
+
+	BoundingSphere ContentReader::ReadBoundingSphere() {
+		auto center = ReadVector3();
+		auto radius = ReadSingle();
+		return BoundingSphere(center, radius);
+	}
+
+	size_t ContentReader::TypeReaderCount() const {
+		return _typeReaders.size();
+	}
+
+	ContentTypeReader* ContentReader::TypeReader(size_t index) const {
+		return index < _typeReaders.size() ? _typeReaders[index].get() : nullptr;
+	}
+}
+
+//Private
+namespace Xna {
+	template <typename T>
+	T ContentReader::readPrimitive() {
+		T value{};
+
+		if (sizeof(T) > Remaining()) {
+			Fail();
+			return value;
+		}
+
+		std::memcpy(&value, _data + _position, sizeof(T));
+		_position += sizeof(T);
+
+		return value;
+	}
+
+	bool ContentReader::initializeTypeReaders(ContentTypeReaderManager& typeReaders) {
+		auto count = Read7BitEncodedInt();
+
+		if (count < 0 || static_cast<size_t>(count) > Remaining()) {
+			Fail();
+			return false;
+		}
+
+		_typeReaders.clear();
+		_typeReaders.reserve(static_cast<size_t>(count));
+
+		for (int32_t i = 0; i < count; ++i) {
+			auto name = ReadString();
+			ReadInt32();
+
+			auto reader = typeReaders.GetTypeReader(name);
+
+			if (!reader || _hasError) {
+				Fail();
+				return false;
+			}
+
+			_typeReaders.push_back(reader);
+		}
+
+		_sharedResourceCount = Read7BitEncodedInt();
+
+		return !_hasError;
+	}
+
+	shared_ptr<void> ContentReader::readAsset(std::type_index type) {
+		auto result = readObject(type);
+
+		// Shared resources are read so the whole payload is validated; nothing refers back to them yet.
+		for (int32_t i = 0; i < _sharedResourceCount && !_hasError; ++i) {
+			auto index = Read7BitEncodedInt();
+
+			if (index > 0 && static_cast<size_t>(index) <= _typeReaders.size())
+				_typeReaders[index - 1]->Read(*this);
+		}
+
+		return _hasError ? nullptr : result;
+	}
+
+	shared_ptr<void> ContentReader::readObject(std::type_index type) {
+		auto index = Read7BitEncodedInt();
+
+		if (index == 0 || _hasError)
+			return nullptr;
+
+		if (static_cast<size_t>(index) > _typeReaders.size()) {
+			Fail();
+			return nullptr;
+		}
+
+		auto& reader = _typeReaders[index - 1];
+
+		if (reader->TargetType() != type) {
+			Fail();
+			return nullptr;
+		}
+
+		return reader->Read(*this);
+	}
+
+	string ContentReader::resolveRelativePath(string const& relativePath) const {
+		// Relative to the directory of this asset, with "." and ".." segments collapsed.
+		auto slash = _assetName.find_last_of("/\\");
+		auto combined = (slash == string::npos ? string() : _assetName.substr(0, slash + 1)) + relativePath;
+
+		std::vector<string> segments;
+		size_t start = 0;
+
+		while (start <= combined.size()) {
+			auto end = combined.find_first_of("/\\", start);
+
+			if (end == string::npos)
+				end = combined.size();
+
+			auto segment = combined.substr(start, end - start);
+
+			if (segment == "..") {
+				if (!segments.empty())
+					segments.pop_back();
+			}
+			else if (!segment.empty() && segment != ".") {
+				segments.push_back(segment);
+			}
+
+			start = end + 1;
+		}
+
+		string result;
+
+		for (auto const& segment : segments) {
+			if (!result.empty())
+				result += '/';
+
+			result += segment;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,108 @@
+#ifndef _CONTENTREADER_HPP_
+#define _CONTENTREADER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+#include "ContentManager.hpp"
+
+namespace Xna {
+
+	struct BoundingSphere;
+	struct Color;
+	struct Matrix;
+	struct Quaternion;
+	struct Vector2;
+	struct Vector3;
+	struct Vector4;
+	class ContentTypeReader;
+	class ContentTypeReaderManager;
+
+	// Port of the XNA ContentReader over an in-memory XNB payload. Values are read in place from the
+	// buffer, which is the mapped file itself for uncompressed content. Data is little-endian.
+	// Reading past the end or through an unknown reader sets HasError(); failed reads return zeros.
+	class ContentReader {
+	public:
+		ContentReader(Xna::ContentManager* manager, uint8_t const* data, size_t size, std::string const& assetName, int32_t version);
+
+		// Named so the accessor does not hide the ContentManager type.
+		Xna::ContentManager* GetContentManager() const;
+		std::string const& AssetName() const;
+		int32_t Version() const;
+
+		bool HasError() const;
+		void Fail();
+
+		size_t Position() const;
+		size_t Remaining() const;
+
+		uint8_t ReadByte();
+		bool ReadBoolean();
+		int16_t ReadInt16();
+		uint16_t ReadUInt16();
+		int32_t ReadInt32();
+		uint32_t ReadUInt32();
+		int64_t ReadInt64();
+		uint64_t ReadUInt64();
+		float ReadSingle();
+		double ReadDouble();
+		int32_t Read7BitEncodedInt();
+		std::string ReadString();
+		bool ReadBytes(void* destination, size_t count);
+
+		Vector2 ReadVector2();
+		Vector3 ReadVector3();
+		Vector4 ReadVector4();
+		Matrix ReadMatrix();
+		Quaternion ReadQuaternion();
+		Color ReadColor();
+		BoundingSphere ReadBoundingSphere();
+
+		// Reads a type reader index followed by the object. Returns nullptr for null objects and on a type mismatch.
+		template <typename T>
+		std::shared_ptr<T> ReadObject() {
+			return std::static_pointer_cast<T>(readObject(typeid(T)));
+		}
+
+		// Loads the asset named relative to this one through the owning ContentManager.
+		template <typename T>
+		std::shared_ptr<T> ReadExternalReference() {
+			auto name = ReadString();
+
+			if (name.empty() || !_manager)
+				return nullptr;
+
+			return _manager->template Load<T>(resolveRelativePath(name));
+		}
+
+		size_t TypeReaderCount() const;
+		ContentTypeReader* TypeReader(size_t index) const;
+
+	private:
+		friend class ContentManager;
+
+		Xna::ContentManager* _manager{ nullptr };
+		std::string _assetName;
+		std::vector<std::shared_ptr<ContentTypeReader>> _typeReaders;
+		uint8_t const* _data{ nullptr };
+		size_t _size{ 0 };
+		size_t _position{ 0 };
+		int32_t _version{ 0 };
+		int32_t _sharedResourceCount{ 0 };
+		bool _hasError{ false };
+
+		template <typename T>
+		T readPrimitive();
+
+		bool initializeTypeReaders(ContentTypeReaderManager& typeReaders);
+		std::shared_ptr<void> readAsset(std::type_index type);
+		std::shared_ptr<void> readObject(std::type_index type);
+		std::string resolveRelativePath(std::string const& relativePath) const;
+	};
+}
+
+#endif
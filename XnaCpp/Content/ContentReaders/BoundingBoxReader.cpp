@@ -0,0 +1,25 @@
+#include <bit>
+#include "BoundingBoxReader.hpp"
+#include "../ContentReader.hpp"
+
+using std::string;
+
+namespace Xna {
+	string BoundingBoxReader::ReaderName() const {
+		return "Microsoft.Xna.Framework.Content.BoundingBoxReader";
+	}
+
+	string BoundingBoxReader::TargetName() const {
+		return "Microsoft.Xna.Framework.BoundingBox";
+	}
+
+	bool BoundingBoxReader::IsBlittable() const {
+		return std::endian::native == std::endian::little && sizeof(BoundingBox) == 6 * sizeof(float);
+	}
+
+	BoundingBox BoundingBoxReader::ReadValue(ContentReader& input) const {
+		auto min = input.ReadVector3();
+		auto max = input.ReadVector3();
+		return BoundingBox(min, max);
+	}
+}
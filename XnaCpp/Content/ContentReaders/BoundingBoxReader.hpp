@@ -0,0 +1,18 @@
+#ifndef _BOUNDINGBOXREADER_HPP_
+#define _BOUNDINGBOXREADER_HPP_
+
+#include "../ContentTypeReader.hpp"
+#include "../../BoundingBox.hpp"
+
+namespace Xna {
+
+	class BoundingBoxReader : public ContentTypeReaderOf<BoundingBox> {
+	public:
+		std::string ReaderName() const override;
+		std::string TargetName() const override;
+		bool IsBlittable() const override;
+		BoundingBox ReadValue(ContentReader& input) const override;
+	};
+}
+
+#endif
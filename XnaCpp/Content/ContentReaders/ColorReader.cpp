@@ -0,0 +1,24 @@
+#include <bit>
+#include "ColorReader.hpp"
+#include "../ContentReader.hpp"
+
+using std::string;
+
+namespace Xna {
+	string ColorReader::ReaderName() const {
+		return "Microsoft.Xna.Framework.Content.ColorReader";
+	}
+
+	string ColorReader::TargetName() const {
+		return "Microsoft.Xna.Framework.Color";
+	}
+
+	bool ColorReader::IsBlittable() const {
+		// Color packs R into the low byte, so on little-endian hosts its bytes are R, G, B, A as in the file.
+		return std::endian::native == std::endian::little && sizeof(Color) == 4;
+	}
+
+	Color ColorReader::ReadValue(ContentReader& input) const {
+		return input.ReadColor();
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef _COLORREADER_HPP_
+#define _COLORREADER_HPP_
+
+#include "../ContentTypeReader.hpp"
+#include "../../Color.hpp"
+
+namespace Xna {
+
+	class ColorReader : public ContentTypeReaderOf<Color> {
+	public:
+		std::string ReaderName() const override;
+		std::string TargetName() const override;
+		bool IsBlittable() const override;
+		Color ReadValue(ContentReader& input) const override;
+	};
+}
+
+#endif
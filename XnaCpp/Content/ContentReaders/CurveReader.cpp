@@ -0,0 +1,40 @@
+#include "CurveReader.hpp"
+#include "../ContentReader.hpp"
+#include "../../CurveKey.hpp"
+
+using std::string;
+
+namespace Xna {
+	string CurveReader::ReaderName() const {
+		return "Microsoft.Xna.Framework.Content.CurveReader";
+	}
+
+	string CurveReader::TargetName() const {
+		return "Microsoft.Xna.Framework.Curve";
+	}
+
+	bool CurveReader::TargetIsValueType() const {
+		return false;
+	}
+
+	Curve CurveReader::ReadValue(ContentReader& input) const {
+		Curve curve;
+		curve.PreLoop(static_cast<CurveLoopType>(input.ReadInt32()));
+		curve.PostLoop(static_cast<CurveLoopType>(input.ReadInt32()));
+
+		auto count = input.ReadInt32();
+		auto& keys = curve.Keys();
+
+		for (int32_t i = 0; i < count && !input.HasError(); ++i) {
+			auto position = input.ReadSingle();
+			auto value = input.ReadSingle();
+			auto tangentIn = input.ReadSingle();
+			auto tangentOut = input.ReadSingle();
+			auto continuity = static_cast<CurveContinuity>(input.ReadInt32());
+
+			keys.Add(CurveKey(position, value, tangentIn, tangentOut, continuity));
+		}
+
+		return curve;
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef _CURVEREADER_HPP_
+#define _CURVEREADER_HPP_
+
+#include "../ContentTypeReader.hpp"
+#include "../../Curve.hpp"
+
+namespace Xna {
+
+	class CurveReader : public ContentTypeReaderOf<Curve> {
+	public:
+		std::string ReaderName() const override;
+		std::string TargetName() const override;
+		bool TargetIsValueType() const override;
+		Curve ReadValue(ContentReader& input) const override;
+	};
+}
+
+#endif
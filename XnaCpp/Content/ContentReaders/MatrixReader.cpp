@@ -0,0 +1,23 @@
+#include <bit>
+#include "MatrixReader.hpp"
+#include "../ContentReader.hpp"
+
+using std::string;
+
+namespace Xna {
+	string MatrixReader::ReaderName() const {
+		return "Microsoft.Xna.Framework.Content.MatrixReader";
+	}
+
+	string MatrixReader::TargetName() const {
+		return "Microsoft.Xna.Framework.Matrix";
+	}
+
+	bool MatrixReader::IsBlittable() const {
+		return std::endian::native == std::endian::little && sizeof(Matrix) == 16 * sizeof(float);
+	}
+
+	Matrix MatrixReader::ReadValue(ContentReader& input) const {
+		return input.ReadMatrix();
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef _MATRIXREADER_HPP_
+#define _MATRIXREADER_HPP_
+
+#include "../ContentTypeReader.hpp"
+#include "../../Matrix.hpp"
+
+namespace Xna {
+
+	class MatrixReader : public ContentTypeReaderOf<Matrix> {
+	public:
+		std::string ReaderName() const override;
+		std::string TargetName() const override;
+		bool IsBlittable() const override;
+		Matrix ReadValue(ContentReader& input) const override;
+	};
+}
+
+#endif
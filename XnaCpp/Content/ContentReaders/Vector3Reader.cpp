@@ -0,0 +1,23 @@
+#include <bit>
+#include "Vector3Reader.hpp"
+#include "../ContentReader.hpp"
+
+using std::string;
+
+namespace Xna {
+	string Vector3Reader::ReaderName() const {
+		return "Microsoft.Xna.Framework.Content.Vector3Reader";
+	}
+
+	string Vector3Reader::TargetName() const {
+		return "Microsoft.Xna.Framework.Vector3";
+	}
+
+	bool Vector3Reader::IsBlittable() const {
+		return std::endian::native == std::endian::little && sizeof(Vector3) == 3 * sizeof(float);
+	}
+
+	Vector3 Vector3Reader::ReadValue(ContentReader& input) const {
+		return input.ReadVector3();
+	}
+}
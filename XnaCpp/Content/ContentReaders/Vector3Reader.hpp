@@ -0,0 +1,18 @@
+#ifndef _VECTOR3READER_HPP_
+#define _VECTOR3READER_HPP_
+
+#include "../ContentTypeReader.hpp"
+#include "../../Vector3.hpp"
+
+namespace Xna {
+
+	class Vector3Reader : public ContentTypeReaderOf<Vector3> {
+	public:
+		std::string ReaderName() const override;
+		std::string TargetName() const override;
+		bool IsBlittable() const override;
+		Vector3 ReadValue(ContentReader& input) const override;
+	};
+}
+
+#endif
@@ -0,0 +1,13 @@
+#include "ContentTypeReader.hpp"
+
+namespace Xna {
+	ContentTypeReader::~ContentTypeReader() {}
+
+	bool ContentTypeReader::TargetIsValueType() const {
+		return true;
+	}
+
+	std::shared_ptr<ContentTypeReader> ContentTypeReader::CreateArrayReader() const {
+		return nullptr;
+	}
+}
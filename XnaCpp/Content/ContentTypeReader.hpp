@@ -0,0 +1,65 @@
+#ifndef _CONTENTTYPEREADER_HPP_
+#define _CONTENTTYPEREADER_HPP_
+
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+
+namespace Xna {
+
+	class ContentReader;
+
+	// Deserializes one runtime type from an XNB stream. Readers are stateless and shared between loads.
+	class ContentTypeReader {
+	public:
+		virtual ~ContentTypeReader();
+
+		// Type name of the reader as written in XNB headers, without assembly qualifiers,
+		// e.g. "Microsoft.Xna.Framework.Content.Vector3Reader".
+		virtual std::string ReaderName() const = 0;
+
+		// Full name of the produced type, e.g. "Microsoft.Xna.Framework.Vector3". Generic readers use it to find element readers.
+		virtual std::string TargetName() const = 0;
+		virtual std::type_index TargetType() const = 0;
+
+		// Value types are written inline inside collections, without a type reader index.
+		virtual bool TargetIsValueType() const;
+
+		virtual std::shared_ptr<void> Read(ContentReader& input) = 0;
+
+		// Reader for ArrayReader`1 of this type, or nullptr when arrays of it are not supported.
+		virtual std::shared_ptr<ContentTypeReader> CreateArrayReader() const;
+	};
+
+	template <typename T>
+	class ArrayReader;
+
+	// Base for readers that produce a T. Read() returns a std::shared_ptr<T>.
+	template <typename T>
+	class ContentTypeReaderOf : public ContentTypeReader {
+	public:
+		std::type_index TargetType() const override {
+			return typeid(T);
+		}
+
+		std::shared_ptr<void> Read(ContentReader& input) override {
+			return std::make_shared<T>(ReadValue(input));
+		}
+
+		std::shared_ptr<ContentTypeReader> CreateArrayReader() const override {
+			return std::make_shared<ArrayReader<T>>(this);
+		}
+
+		virtual T ReadValue(ContentReader& input) const = 0;
+
+		// True when the serialized bytes of a T equal its in-memory layout, which lets arrays be read with one copy.
+		virtual bool IsBlittable() const {
+			return false;
+		}
+	};
+}
+
+#include "ArrayReader.hpp"
+
+#endif
@@ -0,0 +1,109 @@
+#include "ContentTypeReader.hpp"
+#include "ContentTypeReaderManager.hpp"
+#include "ContentReaders/BoundingBoxReader.hpp"
+#include "ContentReaders/ColorReader.hpp"
+#include "ContentReaders/CurveReader.hpp"
+#include "ContentReaders/MatrixReader.hpp"
+#include "ContentReaders/Vector3Reader.hpp"
+
+using std::shared_ptr;
+using std::string;
+
+//Private
+namespace Xna {
+	namespace {
+		string const arrayReaderPrefix = "Microsoft.Xna.Framework.Content.ArrayReader`1[[";
+		string const arrayReaderSuffix = "]]";
+	}
+}
+
+//Constructors
+namespace Xna {
+	ContentTypeReaderManager::ContentTypeReaderManager() {
+		AddTypeReader(std::make_shared<BoundingBoxReader>());
+		AddTypeReader(std::make_shared<ColorReader>());
+		AddTypeReader(std::make_shared<CurveReader>());
+		AddTypeReader(std::make_shared<MatrixReader>());
+		AddTypeReader(std::make_shared<Vector3Reader>());
+	}
+}
+
+//Functions
+namespace Xna {
+	void ContentTypeReaderManager::AddTypeReader(shared_ptr<ContentTypeReader> const& reader) {
+		if (!reader)
+			return;
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		_readers[reader->ReaderName()] = reader;
+	}
+
+	shared_ptr<ContentTypeReader> ContentTypeReaderManager::GetTypeReader(string const& readerName) {
+		auto name = StripAssemblyQualifiers(readerName);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _readers.find(name);
+
+		if (it != _readers.end())
+			return it->second;
+
+		// Array readers are created on first use from the reader of their element type.
+		if (name.size() <= arrayReaderPrefix.size() + arrayReaderSuffix.size()
+			|| name.compare(0, arrayReaderPrefix.size(), arrayReaderPrefix) != 0
+			|| name.compare(name.size() - arrayReaderSuffix.size(), arrayReaderSuffix.size(), arrayReaderSuffix) != 0)
+			return nullptr;
+
+		auto elementName = name.substr(arrayReaderPrefix.size(), name.size() - arrayReaderPrefix.size() - arrayReaderSuffix.size());
+
+		for (auto const& entry : _readers) {
+			if (entry.second->TargetName() != elementName)
+				continue;
+
+			auto reader = entry.second->CreateArrayReader();
+
+			if (reader)
+				_readers[name] = reader;
+
+			return reader;
+		}
+
+		return nullptr;
+	}
+}
+
+//Static
+namespace Xna {
+	string ContentTypeReaderManager::StripAssemblyQualifiers(string const& typeName) {
+		string result;
+		result.reserve(typeName.size());
+		int32_t depth = 0;
+
+		for (size_t i = 0; i < typeName.size(); ++i) {
+			auto c = typeName[i];
+
+			if (c == '[') {
+				++depth;
+			}
+			else if (c == ']') {
+				--depth;
+			}
+			else if (c == ',') {
+				// Top level: the rest qualifies the type itself. Inside a generic argument: skip to its closing bracket.
+				// Commas directly inside the argument list separate arguments and are kept.
+				if (depth <= 0)
+					break;
+
+				if (depth >= 2) {
+					while (i + 1 < typeName.size() && typeName[i + 1] != ']')
+						++i;
+
+					continue;
+				}
+			}
+
+			result += c;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,34 @@
+#ifndef _CONTENTTYPEREADERMANAGER_HPP_
+#define _CONTENTTYPEREADERMANAGER_HPP_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Xna {
+
+	class ContentTypeReader;
+
+	// Resolves the reader names found in XNB headers. The built-in readers cover Vector3, Matrix,
+	// BoundingBox, Curve and Color, plus ArrayReader`1 of any registered reader that supports arrays.
+	class ContentTypeReaderManager {
+	public:
+		ContentTypeReaderManager();
+
+		// Registers or replaces the reader for reader->ReaderName().
+		void AddTypeReader(std::shared_ptr<ContentTypeReader> const& reader);
+
+		// Accepts assembly qualified names. Returns nullptr for unknown readers.
+		std::shared_ptr<ContentTypeReader> GetTypeReader(std::string const& readerName);
+
+		// Drops assembly, version, culture and key qualifiers, including those of generic arguments.
+		static std::string StripAssemblyQualifiers(std::string const& typeName);
+
+	private:
+		std::unordered_map<std::string, std::shared_ptr<ContentTypeReader>> _readers;
+		std::mutex _mutex;
+	};
+}
+
+#endif
@@ -0,0 +1,81 @@
+#include <cstring>
+#include "Lz4Decoder.hpp"
+
+//Private
+namespace Xna {
+	namespace {
+		// Lengths of 15 continue in following bytes, each adding up to 255.
+		bool readLength(uint8_t const* input, size_t inputLength, size_t& position, size_t& length) {
+			uint8_t value;
+
+			do {
+				if (position >= inputLength)
+					return false;
+
+				value = input[position++];
+				length += value;
+			} while (value == 255);
+
+			return true;
+		}
+	}
+}
+
+//Static
+namespace Xna {
+	bool Lz4Decoder::Decompress(uint8_t const* input, size_t inputLength, uint8_t* output, size_t outputLength) {
+		size_t position = 0;
+		size_t written = 0;
+
+		while (position < inputLength) {
+			auto token = input[position++];
+			size_t literalLength = token >> 4;
+
+			if (literalLength == 15 && !readLength(input, inputLength, position, literalLength))
+				return false;
+
+			if (literalLength > inputLength - position || literalLength > outputLength - written)
+				return false;
+
+			std::memcpy(output + written, input + position, literalLength);
+			position += literalLength;
+			written += literalLength;
+
+			// The last sequence carries literals only.
+			if (position == inputLength)
+				break;
+
+			if (position + 2 > inputLength)
+				return false;
+
+			size_t offset = input[position] | (static_cast<size_t>(input[position + 1]) << 8);
+			position += 2;
+
+			size_t matchLength = token & 0xF;
+
+			if (matchLength == 15 && !readLength(input, inputLength, position, matchLength))
+				return false;
+
+			matchLength += 4;
+
+			if (offset == 0 || offset > written || matchLength > outputLength - written)
+				return false;
+
+			auto destination = output + written;
+			auto source = destination - offset;
+
+			if (offset >= matchLength) {
+				std::memcpy(destination, source, matchLength);
+			}
+			else {
+				// Overlapping matches repeat the last offset bytes.
+				for (size_t i = 0; i < matchLength; ++i)
+					destination[i] = source[i];
+			}
+
+			written += matchLength;
+		}
+
+		return written == outputLength;
+	}
+}
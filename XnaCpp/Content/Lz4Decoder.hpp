@@ -0,0 +1,18 @@
+#ifndef _LZ4DECODER_HPP_
+#define _LZ4DECODER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Xna {
+
+	// Decoder for the raw LZ4 sequence stream MonoGame writes into compressed XNB files.
+	class Lz4Decoder {
+	public:
+		// Decodes sequences until the input is consumed, writing straight into output.
+		// Returns false on malformed data or when the result does not fill exactly outputLength bytes.
+		static bool Decompress(uint8_t const* input, size_t inputLength, uint8_t* output, size_t outputLength);
+	};
+}
+
+#endif
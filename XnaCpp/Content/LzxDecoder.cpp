@@ -0,0 +1,622 @@
+#include <algorithm>
+#include <cstring>
+#include "LzxDecoder.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		constexpr uint32_t MinMatch = 2;
+		constexpr uint32_t NumChars = 256;
+		constexpr uint32_t NumPrimaryLengths = 7;
+		constexpr uint32_t NumSecondaryLengths = 249;
+
+		constexpr uint32_t BlockTypeInvalid = 0;
+		constexpr uint32_t BlockTypeVerbatim = 1;
+		constexpr uint32_t BlockTypeAligned = 2;
+		constexpr uint32_t BlockTypeUncompressed = 3;
+
+		constexpr uint32_t PretreeMaxSymbols = 20;
+		constexpr uint32_t PretreeTableBits = 6;
+		constexpr uint32_t MaintreeMaxSymbols = NumChars + 50 * 8;
+		constexpr uint32_t MaintreeTableBits = 12;
+		constexpr uint32_t LengthMaxSymbols = NumSecondaryLengths + 1;
+		constexpr uint32_t LengthTableBits = 12;
+		constexpr uint32_t AlignedMaxSymbols = 8;
+		constexpr uint32_t AlignedTableBits = 7;
+		constexpr uint32_t LengthTableSafety = 64;
+
+		struct PositionTables {
+			uint8_t ExtraBits[52]{};
+			uint32_t PositionBase[51]{};
+
+			PositionTables() {
+				for (int32_t i = 0, j = 0; i <= 50; i += 2) {
+					ExtraBits[i] = ExtraBits[i + 1] = static_cast<uint8_t>(j);
+
+					if (i != 0 && j < 17)
+						++j;
+				}
+
+				for (int32_t i = 0, j = 0; i <= 50; ++i) {
+					PositionBase[i] = static_cast<uint32_t>(j);
+					j += 1 << ExtraBits[i];
+				}
+			}
+		};
+
+		PositionTables const& positionTables() {
+			static PositionTables const tables;
+			return tables;
+		}
+
+		// Builds a canonical Huffman lookup table; codes longer than bits continue as a binary tree
+		// stored after the direct entries. Returns false for an over-subscribed or incomplete code.
+		bool makeDecodeTable(uint32_t symbols, uint32_t bits, vector<uint8_t> const& lengths, vector<uint16_t>& table) {
+			uint32_t position = 0;
+			uint32_t tableMask = 1u << bits;
+			uint32_t bitMask = tableMask >> 1;
+			uint32_t nextSymbol = bitMask;
+			uint32_t bitNumber = 1;
+
+			for (; bitNumber <= bits; ++bitNumber, bitMask >>= 1) {
+				for (uint32_t symbol = 0; symbol < symbols; ++symbol) {
+					if (lengths[symbol] != bitNumber)
+						continue;
+
+					auto leaf = position;
+
+					if ((position += bitMask) > tableMask)
+						return false;
+
+					for (auto fill = bitMask; fill > 0; --fill)
+						table[leaf++] = static_cast<uint16_t>(symbol);
+				}
+			}
+
+			if (position != tableMask) {
+				for (auto symbol = position; symbol < tableMask; ++symbol)
+					table[symbol] = 0;
+
+				position <<= 16;
+				tableMask <<= 16;
+				bitMask = 1u << 15;
+
+				for (; bitNumber <= 16; ++bitNumber, bitMask >>= 1) {
+					for (uint32_t symbol = 0; symbol < symbols; ++symbol) {
+						if (lengths[symbol] != bitNumber)
+							continue;
+
+						auto leaf = position >> 16;
+
+						for (uint32_t fill = 0; fill < bitNumber - bits; ++fill) {
+							if (table[leaf] == 0) {
+								if ((nextSymbol << 1) + 1 >= table.size())
+									return false;
+
+								table[nextSymbol << 1] = 0;
+								table[(nextSymbol << 1) + 1] = 0;
+								table[leaf] = static_cast<uint16_t>(nextSymbol++);
+							}
+
+							leaf = static_cast<uint32_t>(table[leaf]) << 1;
+
+							if ((position >> (15 - fill)) & 1)
+								++leaf;
+						}
+
+						table[leaf] = static_cast<uint16_t>(symbol);
+
+						if ((position += bitMask) > tableMask)
+							return false;
+					}
+				}
+			}
+
+			if (position == tableMask)
+				return true;
+
+			// An empty code is allowed, anything else that does not fill the table is not.
+			for (uint32_t symbol = 0; symbol < symbols; ++symbol) {
+				if (lengths[symbol] != 0)
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	// Reads 16 bit little-endian words most significant bit first. Reads past the end yield zeros
+	// but still advance Position, so callers can detect overruns.
+	class LzxDecoder::BitBuffer {
+	public:
+		size_t Position{ 0 };
+
+		BitBuffer(uint8_t const* data, size_t length) :
+			_data(data), _length(length) {}
+
+		void Initialize() {
+			_buffer = 0;
+			_bitsLeft = 0;
+		}
+
+		void EnsureBits(uint32_t bits) {
+			while (_bitsLeft < bits) {
+				uint32_t lo = readByte();
+				uint32_t hi = readByte();
+				_buffer |= ((hi << 8) | lo) << (32 - 16 - _bitsLeft);
+				_bitsLeft += 16;
+			}
+		}
+
+		uint32_t PeekBits(uint32_t bits) const {
+			return _buffer >> (32 - bits);
+		}
+
+		void RemoveBits(uint32_t bits) {
+			_buffer <<= bits;
+			_bitsLeft -= bits;
+		}
+
+		uint32_t ReadBits(uint32_t bits) {
+			if (bits == 0)
+				return 0;
+
+			EnsureBits(bits);
+			auto result = PeekBits(bits);
+			RemoveBits(bits);
+
+			return result;
+		}
+
+		uint32_t BitsLeft() const {
+			return _bitsLeft;
+		}
+
+		bool ReadSymbol(vector<uint16_t> const& table, vector<uint8_t> const& lengths, uint32_t symbols, uint32_t bits, uint32_t& symbol) {
+			EnsureBits(16);
+			uint32_t i = table[PeekBits(bits)];
+
+			if (i >= symbols) {
+				uint32_t j = 1u << (32 - bits);
+
+				do {
+					j >>= 1;
+
+					if (j == 0)
+						return false;
+
+					i = (i << 1) | ((_buffer & j) != 0 ? 1u : 0u);
+
+					if (i >= table.size())
+						return false;
+				} while ((i = table[i]) >= symbols);
+			}
+
+			RemoveBits(lengths[i]);
+			symbol = i;
+
+			return true;
+		}
+
+		uint8_t ReadByte() {
+			return readByte();
+		}
+
+	private:
+		uint8_t const* _data{ nullptr };
+		size_t _length{ 0 };
+		uint32_t _buffer{ 0 };
+		uint32_t _bitsLeft{ 0 };
+
+		uint8_t readByte() {
+			auto position = Position++;
+			return position < _length ? _data[position] : 0;
+		}
+	};
+}
+
+//Constructors
+namespace Xna {
+	LzxDecoder::LzxDecoder(int32_t window) {
+		window = std::clamp(window, 15, 21);
+
+		_windowSize = 1u << window;
+		_window.assign(_windowSize, 0xDC);
+
+		uint32_t positionSlots = window == 20 ? 42 : window == 21 ? 50 : static_cast<uint32_t>(window) << 1;
+		_mainElements = NumChars + (positionSlots << 3);
+
+		_pretreeTable.assign((1 << PretreeTableBits) + (PretreeMaxSymbols << 1), 0);
+		_pretreeLengths.assign(PretreeMaxSymbols + LengthTableSafety, 0);
+		_maintreeTable.assign((1 << MaintreeTableBits) + (MaintreeMaxSymbols << 1), 0);
+		_maintreeLengths.assign(MaintreeMaxSymbols + LengthTableSafety, 0);
+		_lengthTable.assign((1 << LengthTableBits) + (LengthMaxSymbols << 1), 0);
+		_lengthLengths.assign(LengthMaxSymbols + LengthTableSafety, 0);
+		_alignedTable.assign((1 << AlignedTableBits) + (AlignedMaxSymbols << 1), 0);
+		_alignedLengths.assign(AlignedMaxSymbols + LengthTableSafety, 0);
+	}
+}
+
+//Functions
+namespace Xna {
+	bool LzxDecoder::Decompress(uint8_t const* input, size_t inputLength, uint8_t* output, size_t outputLength) {
+		if (outputLength > _windowSize)
+			return false;
+
+		auto const& tables = positionTables();
+		BitBuffer bits(input, inputLength);
+
+		auto window = _window.data();
+		auto windowPosition = _windowPosition;
+		auto windowSize = _windowSize;
+		auto r0 = _r0;
+		auto r1 = _r1;
+		auto r2 = _r2;
+		auto togo = static_cast<int64_t>(outputLength);
+
+		if (!_headerRead) {
+			if (bits.ReadBits(1) != 0) {
+				auto hi = bits.ReadBits(16);
+				auto lo = bits.ReadBits(16);
+				_intelFileSize = static_cast<int32_t>((hi << 16) | lo);
+			}
+
+			_headerRead = true;
+		}
+
+		while (togo > 0) {
+			if (_blockRemaining == 0) {
+				if (_blockType == BlockTypeUncompressed) {
+					// Uncompressed blocks are padded to a 16 bit boundary.
+					if (_blockLength & 1)
+						bits.ReadByte();
+
+					bits.Initialize();
+				}
+
+				_blockType = bits.ReadBits(3);
+				auto hi = bits.ReadBits(16);
+				auto lo = bits.ReadBits(8);
+				_blockRemaining = _blockLength = (hi << 8) | lo;
+
+				switch (_blockType) {
+				case BlockTypeAligned:
+					for (uint32_t i = 0; i < 8; ++i)
+						_alignedLengths[i] = static_cast<uint8_t>(bits.ReadBits(3));
+
+					if (!makeDecodeTable(AlignedMaxSymbols, AlignedTableBits, _alignedLengths, _alignedTable))
+						return false;
+
+					[[fallthrough]];
+				case BlockTypeVerbatim:
+					if (!readLengths(_maintreeLengths, 0, 256, bits) || !readLengths(_maintreeLengths, 256, _mainElements, bits))
+						return false;
+
+					if (!makeDecodeTable(MaintreeMaxSymbols, MaintreeTableBits, _maintreeLengths, _maintreeTable))
+						return false;
+
+					if (_maintreeLengths[0xE8] != 0)
+						_intelStarted = true;
+
+					if (!readLengths(_lengthLengths, 0, NumSecondaryLengths, bits))
+						return false;
+
+					if (!makeDecodeTable(LengthMaxSymbols, LengthTableBits, _lengthLengths, _lengthTable))
+						return false;
+
+					break;
+				case BlockTypeUncompressed: {
+					_intelStarted = true;
+
+					// Realign to the byte stream; up to 16 padding bits may already be buffered.
+					bits.EnsureBits(16);
+
+					if (bits.BitsLeft() > 16)
+						bits.Position -= 2;
+
+					uint32_t registers[3];
+
+					for (auto& value : registers) {
+						value = bits.ReadByte();
+						value |= static_cast<uint32_t>(bits.ReadByte()) << 8;
+						value |= static_cast<uint32_t>(bits.ReadByte()) << 16;
+						value |= static_cast<uint32_t>(bits.ReadByte()) << 24;
+					}
+
+					r0 = registers[0];
+					r1 = registers[1];
+					r2 = registers[2];
+					break;
+				}
+				default:
+					return false;
+				}
+			}
+
+			// Building the tables may read up to 16 bits past a short final run; more than that is corrupt data.
+			if (bits.Position > inputLength && (bits.Position > inputLength + 2 || bits.BitsLeft() < 16))
+				return false;
+
+			int64_t run;
+
+			while ((run = _blockRemaining) > 0 && togo > 0) {
+				if (run > togo)
+					run = togo;
+
+				togo -= run;
+				_blockRemaining -= static_cast<uint32_t>(run);
+
+				windowPosition &= windowSize - 1;
+
+				// Runs never straddle the window wraparound.
+				if (windowPosition + run > windowSize)
+					return false;
+
+				if (_blockType == BlockTypeUncompressed) {
+					if (bits.Position + run > inputLength)
+						return false;
+
+					std::memcpy(window + windowPosition, input + bits.Position, static_cast<size_t>(run));
+					bits.Position += static_cast<size_t>(run);
+					windowPosition += static_cast<uint32_t>(run);
+					continue;
+				}
+
+				auto aligned = _blockType == BlockTypeAligned;
+
+				while (run > 0) {
+					uint32_t mainElement;
+
+					if (!bits.ReadSymbol(_maintreeTable, _maintreeLengths, MaintreeMaxSymbols, MaintreeTableBits, mainElement))
+						return false;
+
+					if (mainElement < NumChars) {
+						window[windowPosition++] = static_cast<uint8_t>(mainElement);
+						--run;
+						continue;
+					}
+
+					// Match: NUM_CHARS + ((slot << 3) | length header).
+					mainElement -= NumChars;
+					int64_t matchLength = mainElement & NumPrimaryLengths;
+
+					if (matchLength == NumPrimaryLengths) {
+						uint32_t lengthFooter;
+
+						if (!bits.ReadSymbol(_lengthTable, _lengthLengths, LengthMaxSymbols, LengthTableBits, lengthFooter))
+							return false;
+
+						matchLength += lengthFooter;
+					}
+
+					matchLength += MinMatch;
+					uint32_t matchOffset = mainElement >> 3;
+
+					if (matchOffset > 2) {
+						uint32_t extra = tables.ExtraBits[matchOffset];
+
+						if (!aligned) {
+							matchOffset = matchOffset != 3 ? tables.PositionBase[matchOffset] - 2 + bits.ReadBits(extra) : 1;
+						}
+						else {
+							matchOffset = tables.PositionBase[matchOffset] - 2;
+
+							if (extra >= 3) {
+								if (extra > 3)
+									matchOffset += bits.ReadBits(extra - 3) << 3;
+
+								uint32_t alignedBits;
+
+								if (!bits.ReadSymbol(_alignedTable, _alignedLengths, AlignedMaxSymbols, AlignedTableBits, alignedBits))
+									return false;
+
+								matchOffset += alignedBits;
+							}
+							else if (extra > 0) {
+								matchOffset += bits.ReadBits(extra);
+							}
+							else {
+								matchOffset = 1;
+							}
+						}
+
+						r2 = r1;
+						r1 = r0;
+						r0 = matchOffset;
+					}
+					else if (matchOffset == 0) {
+						matchOffset = r0;
+					}
+					else if (matchOffset == 1) {
+						matchOffset = r1;
+						r1 = r0;
+						r0 = matchOffset;
+					}
+					else {
+						matchOffset = r2;
+						r2 = r0;
+						r0 = matchOffset;
+					}
+
+					if (matchOffset == 0 || matchOffset > windowSize || matchLength > run)
+						return false;
+
+					auto destination = windowPosition;
+					uint32_t source;
+					run -= matchLength;
+
+					if (windowPosition >= matchOffset) {
+						source = destination - matchOffset;
+					}
+					else {
+						// The match starts before the window wrapped around; copy that part first.
+						source = destination + (windowSize - matchOffset);
+						int64_t copyLength = matchOffset - windowPosition;
+
+						if (copyLength < matchLength) {
+							matchLength -= copyLength;
+							windowPosition += static_cast<uint32_t>(copyLength);
+
+							while (copyLength-- > 0)
+								window[destination++] = window[source++];
+
+							source = 0;
+						}
+					}
+
+					windowPosition += static_cast<uint32_t>(matchLength);
+
+					// Byte by byte on purpose: overlapping matches repeat the bytes just written.
+					while (matchLength-- > 0)
+						window[destination++] = window[source++];
+				}
+			}
+		}
+
+		if (togo != 0)
+			return false;
+
+		auto start = windowPosition == 0 ? windowSize : windowPosition;
+		start -= static_cast<uint32_t>(outputLength);
+		std::memcpy(output, window + start, outputLength);
+
+		_windowPosition = windowPosition;
+		_r0 = r0;
+		_r1 = r1;
+		_r2 = r2;
+
+		intelE8Decode(output, outputLength);
+
+		return true;
+	}
+}
+
+//Static
+namespace Xna {
+	bool LzxDecoder::DecompressXnb(uint8_t const* input, size_t inputLength, uint8_t* output, size_t outputLength) {
+		LzxDecoder decoder(16);
+		size_t position = 0;
+		size_t written = 0;
+
+		while (position + 2 <= inputLength) {
+			// Each block starts with its compressed size, or 0xFF followed by the frame and block sizes.
+			uint32_t hi = input[position];
+			uint32_t lo = input[position + 1];
+			uint32_t blockSize = (hi << 8) | lo;
+			uint32_t frameSize = 0x8000;
+
+			if (hi == 0xFF) {
+				if (position + 5 > inputLength)
+					return false;
+
+				frameSize = (static_cast<uint32_t>(input[position + 1]) << 8) | input[position + 2];
+				blockSize = (static_cast<uint32_t>(input[position + 3]) << 8) | input[position + 4];
+				position += 5;
+			}
+			else {
+				position += 2;
+			}
+
+			if (blockSize == 0 || frameSize == 0)
+				break;
+
+			if (position + blockSize > inputLength || written + frameSize > outputLength)
+				return false;
+
+			if (!decoder.Decompress(input + position, blockSize, output + written, frameSize))
+				return false;
+
+			position += blockSize;
+			written += frameSize;
+		}
+
+		return written == outputLength;
+	}
+}
+
+//Private
+namespace Xna {
+	bool LzxDecoder::readLengths(vector<uint8_t>& lengths, uint32_t first, uint32_t last, BitBuffer& bits) {
+		for (uint32_t i = 0; i < PretreeMaxSymbols; ++i)
+			_pretreeLengths[i] = static_cast<uint8_t>(bits.ReadBits(4));
+
+		if (!makeDecodeTable(PretreeMaxSymbols, PretreeTableBits, _pretreeLengths, _pretreeTable))
+			return false;
+
+		for (auto x = first; x < last;) {
+			uint32_t symbol;
+
+			if (!bits.ReadSymbol(_pretreeTable, _pretreeLengths, PretreeMaxSymbols, PretreeTableBits, symbol))
+				return false;
+
+			uint32_t count = 1;
+			int32_t value;
+
+			if (symbol == 17) {
+				count = bits.ReadBits(4) + 4;
+				value = 0;
+			}
+			else if (symbol == 18) {
+				count = bits.ReadBits(5) + 20;
+				value = 0;
+			}
+			else {
+				if (symbol == 19) {
+					count = bits.ReadBits(1) + 4;
+
+					if (!bits.ReadSymbol(_pretreeTable, _pretreeLengths, PretreeMaxSymbols, PretreeTableBits, symbol))
+						return false;
+				}
+
+				// Lengths are coded as deltas modulo 17 against the previous table.
+				value = lengths[x] - static_cast<int32_t>(symbol);
+
+				if (value < 0)
+					value += 17;
+			}
+
+			if (x + count > lengths.size())
+				return false;
+
+			while (count-- > 0)
+				lengths[x++] = static_cast<uint8_t>(value);
+		}
+
+		return true;
+	}
+
+	void LzxDecoder::intelE8Decode(uint8_t* output, size_t outputLength) {
+		// Undoes the x86 CALL translation; XNB content normally leaves it disabled.
+		auto frame = _framesRead++;
+		auto currentPosition = _intelCurrentPosition;
+		_intelCurrentPosition += static_cast<int32_t>(outputLength);
+
+		if (!_intelStarted || _intelFileSize == 0 || frame >= 32768 || outputLength <= 10)
+			return;
+
+		auto data = output;
+		auto end = output + outputLength - 10;
+
+		while (data < end) {
+			if (*data++ != 0xE8) {
+				++currentPosition;
+				continue;
+			}
+
+			auto absolute = static_cast<int32_t>(data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24));
+
+			if (absolute >= -currentPosition && absolute < _intelFileSize) {
+				auto relative = absolute >= 0 ? absolute - currentPosition : absolute + _intelFileSize;
+				data[0] = static_cast<uint8_t>(relative);
+				data[1] = static_cast<uint8_t>(relative >> 8);
+				data[2] = static_cast<uint8_t>(relative >> 16);
+				data[3] = static_cast<uint8_t>(relative >> 24);
+			}
+
+			data += 4;
+			currentPosition += 5;
+		}
+	}
+}
@@ -0,0 +1,58 @@
+#ifndef _LZXDECODER_HPP_
+#define _LZXDECODER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+
+	// Port of the libmspack derived LZX decoder used for compressed XNB files.
+	// Decoding state carries over between frames, so frames must be fed in order to one instance.
+	class LzxDecoder {
+	public:
+		// window is the log2 of the sliding window size, 15 to 21; XNB files use 16. Other values are clamped.
+		LzxDecoder(int32_t window = 16);
+
+		// Decodes one compressed block of inputLength bytes into exactly outputLength bytes.
+		// Returns false on malformed data.
+		bool Decompress(uint8_t const* input, size_t inputLength, uint8_t* output, size_t outputLength);
+
+		// Decodes an XNB payload: a sequence of blocks, each prefixed by its big-endian sizes.
+		// Frames are written straight into the destination as they are decoded.
+		static bool DecompressXnb(uint8_t const* input, size_t inputLength, uint8_t* output, size_t outputLength);
+
+	private:
+		class BitBuffer;
+
+		std::vector<uint8_t> _window;
+		uint32_t _windowSize{ 0 };
+		uint32_t _windowPosition{ 0 };
+		uint32_t _r0{ 1 };
+		uint32_t _r1{ 1 };
+		uint32_t _r2{ 1 };
+		uint32_t _mainElements{ 0 };
+		uint32_t _blockType{ 0 };
+		uint32_t _blockLength{ 0 };
+		uint32_t _blockRemaining{ 0 };
+		uint32_t _framesRead{ 0 };
+		int32_t _intelFileSize{ 0 };
+		int32_t _intelCurrentPosition{ 0 };
+		bool _headerRead{ false };
+		bool _intelStarted{ false };
+
+		std::vector<uint16_t> _pretreeTable;
+		std::vector<uint8_t> _pretreeLengths;
+		std::vector<uint16_t> _maintreeTable;
+		std::vector<uint8_t> _maintreeLengths;
+		std::vector<uint16_t> _lengthTable;
+		std::vector<uint8_t> _lengthLengths;
+		std::vector<uint16_t> _alignedTable;
+		std::vector<uint8_t> _alignedLengths;
+
+		bool readLengths(std::vector<uint8_t>& lengths, uint32_t first, uint32_t last, BitBuffer& bits);
+		void intelE8Decode(uint8_t* output, size_t outputLength);
+	};
+}
+
+#endif
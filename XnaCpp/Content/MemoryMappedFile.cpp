@@ -0,0 +1,193 @@
+#include <utility>
+#include "MemoryMappedFile.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//Constructors
+namespace Xna {
+	MemoryMappedFile::MemoryMappedFile() {}
+
+	MemoryMappedFile::MemoryMappedFile(std::string const& path) {
+		Open(path);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		Close();
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept {
+		*this = std::move(other);
+	}
+}
+
+//Operators
+namespace Xna {
+	MemoryMappedFile& MemoryMappedFile::operator =(MemoryMappedFile&& other) noexcept {
+		if (this == &other)
+			return *this;
+
+		Close();
+
+		_data = std::exchange(other._data, nullptr);
+		_size = std::exchange(other._size, 0);
+#if defined(_WIN32)
+		_file = std::exchange(other._file, nullptr);
+		_mapping = std::exchange(other._mapping, nullptr);
+#else
+		_file = std::exchange(other._file, -1);
+#endif
+		_isOpen = std::exchange(other._isOpen, false);
+
+		return *this;
+	}
+}
+
+//Functions
+namespace Xna {
+	bool MemoryMappedFile::Open(std::string const& path) {
+		Close();
+
+#if defined(_WIN32)
+		auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+
+		if (!GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			return false;
+		}
+
+		_file = file;
+		_size = static_cast<size_t>(size.QuadPart);
+
+		// Empty files cannot be mapped but are still valid.
+		if (_size != 0) {
+			_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+			if (_mapping)
+				_data = static_cast<uint8_t const*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+
+			if (!_data) {
+				Close();
+				return false;
+			}
+		}
+#else
+		auto file = ::open(path.c_str(), O_RDONLY);
+
+		if (file < 0)
+			return false;
+
+		struct stat status;
+
+		if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode)) {
+			::close(file);
+			return false;
+		}
+
+		_file = file;
+		_size = static_cast<size_t>(status.st_size);
+
+		if (_size != 0) {
+			auto data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+
+			if (data == MAP_FAILED) {
+				Close();
+				return false;
+			}
+
+			// Content is parsed front to back exactly once.
+			madvise(data, _size, MADV_SEQUENTIAL);
+			_data = static_cast<uint8_t const*>(data);
+		}
+#endif
+
+		_isOpen = true;
+		return true;
+	}
+
+	void MemoryMappedFile::Close() {
+#if defined(_WIN32)
+		if (_data)
+			UnmapViewOfFile(_data);
+
+		if (_mapping)
+			CloseHandle(_mapping);
+
+		if (_file)
+			CloseHandle(_file);
+
+		_mapping = nullptr;
+		_file = nullptr;
+#else
+		if (_data)
+			munmap(const_cast<uint8_t*>(_data), _size);
+
+		if (_file >= 0)
+			::close(_file);
+
+		_file = -1;
+#endif
+		_data = nullptr;
+		_size = 0;
+		_isOpen = false;
+	}
+
+	bool MemoryMappedFile::IsOpen() const {
+		return _isOpen;
+	}
+
+	uint8_t const* MemoryMappedFile::Data() const {
+		return _data;
+	}
+
+	size_t MemoryMappedFile::Size() const {
+		return _size;
+	}
+}
+
+//Static
+namespace Xna {
+	bool MemoryMappedFile::Evict(std::string const& path) {
+#if defined(_WIN32)
+		// Opening the file unbuffered makes the cache manager purge its cached pages.
+		auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+			FILE_FLAG_NO_BUFFERING, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		CloseHandle(file);
+		return true;
+#elif defined(POSIX_FADV_DONTNEED)
+		auto file = ::open(path.c_str(), O_RDONLY);
+
+		if (file < 0)
+			return false;
+
+		// Dirty pages are not dropped, so a freshly written file is flushed first.
+		fdatasync(file);
+		auto result = posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+		::close(file);
+
+		return result == 0;
+#else
+		(void)path;
+		return false;
+#endif
+	}
+}
@@ -0,0 +1,46 @@
+#ifndef _MEMORYMAPPEDFILE_HPP_
+#define _MEMORYMAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Xna {
+
+	// Read-only view of a whole file. The mapping lives as long as the object; IsOpen() reports failure.
+	class MemoryMappedFile {
+	public:
+		MemoryMappedFile();
+		MemoryMappedFile(std::string const& path);
+		~MemoryMappedFile();
+
+		MemoryMappedFile(MemoryMappedFile const&) = delete;
+		MemoryMappedFile& operator =(MemoryMappedFile const&) = delete;
+		MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+		MemoryMappedFile& operator =(MemoryMappedFile&& other) noexcept;
+
+		bool Open(std::string const& path);
+		void Close();
+
+		bool IsOpen() const;
+		uint8_t const* Data() const;
+		size_t Size() const;
+
+		// Drops the file's pages from the OS file cache, so that the next read comes from disk. Returns false where
+		// the platform offers no way to do so. Pages still mapped elsewhere may stay resident.
+		static bool Evict(std::string const& path);
+
+	private:
+		uint8_t const* _data{ nullptr };
+		size_t _size{ 0 };
+#if defined(_WIN32)
+		void* _file{ nullptr };
+		void* _mapping{ nullptr };
+#else
+		int _file{ -1 };
+#endif
+		bool _isOpen{ false };
+	};
+}
+
+#endif
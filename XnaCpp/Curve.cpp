@@ -1,6 +1,7 @@
 #include <cmath>
 #include "Curve.hpp"
 #include "MathHelper.hpp"
+#include "Profiler.hpp"
 
 namespace Xna {
 	Curve::Curve() {}
@@ -31,6 +32,10 @@ namespace Xna {
 		return _keys;
 	}
 
+	CurveKeyCollection& Curve::Keys() {
+		return _keys;
+	}
+
 	Curve Curve::Clone() {
 		Curve curve;
 		curve._keys = _keys.Clone();
@@ -41,6 +46,8 @@ namespace Xna {
 	}
 
 	float Curve::Evaluate(float position) {
+		XNA_PROFILE_ZONE("Curve::Evaluate");
+
         if (_keys.Count() == 0) {
             return 0.f;
         }
@@ -21,6 +21,7 @@ namespace Xna {
 		CurveLoopType PostLoop() const;
 		void PostLoop(CurveLoopType const& value);
 		CurveKeyCollection Keys() const;
+		CurveKeyCollection& Keys();
 		Curve Clone();
 		float Evaluate(float position);
 		void ComputeTangents(CurveTangent const& tangentType);
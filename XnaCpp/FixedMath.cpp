@@ -0,0 +1,413 @@
+#include "FixedMath.hpp"
+#include <array>
+
+//Private
+namespace Xna {
+	namespace {
+		// Angles inside the trigonometric functions are Q2.30 radians, or 32-bit binary angles (2^32 per turn).
+		constexpr int32_t angleBits = 30;
+		constexpr int64_t angleOne = int64_t(1) << angleBits;
+		constexpr int64_t pi60 = 0x3243F6A8885A308D;
+		constexpr int32_t sineTableBits = 10;
+		constexpr int32_t sineTableSize = 1 << sineTableBits;
+
+		// sin(i Pi / 2048) for i in [0, 1024], from the Taylor series evaluated in Q2.30.
+		constexpr std::array<int32_t, sineTableSize + 1> createSineTable() {
+			std::array<int32_t, sineTableSize + 1> table{};
+
+			for (int32_t i = 1; i < sineTableSize; ++i) {
+				auto angle = ((pi60 >> 20) * i + (int64_t(1) << 20)) >> 21;
+				auto square = (angle * angle) >> angleBits;
+				auto term = angle;
+				auto sum = angle;
+
+				for (int64_t k = 1; term != 0; ++k) {
+					term = -((term * square) >> angleBits) / ((2 * k) * (2 * k + 1));
+					sum += term;
+				}
+
+				table[i] = static_cast<int32_t>(sum);
+			}
+
+			table[sineTableSize] = static_cast<int32_t>(angleOne);
+			return table;
+		}
+
+		// atan(2^-i) in Q2.60 for the CORDIC iterations. The powers of 2^-i in the series are exact shifts.
+		constexpr int32_t cordicIterations = 36;
+
+		constexpr std::array<int64_t, cordicIterations> createArctangentTable() {
+			std::array<int64_t, cordicIterations> table{};
+			table[0] = pi60 / 4;
+
+			for (int32_t i = 1; i < cordicIterations; ++i) {
+				int64_t sum = 0;
+
+				for (int32_t k = 0; i * (2 * k + 1) < 60; ++k) {
+					auto term = (int64_t(1) << (60 - i * (2 * k + 1))) / (2 * k + 1);
+					sum += k % 2 ? -term : term;
+				}
+
+				table[i] = sum;
+			}
+
+			return table;
+		}
+
+		constexpr auto sineTable = createSineTable();
+		constexpr auto arctangentTable = createArctangentTable();
+
+		template <typename T>
+		T fromAngle(int64_t angle) {
+			using Raw = typename T::RawType;
+
+			if constexpr (T::FractionBits < angleBits) {
+				constexpr auto shift = angleBits - T::FractionBits;
+				return T::FromRaw(static_cast<Raw>((angle + (int64_t(1) << (shift - 1))) >> shift));
+			}
+			else {
+				return T::FromRaw(static_cast<Raw>(angle * (int64_t(1) << (T::FractionBits - angleBits))));
+			}
+		}
+
+		template <typename T>
+		T fromAngle60(int64_t angle) {
+			constexpr auto shift = 60 - T::FractionBits;
+			return T::FromRaw(static_cast<typename T::RawType>((angle + (int64_t(1) << (shift - 1))) >> shift));
+		}
+
+		// Bits [32 + F, 64 + F) of raw * 2^64 / (2 Pi) are the angle in turns as a 32-bit binary angle.
+		template <typename T>
+		uint32_t binaryAngle(T angle) {
+			constexpr uint64_t inverseTwoPi = 2935890503282001226ULL;
+			constexpr auto shift = 32 + T::FractionBits;
+			auto value = static_cast<uint64_t>(static_cast<int64_t>(angle.Raw));
+
+			auto low = (value & 0xFFFFFFFF) * (inverseTwoPi & 0xFFFFFFFF);
+			auto middle1 = (value >> 32) * (inverseTwoPi & 0xFFFFFFFF);
+			auto middle2 = (value & 0xFFFFFFFF) * (inverseTwoPi >> 32);
+			auto high = (value >> 32) * (inverseTwoPi >> 32);
+			auto carry = (low >> 32) + (middle1 & 0xFFFFFFFF) + (middle2 & 0xFFFFFFFF);
+			low = (low & 0xFFFFFFFF) | (carry << 32);
+			high += (middle1 >> 32) + (middle2 >> 32) + (carry >> 32);
+
+			// The unsigned product treated a negative raw value as raw + 2^64.
+			if (angle.Raw < 0)
+				high -= inverseTwoPi;
+
+			if constexpr (shift >= 64)
+				return static_cast<uint32_t>(high >> (shift - 64));
+			else
+				return static_cast<uint32_t>((low >> shift) | (high << (64 - shift)));
+		}
+
+		// sin(a + d) = sin(a) cos(d) + cos(a) sin(d) around the nearest lower table entry a.
+		void sinCos(uint32_t angle, int64_t& sin, int64_t& cos) {
+			constexpr int32_t fractionBits = 30 - sineTableBits;
+			constexpr int64_t twoPi30 = 6746518852;
+			auto quadrant = angle >> 30;
+			auto index = (angle >> fractionBits) & (sineTableSize - 1);
+			auto fraction = static_cast<int64_t>(angle & ((1u << fractionBits) - 1));
+
+			auto d = (fraction * twoPi30) >> 32;
+			auto square = (d * d) >> angleBits;
+			auto sinD = d - ((square * d) >> angleBits) / 6;
+			auto cosD = angleOne - square / 2;
+
+			int64_t s = sineTable[index];
+			int64_t c = sineTable[sineTableSize - index];
+			auto rounding = int64_t(1) << (angleBits - 1);
+			auto sine = (s * cosD + c * sinD + rounding) >> angleBits;
+			auto cosine = (c * cosD - s * sinD + rounding) >> angleBits;
+
+			switch (quadrant) {
+			case 0: sin = sine; cos = cosine; break;
+			case 1: sin = cosine; cos = -sine; break;
+			case 2: sin = -sine; cos = -cosine; break;
+			default: sin = -cosine; cos = sine; break;
+			}
+		}
+
+		// CORDIC vectoring on the inputs scaled to [2^59, 2^60); returns Q2.60 radians.
+		int64_t atan2(int64_t y, int64_t x) {
+			if (x == 0 && y == 0)
+				return 0;
+
+			auto absolute = [](int64_t value) { return value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value); };
+			auto magnitude = absolute(x) | absolute(y);
+			auto bits = 0;
+
+			while ((magnitude >> bits) != 0)
+				++bits;
+
+			if (bits > 60) {
+				x >>= bits - 60;
+				y >>= bits - 60;
+			}
+			else {
+				x *= int64_t(1) << (60 - bits);
+				y *= int64_t(1) << (60 - bits);
+			}
+
+			int64_t angle = 0;
+
+			if (x < 0) {
+				angle = y >= 0 ? pi60 : -pi60;
+				x = -x;
+				y = -y;
+			}
+
+			for (int32_t i = 0; i < cordicIterations; ++i) {
+				auto nextX = x;
+
+				if (y > 0) {
+					nextX += y >> i;
+					y -= x >> i;
+					angle += arctangentTable[i];
+				}
+				else {
+					nextX -= y >> i;
+					y += x >> i;
+					angle -= arctangentTable[i];
+				}
+
+				x = nextX;
+			}
+
+			return angle;
+		}
+
+		template <typename T>
+		T sqrt(T value) {
+			using Raw = typename T::RawType;
+
+			if (value.Raw <= 0)
+				return T::Zero;
+
+			auto bits = 0;
+			while ((static_cast<uint64_t>(value.Raw) >> bits) != 0)
+				++bits;
+
+			// Integer Newton iteration from above converges to floor(sqrt(Raw * 2^F)).
+			auto root = T::FromRaw(static_cast<Raw>(Raw(1) << ((bits + T::FractionBits + 1) / 2)));
+
+			while (true) {
+				auto quotient = (value / root).Raw;
+				auto next = static_cast<Raw>((root.Raw >> 1) + (quotient >> 1) + (root.Raw & quotient & 1));
+
+				if (next >= root.Raw)
+					return root;
+
+				root.Raw = next;
+			}
+		}
+
+		template <typename T>
+		void sinCos(T angle, T& sin, T& cos) {
+			int64_t s;
+			int64_t c;
+			sinCos(binaryAngle(angle), s, c);
+			sin = fromAngle<T>(s);
+			cos = fromAngle<T>(c);
+		}
+
+		uint64_t integerSqrt(uint64_t value) {
+			if (value == 0)
+				return 0;
+
+			auto bits = 0;
+			while ((value >> bits) != 0)
+				++bits;
+
+			auto root = uint64_t(1) << ((bits + 1) / 2);
+
+			while (true) {
+				auto next = (root + value / root) / 2;
+
+				if (next >= root)
+					return root;
+
+				root = next;
+			}
+		}
+
+		// The sine is taken in Q1.31 from (1 - x)(1 + x) computed exactly in 64 bits.
+		template <typename T>
+		T acos(T value) {
+			constexpr int32_t bits = 31;
+			constexpr int64_t one = int64_t(1) << bits;
+			int64_t x;
+
+			if constexpr (T::FractionBits < bits)
+				x = static_cast<int64_t>(value.Raw) * (int64_t(1) << (bits - T::FractionBits));
+			else
+				x = (static_cast<int64_t>(value.Raw) + (int64_t(1) << (T::FractionBits - bits - 1))) >> (T::FractionBits - bits);
+
+			x = x < -one ? -one : (x > one ? one : x);
+			auto sine = static_cast<int64_t>(integerSqrt(static_cast<uint64_t>((one - x) * (one + x))));
+
+			return fromAngle60<T>(atan2(sine, x));
+		}
+
+		template <typename T>
+		T wrapAngle(T angle) {
+			using Raw = typename T::RawType;
+			auto result = static_cast<Raw>(angle.Raw % T::TwoPi.Raw);
+
+			if (result <= -T::Pi.Raw)
+				result += T::TwoPi.Raw;
+			else if (result > T::Pi.Raw)
+				result -= T::TwoPi.Raw;
+
+			return T::FromRaw(result);
+		}
+
+		template <typename T>
+		T toDegrees(T radians) {
+			// 180 / Pi in Q32.32.
+			constexpr int64_t degrees32 = 246083499208;
+			constexpr auto shift = 32 - T::FractionBits;
+			auto factor = degrees32;
+
+			if constexpr (shift > 0)
+				factor = (degrees32 + (int64_t(1) << (shift - 1))) >> shift;
+
+			return radians * T::FromRaw(static_cast<typename T::RawType>(factor));
+		}
+
+		template <typename T>
+		T toRadians(T degrees) {
+			// Pi / 180 in Q2.62.
+			constexpr int64_t radians62 = 80489105089745809;
+			constexpr auto shift = 62 - T::FractionBits;
+			return degrees * T::FromRaw(static_cast<typename T::RawType>((radians62 + (int64_t(1) << (shift - 1))) >> shift));
+		}
+	}
+}
+
+//Static
+namespace Xna {
+	Fixed16 FixedMath::Abs(Fixed16 value) {
+		return value < Fixed16::Zero ? -value : value;
+	}
+
+	Fixed32 FixedMath::Abs(Fixed32 value) {
+		return value < Fixed32::Zero ? -value : value;
+	}
+
+	Fixed16 FixedMath::Min(Fixed16 value1, Fixed16 value2) {
+		return value1 < value2 ? value1 : value2;
+	}
+
+	Fixed32 FixedMath::Min(Fixed32 value1, Fixed32 value2) {
+		return value1 < value2 ? value1 : value2;
+	}
+
+	Fixed16 FixedMath::Max(Fixed16 value1, Fixed16 value2) {
+		return value1 > value2 ? value1 : value2;
+	}
+
+	Fixed32 FixedMath::Max(Fixed32 value1, Fixed32 value2) {
+		return value1 > value2 ? value1 : value2;
+	}
+
+	Fixed16 FixedMath::Clamp(Fixed16 value, Fixed16 min, Fixed16 max) {
+		return Min(Max(value, min), max);
+	}
+
+	Fixed32 FixedMath::Clamp(Fixed32 value, Fixed32 min, Fixed32 max) {
+		return Min(Max(value, min), max);
+	}
+
+	Fixed16 FixedMath::Lerp(Fixed16 value1, Fixed16 value2, Fixed16 amount) {
+		return value1 + (value2 - value1) * amount;
+	}
+
+	Fixed32 FixedMath::Lerp(Fixed32 value1, Fixed32 value2, Fixed32 amount) {
+		return value1 + (value2 - value1) * amount;
+	}
+
+	Fixed16 FixedMath::Sqrt(Fixed16 value) {
+		return sqrt(value);
+	}
+
+	Fixed32 FixedMath::Sqrt(Fixed32 value) {
+		return sqrt(value);
+	}
+
+	Fixed16 FixedMath::Sin(Fixed16 angle) {
+		Fixed16 sin;
+		Fixed16 cos;
+		sinCos(angle, sin, cos);
+		return sin;
+	}
+
+	Fixed32 FixedMath::Sin(Fixed32 angle) {
+		Fixed32 sin;
+		Fixed32 cos;
+		sinCos(angle, sin, cos);
+		return sin;
+	}
+
+	Fixed16 FixedMath::Cos(Fixed16 angle) {
+		Fixed16 sin;
+		Fixed16 cos;
+		sinCos(angle, sin, cos);
+		return cos;
+	}
+
+	Fixed32 FixedMath::Cos(Fixed32 angle) {
+		Fixed32 sin;
+		Fixed32 cos;
+		sinCos(angle, sin, cos);
+		return cos;
+	}
+
+	void FixedMath::SinCos(Fixed16 angle, Fixed16& sin, Fixed16& cos) {
+		sinCos(angle, sin, cos);
+	}
+
+	void FixedMath::SinCos(Fixed32 angle, Fixed32& sin, Fixed32& cos) {
+		sinCos(angle, sin, cos);
+	}
+
+	Fixed16 FixedMath::Atan2(Fixed16 y, Fixed16 x) {
+		return fromAngle60<Fixed16>(atan2(y.Raw, x.Raw));
+	}
+
+	Fixed32 FixedMath::Atan2(Fixed32 y, Fixed32 x) {
+		return fromAngle60<Fixed32>(atan2(y.Raw, x.Raw));
+	}
+
+	Fixed16 FixedMath::Acos(Fixed16 value) {
+		return acos(value);
+	}
+
+	Fixed32 FixedMath::Acos(Fixed32 value) {
+		return acos(value);
+	}
+
+	Fixed16 FixedMath::WrapAngle(Fixed16 angle) {
+		return wrapAngle(angle);
+	}
+
+	Fixed32 FixedMath::WrapAngle(Fixed32 angle) {
+		return wrapAngle(angle);
+	}
+
+	Fixed16 FixedMath::ToDegrees(Fixed16 radians) {
+		return toDegrees(radians);
+	}
+
+	Fixed32 FixedMath::ToDegrees(Fixed32 radians) {
+		return toDegrees(radians);
+	}
+
+	Fixed16 FixedMath::ToRadians(Fixed16 degrees) {
+		return toRadians(degrees);
+	}
+
+	Fixed32 FixedMath::ToRadians(Fixed32 degrees) {
+		return toRadians(degrees);
+	}
+}
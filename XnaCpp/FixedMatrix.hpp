@@ -0,0 +1,62 @@
+#ifndef _FIXEDMATRIX_HPP_
+#define _FIXEDMATRIX_HPP_
+
+#include "FixedPoint.hpp"
+#include "FixedVector3.hpp"
+
+namespace Xna {
+
+	struct Matrix;
+	template <typename T> struct FixedQuaternion;
+
+	// Row-major Matrix over Fixed16 or Fixed32 for deterministic simulation, with the XNA conventions of Matrix.
+	// Each element of a product is accumulated at double width and rounded once.
+	template <typename T>
+	struct FixedMatrix {
+		T M11, M12, M13, M14;
+		T M21, M22, M23, M24;
+		T M31, M32, M33, M34;
+		T M41, M42, M43, M44;
+
+		static const FixedMatrix Identity;
+
+		FixedMatrix();
+		FixedMatrix(
+			T m11, T m12, T m13, T m14,
+			T m21, T m22, T m23, T m24,
+			T m31, T m32, T m33, T m34,
+			T m41, T m42, T m43, T m44);
+
+		FixedMatrix operator -() const;
+		FixedMatrix operator +(FixedMatrix const& other) const;
+		FixedMatrix operator -(FixedMatrix const& other) const;
+		FixedMatrix operator *(FixedMatrix const& other) const;
+		FixedMatrix operator *(T scaleFactor) const;
+		bool operator ==(FixedMatrix const& other) const = default;
+
+		static FixedMatrix FromMatrix(Matrix const& value);
+		Matrix ToMatrix() const;
+
+		FixedVector3<T> Translation() const;
+		void Translation(FixedVector3<T> const& value);
+
+		static FixedMatrix CreateFromAxisAngle(FixedVector3<T> const& axis, T angle);
+		static FixedMatrix CreateFromQuaternion(FixedQuaternion<T> const& quaternion);
+		static FixedMatrix CreateFromYawPitchRoll(T yaw, T pitch, T roll);
+		static FixedMatrix CreateRotationX(T radians);
+		static FixedMatrix CreateRotationY(T radians);
+		static FixedMatrix CreateRotationZ(T radians);
+		static FixedMatrix CreateScale(T scale);
+		static FixedMatrix CreateScale(T xScale, T yScale, T zScale);
+		static FixedMatrix CreateScale(FixedVector3<T> const& scales);
+		static FixedMatrix CreateTranslation(T xPosition, T yPosition, T zPosition);
+		static FixedMatrix CreateTranslation(FixedVector3<T> const& position);
+		static FixedMatrix Multiply(FixedMatrix const& matrix1, FixedMatrix const& matrix2);
+		static FixedMatrix Transpose(FixedMatrix const& matrix);
+	};
+
+	using MatrixFixed16 = FixedMatrix<Fixed16>;
+	using MatrixFixed32 = FixedMatrix<Fixed32>;
+}
+
+#endif
@@ -0,0 +1,288 @@
+#include "FixedPoint.hpp"
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//Private
+namespace Xna {
+	namespace {
+		template <typename TRaw>
+		TRaw wrap(int64_t value) {
+			return static_cast<TRaw>(static_cast<std::make_unsigned_t<TRaw>>(value));
+		}
+
+		// Double-width accumulator for Q32.32 products.
+#if defined(__SIZEOF_INT128__)
+		struct Int128 {
+			__int128 Value{ 0 };
+
+			static Int128 Multiply(int64_t a, int64_t b) {
+				return { static_cast<__int128>(a) * b };
+			}
+
+			Int128 operator +(Int128 const& other) const {
+				return { static_cast<__int128>(static_cast<unsigned __int128>(Value) + static_cast<unsigned __int128>(other.Value)) };
+			}
+
+			int64_t ShiftRound(int32_t shift) const {
+				auto rounded = static_cast<unsigned __int128>(Value) + (static_cast<unsigned __int128>(1) << (shift - 1));
+				return static_cast<int64_t>(static_cast<__int128>(rounded) >> shift);
+			}
+		};
+
+		// (value << shift) / divisor for |divisor| > 0, or false when the quotient does not fit in 64 bits.
+		bool divideShifted(int64_t value, int64_t divisor, int32_t shift, int64_t& quotient) {
+			auto result = (static_cast<__int128>(value) << shift) / divisor;
+
+			if (result > std::numeric_limits<int64_t>::max() || result < std::numeric_limits<int64_t>::min())
+				return false;
+
+			quotient = static_cast<int64_t>(result);
+			return true;
+		}
+#elif defined(_MSC_VER)
+		struct Int128 {
+			uint64_t Low{ 0 };
+			int64_t High{ 0 };
+
+			static Int128 Multiply(int64_t a, int64_t b) {
+				Int128 result;
+				result.Low = static_cast<uint64_t>(_mul128(a, b, &result.High));
+				return result;
+			}
+
+			Int128 operator +(Int128 const& other) const {
+				Int128 result;
+				auto carry = _addcarry_u64(0, Low, other.Low, &result.Low);
+				unsigned long long high;
+				_addcarry_u64(carry, static_cast<uint64_t>(High), static_cast<uint64_t>(other.High), &high);
+				result.High = static_cast<int64_t>(high);
+				return result;
+			}
+
+			int64_t ShiftRound(int32_t shift) const {
+				uint64_t low;
+				unsigned long long high;
+				auto carry = _addcarry_u64(0, Low, uint64_t(1) << (shift - 1), &low);
+				_addcarry_u64(carry, static_cast<uint64_t>(High), 0, &high);
+				return static_cast<int64_t>(__shiftright128(low, high, static_cast<unsigned char>(shift)));
+			}
+		};
+
+		bool divideShifted(int64_t value, int64_t divisor, int32_t shift, int64_t& quotient) {
+			auto negative = (value < 0) != (divisor < 0);
+			auto magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+			auto denominator = divisor < 0 ? 0 - static_cast<uint64_t>(divisor) : static_cast<uint64_t>(divisor);
+			auto high = magnitude >> (64 - shift);
+			auto low = magnitude << shift;
+
+			if (high >= denominator)
+				return false;
+
+			uint64_t remainder;
+			auto result = _udiv128(high, low, denominator, &remainder);
+			auto limit = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (negative ? 1 : 0);
+
+			if (result > limit)
+				return false;
+
+			quotient = negative ? static_cast<int64_t>(0 - result) : static_cast<int64_t>(result);
+			return true;
+		}
+#else
+#error "FixedPoint requires a compiler with 128-bit integer support"
+#endif
+
+		// Products of Q16.16 values fit in 64 bits; Q32.32 needs 128.
+		template <typename TRaw>
+		struct Accumulator;
+
+		template <>
+		struct Accumulator<int32_t> {
+			int64_t Value{ 0 };
+
+			void Add(int32_t a, int32_t b) {
+				Value = static_cast<int64_t>(static_cast<uint64_t>(Value) + static_cast<uint64_t>(static_cast<int64_t>(a) * b));
+			}
+
+			int32_t Result(int32_t shift) const {
+				auto rounded = static_cast<int64_t>(static_cast<uint64_t>(Value) + (uint64_t(1) << (shift - 1)));
+				return wrap<int32_t>(rounded >> shift);
+			}
+		};
+
+		template <>
+		struct Accumulator<int64_t> {
+			Int128 Value;
+
+			void Add(int64_t a, int64_t b) {
+				Value = Value + Int128::Multiply(a, b);
+			}
+
+			int64_t Result(int32_t shift) const {
+				return Value.ShiftRound(shift);
+			}
+		};
+
+		template <typename TRaw>
+		TRaw divide(TRaw value, TRaw divisor, int32_t shift) {
+			constexpr auto max = std::numeric_limits<TRaw>::max();
+			constexpr auto min = std::numeric_limits<TRaw>::min();
+			auto negative = (value < 0) != (divisor < 0);
+
+			if (divisor == 0)
+				return value == 0 ? 0 : (value < 0 ? min : max);
+
+			if constexpr (sizeof(TRaw) == 4) {
+				auto result = (static_cast<int64_t>(value) << shift) / divisor;
+				return result > max ? max : (result < min ? min : static_cast<TRaw>(result));
+			}
+			else {
+				int64_t result;
+				return divideShifted(value, divisor, shift, result) ? result : (negative ? min : max);
+			}
+		}
+
+		template <typename TRaw>
+		TRaw fromDouble(double value, int32_t fractionBits) {
+			constexpr auto max = std::numeric_limits<TRaw>::max();
+			constexpr auto min = std::numeric_limits<TRaw>::min();
+
+			if (std::isnan(value))
+				return 0;
+
+			auto scaled = std::nearbyint(std::ldexp(value, fractionBits));
+
+			// Both limits are powers of two, so the comparisons are exact.
+			if (scaled >= -static_cast<double>(min))
+				return max;
+
+			if (scaled <= static_cast<double>(min))
+				return min;
+
+			return static_cast<TRaw>(scaled);
+		}
+	}
+}
+
+//Operators
+namespace Xna {
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::operator -() const {
+		using Unsigned = std::make_unsigned_t<TRaw>;
+		return FromRaw(static_cast<TRaw>(static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(Raw))));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::operator +(FixedPoint const& other) const {
+		using Unsigned = std::make_unsigned_t<TRaw>;
+		return FromRaw(static_cast<TRaw>(static_cast<Unsigned>(static_cast<Unsigned>(Raw) + static_cast<Unsigned>(other.Raw))));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::operator -(FixedPoint const& other) const {
+		using Unsigned = std::make_unsigned_t<TRaw>;
+		return FromRaw(static_cast<TRaw>(static_cast<Unsigned>(static_cast<Unsigned>(Raw) - static_cast<Unsigned>(other.Raw))));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::operator *(FixedPoint const& other) const {
+		Accumulator<TRaw> accumulator;
+		accumulator.Add(Raw, other.Raw);
+		return FromRaw(accumulator.Result(TFractionBits));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::operator /(FixedPoint const& other) const {
+		return FromRaw(divide(Raw, other.Raw, TFractionBits));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits>& FixedPoint<TRaw, TFractionBits>::operator +=(FixedPoint const& other) {
+		return *this = *this + other;
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits>& FixedPoint<TRaw, TFractionBits>::operator -=(FixedPoint const& other) {
+		return *this = *this - other;
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits>& FixedPoint<TRaw, TFractionBits>::operator *=(FixedPoint const& other) {
+		return *this = *this * other;
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits>& FixedPoint<TRaw, TFractionBits>::operator /=(FixedPoint const& other) {
+		return *this = *this / other;
+	}
+}
+
+//Functions
+namespace Xna {
+	template <typename TRaw, int32_t TFractionBits>
+	float FixedPoint<TRaw, TFractionBits>::ToFloat() const {
+		return static_cast<float>(ToDouble());
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	double FixedPoint<TRaw, TFractionBits>::ToDouble() const {
+		return std::ldexp(static_cast<double>(Raw), -TFractionBits);
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	int32_t FixedPoint<TRaw, TFractionBits>::ToInt32() const {
+		return static_cast<int32_t>(Raw >> TFractionBits);
+	}
+}
+
+//Static
+namespace Xna {
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::FromFloat(float value) {
+		return FromRaw(fromDouble<TRaw>(value, TFractionBits));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::FromDouble(double value) {
+		return FromRaw(fromDouble<TRaw>(value, TFractionBits));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Dot(FixedPoint const& a1, FixedPoint const& b1,
+		FixedPoint const& a2, FixedPoint const& b2) {
+		Accumulator<TRaw> accumulator;
+		accumulator.Add(a1.Raw, b1.Raw);
+		accumulator.Add(a2.Raw, b2.Raw);
+		return FromRaw(accumulator.Result(TFractionBits));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Dot(FixedPoint const& a1, FixedPoint const& b1,
+		FixedPoint const& a2, FixedPoint const& b2, FixedPoint const& a3, FixedPoint const& b3) {
+		Accumulator<TRaw> accumulator;
+		accumulator.Add(a1.Raw, b1.Raw);
+		accumulator.Add(a2.Raw, b2.Raw);
+		accumulator.Add(a3.Raw, b3.Raw);
+		return FromRaw(accumulator.Result(TFractionBits));
+	}
+
+	template <typename TRaw, int32_t TFractionBits>
+	FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Dot(FixedPoint const& a1, FixedPoint const& b1,
+		FixedPoint const& a2, FixedPoint const& b2, FixedPoint const& a3, FixedPoint const& b3,
+		FixedPoint const& a4, FixedPoint const& b4) {
+		Accumulator<TRaw> accumulator;
+		accumulator.Add(a1.Raw, b1.Raw);
+		accumulator.Add(a2.Raw, b2.Raw);
+		accumulator.Add(a3.Raw, b3.Raw);
+		accumulator.Add(a4.Raw, b4.Raw);
+		return FromRaw(accumulator.Result(TFractionBits));
+	}
+
+	template struct FixedPoint<int32_t, 16>;
+	template struct FixedPoint<int64_t, 32>;
+}
@@ -0,0 +1,115 @@
+#ifndef _FIXEDPOINT_HPP_
+#define _FIXEDPOINT_HPP_
+
+#include <compare>
+#include <cstdint>
+
+namespace Xna {
+
+	// Signed fixed-point number holding value * 2^FractionBits in Raw. Arithmetic is integer-only, so results are
+	// bit-identical across compilers, instruction sets and floating-point settings, as lockstep simulation needs.
+	// Addition, subtraction and multiplication wrap around on overflow like the underlying integer. Products are
+	// rounded to nearest (ties up); quotients truncate toward zero and saturate on overflow or division by zero.
+	// Conversions from float are exact functions of the input bits, so they are deterministic as well.
+	template <typename TRaw, int32_t TFractionBits>
+	struct FixedPoint {
+		using RawType = TRaw;
+		static constexpr int32_t FractionBits = TFractionBits;
+		static constexpr TRaw OneRaw = static_cast<TRaw>(TRaw(1) << TFractionBits);
+
+		TRaw Raw{ 0 };
+
+		constexpr FixedPoint() = default;
+		constexpr FixedPoint(int32_t value) : Raw(static_cast<TRaw>(static_cast<TRaw>(value) * OneRaw)) {}
+
+		static constexpr FixedPoint FromRaw(TRaw raw) {
+			FixedPoint result;
+			result.Raw = raw;
+			return result;
+		}
+
+		static const FixedPoint Zero;
+		static const FixedPoint One;
+		static const FixedPoint Half;
+		static const FixedPoint Pi;
+		static const FixedPoint PiOver2;
+		static const FixedPoint PiOver4;
+		static const FixedPoint TwoPi;
+		static const FixedPoint Epsilon;
+		static const FixedPoint MaxValue;
+		static const FixedPoint MinValue;
+
+		static FixedPoint FromFloat(float value);
+		static FixedPoint FromDouble(double value);
+		float ToFloat() const;
+		double ToDouble() const;
+		// Rounds toward negative infinity.
+		int32_t ToInt32() const;
+
+		FixedPoint operator -() const;
+		FixedPoint operator +(FixedPoint const& other) const;
+		FixedPoint operator -(FixedPoint const& other) const;
+		FixedPoint operator *(FixedPoint const& other) const;
+		FixedPoint operator /(FixedPoint const& other) const;
+		FixedPoint& operator +=(FixedPoint const& other);
+		FixedPoint& operator -=(FixedPoint const& other);
+		FixedPoint& operator *=(FixedPoint const& other);
+		FixedPoint& operator /=(FixedPoint const& other);
+
+		constexpr bool operator ==(FixedPoint const& other) const = default;
+		constexpr auto operator <=>(FixedPoint const& other) const = default;
+
+		// Sums of products accumulated at double width and rounded once; used by the vector and matrix types so the
+		// scalar and batch paths agree.
+		static FixedPoint Dot(FixedPoint const& a1, FixedPoint const& b1, FixedPoint const& a2, FixedPoint const& b2);
+		static FixedPoint Dot(FixedPoint const& a1, FixedPoint const& b1, FixedPoint const& a2, FixedPoint const& b2,
+			FixedPoint const& a3, FixedPoint const& b3);
+		static FixedPoint Dot(FixedPoint const& a1, FixedPoint const& b1, FixedPoint const& a2, FixedPoint const& b2,
+			FixedPoint const& a3, FixedPoint const& b3, FixedPoint const& a4, FixedPoint const& b4);
+
+	private:
+		// Pi * 2^60 rounded to FractionBits, divided by 2^shift.
+		static constexpr FixedPoint piShifted(int32_t shift) {
+			constexpr int64_t pi60 = 0x3243F6A8885A308D;
+			auto bits = 60 - TFractionBits + shift;
+			return FromRaw(static_cast<TRaw>((pi60 + (int64_t(1) << (bits - 1))) >> bits));
+		}
+	};
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Zero = FixedPoint::FromRaw(0);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::One = FixedPoint::FromRaw(OneRaw);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Half = FixedPoint::FromRaw(OneRaw / 2);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Pi = FixedPoint::piShifted(0);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::PiOver2 = FixedPoint::piShifted(1);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::PiOver4 = FixedPoint::piShifted(2);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::TwoPi = FixedPoint::piShifted(-1);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::Epsilon = FixedPoint::FromRaw(1);
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::MaxValue = FixedPoint::FromRaw(INT64_MAX >> (64 - 8 * sizeof(TRaw)));
+
+	template <typename TRaw, int32_t TFractionBits>
+	inline constexpr FixedPoint<TRaw, TFractionBits> FixedPoint<TRaw, TFractionBits>::MinValue = FixedPoint::FromRaw(INT64_MIN >> (64 - 8 * sizeof(TRaw)));
+
+	// Q16.16: range +-32768 with a resolution of 1.5e-5.
+	using Fixed16 = FixedPoint<int32_t, 16>;
+	// Q32.32: range +-2^31 with a resolution of 2.3e-10.
+	using Fixed32 = FixedPoint<int64_t, 32>;
+}
+
+#endif
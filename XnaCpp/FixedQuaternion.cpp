@@ -0,0 +1,240 @@
+#include "FixedQuaternion.hpp"
+#include "FixedMath.hpp"
+#include "FixedMatrix.hpp"
+#include "Quaternion.hpp"
+
+//Constructors
+namespace Xna {
+	template <typename T>
+	const FixedQuaternion<T> FixedQuaternion<T>::Identity = FixedQuaternion<T>(T::Zero, T::Zero, T::Zero, T::One);
+
+	template <typename T>
+	FixedQuaternion<T>::FixedQuaternion() {}
+
+	template <typename T>
+	FixedQuaternion<T>::FixedQuaternion(T x, T y, T z, T w) :
+		X(x), Y(y), Z(z), W(w) {}
+
+	template <typename T>
+	FixedQuaternion<T>::FixedQuaternion(FixedVector3<T> const& value, T w) :
+		X(value.X), Y(value.Y), Z(value.Z), W(w) {}
+}
+
+//Operators
+namespace Xna {
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::operator -() const {
+		return FixedQuaternion(-X, -Y, -Z, -W);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::operator +(FixedQuaternion const& other) const {
+		return FixedQuaternion(X + other.X, Y + other.Y, Z + other.Z, W + other.W);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::operator -(FixedQuaternion const& other) const {
+		return FixedQuaternion(X - other.X, Y - other.Y, Z - other.Z, W - other.W);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::operator *(FixedQuaternion const& other) const {
+		return FixedQuaternion(
+			T::Dot(X, other.W, other.X, W, Y, other.Z, -Z, other.Y),
+			T::Dot(Y, other.W, other.Y, W, Z, other.X, -X, other.Z),
+			T::Dot(Z, other.W, other.Z, W, X, other.Y, -Y, other.X),
+			T::Dot(W, other.W, -X, other.X, -Y, other.Y, -Z, other.Z));
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::operator *(T scaleFactor) const {
+		return FixedQuaternion(X * scaleFactor, Y * scaleFactor, Z * scaleFactor, W * scaleFactor);
+	}
+}
+
+//Functions
+namespace Xna {
+	template <typename T>
+	Quaternion FixedQuaternion<T>::ToQuaternion() const {
+		return Quaternion(X.ToFloat(), Y.ToFloat(), Z.ToFloat(), W.ToFloat());
+	}
+
+	template <typename T>
+	T FixedQuaternion<T>::Length() const {
+		return FixedMath::Sqrt(LengthSquared());
+	}
+
+	template <typename T>
+	T FixedQuaternion<T>::LengthSquared() const {
+		return Dot(*this, *this);
+	}
+}
+
+//Static
+namespace Xna {
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::FromQuaternion(Quaternion const& value) {
+		return FixedQuaternion(T::FromFloat(value.X), T::FromFloat(value.Y), T::FromFloat(value.Z), T::FromFloat(value.W));
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::Concatenate(FixedQuaternion const& value1, FixedQuaternion const& value2) {
+		return value2 * value1;
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::Conjugate(FixedQuaternion const& value) {
+		return FixedQuaternion(-value.X, -value.Y, -value.Z, value.W);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::CreateFromAxisAngle(FixedVector3<T> const& axis, T angle) {
+		T sin;
+		T cos;
+		FixedMath::SinCos(angle * T::Half, sin, cos);
+
+		return FixedQuaternion(axis.X * sin, axis.Y * sin, axis.Z * sin, cos);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::CreateFromRotationMatrix(FixedMatrix<T> const& matrix) {
+		auto trace = matrix.M11 + matrix.M22 + matrix.M33;
+
+		if (trace > T::Zero) {
+			auto root = FixedMath::Sqrt(trace + T::One);
+			auto scale = T::Half / root;
+			return FixedQuaternion(
+				(matrix.M23 - matrix.M32) * scale,
+				(matrix.M31 - matrix.M13) * scale,
+				(matrix.M12 - matrix.M21) * scale,
+				root * T::Half);
+		}
+
+		if (matrix.M11 >= matrix.M22 && matrix.M11 >= matrix.M33) {
+			auto root = FixedMath::Sqrt(T::One + matrix.M11 - matrix.M22 - matrix.M33);
+			auto scale = T::Half / root;
+			return FixedQuaternion(
+				root * T::Half,
+				(matrix.M12 + matrix.M21) * scale,
+				(matrix.M13 + matrix.M31) * scale,
+				(matrix.M23 - matrix.M32) * scale);
+		}
+
+		if (matrix.M22 > matrix.M33) {
+			auto root = FixedMath::Sqrt(T::One + matrix.M22 - matrix.M11 - matrix.M33);
+			auto scale = T::Half / root;
+			return FixedQuaternion(
+				(matrix.M21 + matrix.M12) * scale,
+				root * T::Half,
+				(matrix.M32 + matrix.M23) * scale,
+				(matrix.M31 - matrix.M13) * scale);
+		}
+
+		auto root = FixedMath::Sqrt(T::One + matrix.M33 - matrix.M11 - matrix.M22);
+		auto scale = T::Half / root;
+		return FixedQuaternion(
+			(matrix.M31 + matrix.M13) * scale,
+			(matrix.M32 + matrix.M23) * scale,
+			root * T::Half,
+			(matrix.M12 - matrix.M21) * scale);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::CreateFromYawPitchRoll(T yaw, T pitch, T roll) {
+		T sinRoll, cosRoll;
+		T sinPitch, cosPitch;
+		T sinYaw, cosYaw;
+		FixedMath::SinCos(roll * T::Half, sinRoll, cosRoll);
+		FixedMath::SinCos(pitch * T::Half, sinPitch, cosPitch);
+		FixedMath::SinCos(yaw * T::Half, sinYaw, cosYaw);
+
+		auto cosYawCosPitch = cosYaw * cosPitch;
+		auto sinYawSinPitch = sinYaw * sinPitch;
+		auto cosYawSinPitch = cosYaw * sinPitch;
+		auto sinYawCosPitch = sinYaw * cosPitch;
+
+		return FixedQuaternion(
+			T::Dot(cosYawSinPitch, cosRoll, sinYawCosPitch, sinRoll),
+			T::Dot(sinYawCosPitch, cosRoll, -cosYawSinPitch, sinRoll),
+			T::Dot(cosYawCosPitch, sinRoll, -sinYawSinPitch, cosRoll),
+			T::Dot(cosYawCosPitch, cosRoll, sinYawSinPitch, sinRoll));
+	}
+
+	template <typename T>
+	T FixedQuaternion<T>::Dot(FixedQuaternion const& quaternion1, FixedQuaternion const& quaternion2) {
+		return T::Dot(quaternion1.X, quaternion2.X, quaternion1.Y, quaternion2.Y,
+			quaternion1.Z, quaternion2.Z, quaternion1.W, quaternion2.W);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::Inverse(FixedQuaternion const& quaternion) {
+		auto lengthSquared = quaternion.LengthSquared();
+
+		if (lengthSquared == T::Zero)
+			return quaternion;
+
+		return FixedQuaternion(
+			-quaternion.X / lengthSquared,
+			-quaternion.Y / lengthSquared,
+			-quaternion.Z / lengthSquared,
+			quaternion.W / lengthSquared);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::Lerp(FixedQuaternion const& quaternion1, FixedQuaternion const& quaternion2, T amount) {
+		auto weight1 = T::One - amount;
+		auto weight2 = Dot(quaternion1, quaternion2) >= T::Zero ? amount : -amount;
+
+		return Normalize(FixedQuaternion(
+			T::Dot(quaternion1.X, weight1, quaternion2.X, weight2),
+			T::Dot(quaternion1.Y, weight1, quaternion2.Y, weight2),
+			T::Dot(quaternion1.Z, weight1, quaternion2.Z, weight2),
+			T::Dot(quaternion1.W, weight1, quaternion2.W, weight2)));
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::Normalize(FixedQuaternion const& quaternion) {
+		auto length = quaternion.Length();
+
+		if (length == T::Zero)
+			return Identity;
+
+		return FixedQuaternion(quaternion.X / length, quaternion.Y / length, quaternion.Z / length, quaternion.W / length);
+	}
+
+	template <typename T>
+	FixedQuaternion<T> FixedQuaternion<T>::Slerp(FixedQuaternion const& quaternion1, FixedQuaternion const& quaternion2, T amount) {
+		auto cosine = Dot(quaternion1, quaternion2);
+		auto flip = cosine < T::Zero;
+
+		if (flip)
+			cosine = -cosine;
+
+		T weight1;
+		T weight2;
+
+		// Below about 0.3 degrees the sine ratio loses more precision than the lerp is off by.
+		if (cosine > T::One - T::FromRaw(T::OneRaw >> 16)) {
+			weight1 = T::One - amount;
+			weight2 = amount;
+		}
+		else {
+			auto angle = FixedMath::Acos(cosine);
+			auto sine = FixedMath::Sin(angle);
+			weight1 = FixedMath::Sin((T::One - amount) * angle) / sine;
+			weight2 = FixedMath::Sin(amount * angle) / sine;
+		}
+
+		if (flip)
+			weight2 = -weight2;
+
+		return FixedQuaternion(
+			T::Dot(quaternion1.X, weight1, quaternion2.X, weight2),
+			T::Dot(quaternion1.Y, weight1, quaternion2.Y, weight2),
+			T::Dot(quaternion1.Z, weight1, quaternion2.Z, weight2),
+			T::Dot(quaternion1.W, weight1, quaternion2.W, weight2));
+	}
+
+	template struct FixedQuaternion<Fixed16>;
+	template struct FixedQuaternion<Fixed32>;
+}
@@ -0,0 +1,57 @@
+#ifndef _FIXEDQUATERNION_HPP_
+#define _FIXEDQUATERNION_HPP_
+
+#include "FixedPoint.hpp"
+#include "FixedVector3.hpp"
+
+namespace Xna {
+
+	struct Quaternion;
+	template <typename T> struct FixedMatrix;
+
+	// Quaternion over Fixed16 or Fixed32 for deterministic simulation; see FixedPoint for the arithmetic rules.
+	template <typename T>
+	struct FixedQuaternion {
+		T X;
+		T Y;
+		T Z;
+		T W;
+
+		static const FixedQuaternion Identity;
+
+		FixedQuaternion();
+		FixedQuaternion(T x, T y, T z, T w);
+		FixedQuaternion(FixedVector3<T> const& value, T w);
+
+		FixedQuaternion operator -() const;
+		FixedQuaternion operator +(FixedQuaternion const& other) const;
+		FixedQuaternion operator -(FixedQuaternion const& other) const;
+		FixedQuaternion operator *(FixedQuaternion const& other) const;
+		FixedQuaternion operator *(T scaleFactor) const;
+		bool operator ==(FixedQuaternion const& other) const = default;
+
+		static FixedQuaternion FromQuaternion(Quaternion const& value);
+		Quaternion ToQuaternion() const;
+
+		T Length() const;
+		T LengthSquared() const;
+
+		static FixedQuaternion Concatenate(FixedQuaternion const& value1, FixedQuaternion const& value2);
+		static FixedQuaternion Conjugate(FixedQuaternion const& value);
+		static FixedQuaternion CreateFromAxisAngle(FixedVector3<T> const& axis, T angle);
+		static FixedQuaternion CreateFromRotationMatrix(FixedMatrix<T> const& matrix);
+		static FixedQuaternion CreateFromYawPitchRoll(T yaw, T pitch, T roll);
+		static T Dot(FixedQuaternion const& quaternion1, FixedQuaternion const& quaternion2);
+		static FixedQuaternion Inverse(FixedQuaternion const& quaternion);
+		// Normalized lerp along the shorter arc.
+		static FixedQuaternion Lerp(FixedQuaternion const& quaternion1, FixedQuaternion const& quaternion2, T amount);
+		// A zero quaternion normalizes to Identity.
+		static FixedQuaternion Normalize(FixedQuaternion const& quaternion);
+		static FixedQuaternion Slerp(FixedQuaternion const& quaternion1, FixedQuaternion const& quaternion2, T amount);
+	};
+
+	using QuaternionFixed16 = FixedQuaternion<Fixed16>;
+	using QuaternionFixed32 = FixedQuaternion<Fixed32>;
+}
+
+#endif
@@ -0,0 +1,152 @@
+#include "FixedVector2.hpp"
+#include "FixedMath.hpp"
+#include "FixedMatrix.hpp"
+#include "FixedQuaternion.hpp"
+#include "Vector2.hpp"
+
+//Constructors
+namespace Xna {
+	template <typename T>
+	FixedVector2<T>::FixedVector2() {}
+
+	template <typename T>
+	FixedVector2<T>::FixedVector2(T value) :
+		X(value), Y(value) {}
+
+	template <typename T>
+	FixedVector2<T>::FixedVector2(T x, T y) :
+		X(x), Y(y) {}
+}
+
+//Operators
+namespace Xna {
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::operator -() const {
+		return FixedVector2(-X, -Y);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::operator +(FixedVector2 const& other) const {
+		return FixedVector2(X + other.X, Y + other.Y);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::operator -(FixedVector2 const& other) const {
+		return FixedVector2(X - other.X, Y - other.Y);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::operator *(FixedVector2 const& other) const {
+		return FixedVector2(X * other.X, Y * other.Y);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::operator *(T scaleFactor) const {
+		return FixedVector2(X * scaleFactor, Y * scaleFactor);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::operator /(T divider) const {
+		return FixedVector2(X / divider, Y / divider);
+	}
+}
+
+//Functions
+namespace Xna {
+	template <typename T>
+	Vector2 FixedVector2<T>::ToVector2() const {
+		return Vector2(X.ToFloat(), Y.ToFloat());
+	}
+
+	template <typename T>
+	T FixedVector2<T>::Length() const {
+		return FixedMath::Sqrt(LengthSquared());
+	}
+
+	template <typename T>
+	T FixedVector2<T>::LengthSquared() const {
+		return Dot(*this, *this);
+	}
+}
+
+//Static
+namespace Xna {
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::FromVector2(Vector2 const& value) {
+		return FixedVector2(T::FromFloat(value.X), T::FromFloat(value.Y));
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Clamp(FixedVector2 const& value, FixedVector2 const& min, FixedVector2 const& max) {
+		return FixedVector2(FixedMath::Clamp(value.X, min.X, max.X), FixedMath::Clamp(value.Y, min.Y, max.Y));
+	}
+
+	template <typename T>
+	T FixedVector2<T>::Distance(FixedVector2 const& value1, FixedVector2 const& value2) {
+		return (value1 - value2).Length();
+	}
+
+	template <typename T>
+	T FixedVector2<T>::DistanceSquared(FixedVector2 const& value1, FixedVector2 const& value2) {
+		return (value1 - value2).LengthSquared();
+	}
+
+	template <typename T>
+	T FixedVector2<T>::Dot(FixedVector2 const& value1, FixedVector2 const& value2) {
+		return T::Dot(value1.X, value2.X, value1.Y, value2.Y);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Lerp(FixedVector2 const& value1, FixedVector2 const& value2, T amount) {
+		return FixedVector2(FixedMath::Lerp(value1.X, value2.X, amount), FixedMath::Lerp(value1.Y, value2.Y, amount));
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Max(FixedVector2 const& value1, FixedVector2 const& value2) {
+		return FixedVector2(FixedMath::Max(value1.X, value2.X), FixedMath::Max(value1.Y, value2.Y));
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Min(FixedVector2 const& value1, FixedVector2 const& value2) {
+		return FixedVector2(FixedMath::Min(value1.X, value2.X), FixedMath::Min(value1.Y, value2.Y));
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Normalize(FixedVector2 const& value) {
+		auto length = value.Length();
+		return length == T::Zero ? value : value / length;
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Transform(FixedVector2 const& position, FixedMatrix<T> const& matrix) {
+		return FixedVector2(
+			T::Dot(position.X, matrix.M11, position.Y, matrix.M21) + matrix.M41,
+			T::Dot(position.X, matrix.M12, position.Y, matrix.M22) + matrix.M42);
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::Transform(FixedVector2 const& value, FixedQuaternion<T> const& rotation) {
+		auto x2 = rotation.X + rotation.X;
+		auto y2 = rotation.Y + rotation.Y;
+		auto z2 = rotation.Z + rotation.Z;
+		auto wz = rotation.W * z2;
+		auto xx = rotation.X * x2;
+		auto xy = rotation.X * y2;
+		auto yy = rotation.Y * y2;
+		auto zz = rotation.Z * z2;
+
+		return FixedVector2(
+			T::Dot(value.X, T::One - yy - zz, value.Y, xy - wz),
+			T::Dot(value.X, xy + wz, value.Y, T::One - xx - zz));
+	}
+
+	template <typename T>
+	FixedVector2<T> FixedVector2<T>::TransformNormal(FixedVector2 const& normal, FixedMatrix<T> const& matrix) {
+		return FixedVector2(
+			T::Dot(normal.X, matrix.M11, normal.Y, matrix.M21),
+			T::Dot(normal.X, matrix.M12, normal.Y, matrix.M22));
+	}
+
+	template struct FixedVector2<Fixed16>;
+	template struct FixedVector2<Fixed32>;
+}
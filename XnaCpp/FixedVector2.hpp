@@ -0,0 +1,56 @@
+#ifndef _FIXEDVECTOR2_HPP_
+#define _FIXEDVECTOR2_HPP_
+
+#include "FixedPoint.hpp"
+
+namespace Xna {
+
+	struct Vector2;
+	template <typename T> struct FixedMatrix;
+	template <typename T> struct FixedQuaternion;
+
+	// Vector2 over Fixed16 or Fixed32 for deterministic simulation; see FixedPoint for the arithmetic rules.
+	// Dot products and transforms accumulate at double width and round once.
+	template <typename T>
+	struct FixedVector2 {
+		T X;
+		T Y;
+
+		FixedVector2();
+		FixedVector2(T value);
+		FixedVector2(T x, T y);
+
+		FixedVector2 operator -() const;
+		FixedVector2 operator +(FixedVector2 const& other) const;
+		FixedVector2 operator -(FixedVector2 const& other) const;
+		FixedVector2 operator *(FixedVector2 const& other) const;
+		FixedVector2 operator *(T scaleFactor) const;
+		FixedVector2 operator /(T divider) const;
+		bool operator ==(FixedVector2 const& other) const = default;
+
+		static FixedVector2 FromVector2(Vector2 const& value);
+		Vector2 ToVector2() const;
+
+		T Length() const;
+		T LengthSquared() const;
+
+		static FixedVector2 Clamp(FixedVector2 const& value, FixedVector2 const& min, FixedVector2 const& max);
+		static T Distance(FixedVector2 const& value1, FixedVector2 const& value2);
+		static T DistanceSquared(FixedVector2 const& value1, FixedVector2 const& value2);
+		static T Dot(FixedVector2 const& value1, FixedVector2 const& value2);
+		static FixedVector2 Lerp(FixedVector2 const& value1, FixedVector2 const& value2, T amount);
+		static FixedVector2 Max(FixedVector2 const& value1, FixedVector2 const& value2);
+		static FixedVector2 Min(FixedVector2 const& value1, FixedVector2 const& value2);
+		// A zero vector stays zero.
+		static FixedVector2 Normalize(FixedVector2 const& value);
+
+		static FixedVector2 Transform(FixedVector2 const& position, FixedMatrix<T> const& matrix);
+		static FixedVector2 Transform(FixedVector2 const& value, FixedQuaternion<T> const& rotation);
+		static FixedVector2 TransformNormal(FixedVector2 const& normal, FixedMatrix<T> const& matrix);
+	};
+
+	using Vector2Fixed16 = FixedVector2<Fixed16>;
+	using Vector2Fixed32 = FixedVector2<Fixed32>;
+}
+
+#endif
@@ -0,0 +1,267 @@
+#include "FixedVector3.hpp"
+#include <algorithm>
+#include <type_traits>
+#include "FixedMath.hpp"
+#include "FixedMatrix.hpp"
+#include "FixedQuaternion.hpp"
+#include "Profiler.hpp"
+#include "SimdDispatch.hpp"
+#include "Vector3.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		static_assert(sizeof(FixedVector3<Fixed16>) == 3 * sizeof(int32_t), "TransformFixed16 reads vectors as raw triples");
+
+		// The matrix as Simd::Kernels::TransformFixed16 takes it: columns of the upper 3x3, then the translation row.
+		struct TransformMatrix {
+			int32_t Values[12];
+		};
+
+		TransformMatrix transformMatrix(FixedMatrix<Fixed16> const& matrix, bool translate) {
+			return { {
+				matrix.M11.Raw, matrix.M21.Raw, matrix.M31.Raw,
+				matrix.M12.Raw, matrix.M22.Raw, matrix.M32.Raw,
+				matrix.M13.Raw, matrix.M23.Raw, matrix.M33.Raw,
+				translate ? matrix.M41.Raw : 0, translate ? matrix.M42.Raw : 0, translate ? matrix.M43.Raw : 0 } };
+		}
+
+		void transform(FixedVector3<Fixed16> const* source, TransformMatrix const& matrix, FixedVector3<Fixed16>* destination, size_t length) {
+			auto kernel = Simd::Dispatch::Active().TransformFixed16;
+
+			if (kernel) {
+				kernel(reinterpret_cast<int32_t const*>(source), matrix.Values, reinterpret_cast<int32_t*>(destination), length);
+				return;
+			}
+
+			auto m = [&](size_t index) { return Fixed16::FromRaw(matrix.Values[index]); };
+
+			for (size_t i = 0; i < length; ++i) {
+				auto const& value = source[i];
+				destination[i] = FixedVector3<Fixed16>(
+					Fixed16::Dot(value.X, m(0), value.Y, m(1), value.Z, m(2)) + m(9),
+					Fixed16::Dot(value.X, m(3), value.Y, m(4), value.Z, m(5)) + m(10),
+					Fixed16::Dot(value.X, m(6), value.Y, m(7), value.Z, m(8)) + m(11));
+			}
+		}
+
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	template <typename T>
+	FixedVector3<T>::FixedVector3() {}
+
+	template <typename T>
+	FixedVector3<T>::FixedVector3(T value) :
+		X(value), Y(value), Z(value) {}
+
+	template <typename T>
+	FixedVector3<T>::FixedVector3(T x, T y, T z) :
+		X(x), Y(y), Z(z) {}
+}
+
+//Operators
+namespace Xna {
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::operator -() const {
+		return FixedVector3(-X, -Y, -Z);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::operator +(FixedVector3 const& other) const {
+		return FixedVector3(X + other.X, Y + other.Y, Z + other.Z);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::operator -(FixedVector3 const& other) const {
+		return FixedVector3(X - other.X, Y - other.Y, Z - other.Z);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::operator *(FixedVector3 const& other) const {
+		return FixedVector3(X * other.X, Y * other.Y, Z * other.Z);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::operator *(T scaleFactor) const {
+		return FixedVector3(X * scaleFactor, Y * scaleFactor, Z * scaleFactor);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::operator /(T divider) const {
+		return FixedVector3(X / divider, Y / divider, Z / divider);
+	}
+}
+
+//Functions
+namespace Xna {
+	template <typename T>
+	Vector3 FixedVector3<T>::ToVector3() const {
+		return Vector3(X.ToFloat(), Y.ToFloat(), Z.ToFloat());
+	}
+
+	template <typename T>
+	T FixedVector3<T>::Length() const {
+		return FixedMath::Sqrt(LengthSquared());
+	}
+
+	template <typename T>
+	T FixedVector3<T>::LengthSquared() const {
+		return Dot(*this, *this);
+	}
+}
+
+//Static
+namespace Xna {
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::FromVector3(Vector3 const& value) {
+		return FixedVector3(T::FromFloat(value.X), T::FromFloat(value.Y), T::FromFloat(value.Z));
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Clamp(FixedVector3 const& value, FixedVector3 const& min, FixedVector3 const& max) {
+		return FixedVector3(
+			FixedMath::Clamp(value.X, min.X, max.X),
+			FixedMath::Clamp(value.Y, min.Y, max.Y),
+			FixedMath::Clamp(value.Z, min.Z, max.Z));
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Cross(FixedVector3 const& vector1, FixedVector3 const& vector2) {
+		return FixedVector3(
+			T::Dot(vector1.Y, vector2.Z, -vector1.Z, vector2.Y),
+			T::Dot(vector1.Z, vector2.X, -vector1.X, vector2.Z),
+			T::Dot(vector1.X, vector2.Y, -vector1.Y, vector2.X));
+	}
+
+	template <typename T>
+	T FixedVector3<T>::Distance(FixedVector3 const& value1, FixedVector3 const& value2) {
+		return (value1 - value2).Length();
+	}
+
+	template <typename T>
+	T FixedVector3<T>::DistanceSquared(FixedVector3 const& value1, FixedVector3 const& value2) {
+		return (value1 - value2).LengthSquared();
+	}
+
+	template <typename T>
+	T FixedVector3<T>::Dot(FixedVector3 const& value1, FixedVector3 const& value2) {
+		return T::Dot(value1.X, value2.X, value1.Y, value2.Y, value1.Z, value2.Z);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Lerp(FixedVector3 const& value1, FixedVector3 const& value2, T amount) {
+		return FixedVector3(
+			FixedMath::Lerp(value1.X, value2.X, amount),
+			FixedMath::Lerp(value1.Y, value2.Y, amount),
+			FixedMath::Lerp(value1.Z, value2.Z, amount));
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Max(FixedVector3 const& value1, FixedVector3 const& value2) {
+		return FixedVector3(FixedMath::Max(value1.X, value2.X), FixedMath::Max(value1.Y, value2.Y), FixedMath::Max(value1.Z, value2.Z));
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Min(FixedVector3 const& value1, FixedVector3 const& value2) {
+		return FixedVector3(FixedMath::Min(value1.X, value2.X), FixedMath::Min(value1.Y, value2.Y), FixedMath::Min(value1.Z, value2.Z));
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Normalize(FixedVector3 const& value) {
+		auto length = value.Length();
+		return length == T::Zero ? value : value / length;
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Transform(FixedVector3 const& position, FixedMatrix<T> const& matrix) {
+		return FixedVector3(
+			T::Dot(position.X, matrix.M11, position.Y, matrix.M21, position.Z, matrix.M31) + matrix.M41,
+			T::Dot(position.X, matrix.M12, position.Y, matrix.M22, position.Z, matrix.M32) + matrix.M42,
+			T::Dot(position.X, matrix.M13, position.Y, matrix.M23, position.Z, matrix.M33) + matrix.M43);
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::Transform(FixedVector3 const& value, FixedQuaternion<T> const& rotation) {
+		auto x2 = rotation.X + rotation.X;
+		auto y2 = rotation.Y + rotation.Y;
+		auto z2 = rotation.Z + rotation.Z;
+		auto wx = rotation.W * x2;
+		auto wy = rotation.W * y2;
+		auto wz = rotation.W * z2;
+		auto xx = rotation.X * x2;
+		auto xy = rotation.X * y2;
+		auto xz = rotation.X * z2;
+		auto yy = rotation.Y * y2;
+		auto yz = rotation.Y * z2;
+		auto zz = rotation.Z * z2;
+
+		return FixedVector3(
+			T::Dot(value.X, T::One - yy - zz, value.Y, xy - wz, value.Z, xz + wy),
+			T::Dot(value.X, xy + wz, value.Y, T::One - xx - zz, value.Z, yz - wx),
+			T::Dot(value.X, xz - wy, value.Y, yz + wx, value.Z, T::One - xx - yy));
+	}
+
+	template <typename T>
+	FixedVector3<T> FixedVector3<T>::TransformNormal(FixedVector3 const& normal, FixedMatrix<T> const& matrix) {
+		return FixedVector3(
+			T::Dot(normal.X, matrix.M11, normal.Y, matrix.M21, normal.Z, matrix.M31),
+			T::Dot(normal.X, matrix.M12, normal.Y, matrix.M22, normal.Z, matrix.M32),
+			T::Dot(normal.X, matrix.M13, normal.Y, matrix.M23, normal.Z, matrix.M33));
+	}
+
+	template <typename T>
+	void FixedVector3<T>::Transform(vector<FixedVector3> const& sourceArray, size_t sourceIndex, FixedMatrix<T> const& matrix,
+		vector<FixedVector3>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("FixedVector3::Transform");
+
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		if constexpr (std::is_same_v<T, Fixed16>) {
+			transform(sourceArray.data() + sourceIndex, transformMatrix(matrix, true), destinationArray.data() + destinationIndex, length);
+		}
+		else {
+			for (size_t i = 0; i < length; ++i)
+				destinationArray[destinationIndex + i] = Transform(sourceArray[sourceIndex + i], matrix);
+		}
+	}
+
+	template <typename T>
+	void FixedVector3<T>::Transform(vector<FixedVector3> const& sourceArray, FixedMatrix<T> const& matrix, vector<FixedVector3>& destinationArray) {
+		Transform(sourceArray, 0, matrix, destinationArray, 0, sourceArray.size());
+	}
+
+	template <typename T>
+	void FixedVector3<T>::TransformNormal(vector<FixedVector3> const& sourceArray, size_t sourceIndex, FixedMatrix<T> const& matrix,
+		vector<FixedVector3>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("FixedVector3::TransformNormal");
+
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		if constexpr (std::is_same_v<T, Fixed16>) {
+			transform(sourceArray.data() + sourceIndex, transformMatrix(matrix, false), destinationArray.data() + destinationIndex, length);
+		}
+		else {
+			for (size_t i = 0; i < length; ++i)
+				destinationArray[destinationIndex + i] = TransformNormal(sourceArray[sourceIndex + i], matrix);
+		}
+	}
+
+	template <typename T>
+	void FixedVector3<T>::TransformNormal(vector<FixedVector3> const& sourceArray, FixedMatrix<T> const& matrix, vector<FixedVector3>& destinationArray) {
+		TransformNormal(sourceArray, 0, matrix, destinationArray, 0, sourceArray.size());
+	}
+
+	template struct FixedVector3<Fixed16>;
+	template struct FixedVector3<Fixed32>;
+}
@@ -0,0 +1,70 @@
+#ifndef _FIXEDVECTOR3_HPP_
+#define _FIXEDVECTOR3_HPP_
+
+#include <cstddef>
+#include <vector>
+#include "FixedPoint.hpp"
+
+namespace Xna {
+
+	struct Vector3;
+	template <typename T> struct FixedMatrix;
+	template <typename T> struct FixedQuaternion;
+
+	// Vector3 over Fixed16 or Fixed32 for deterministic simulation; see FixedPoint for the arithmetic rules.
+	// Dot products and transforms accumulate at double width and round once.
+	template <typename T>
+	struct FixedVector3 {
+		T X;
+		T Y;
+		T Z;
+
+		FixedVector3();
+		FixedVector3(T value);
+		FixedVector3(T x, T y, T z);
+
+		FixedVector3 operator -() const;
+		FixedVector3 operator +(FixedVector3 const& other) const;
+		FixedVector3 operator -(FixedVector3 const& other) const;
+		FixedVector3 operator *(FixedVector3 const& other) const;
+		FixedVector3 operator *(T scaleFactor) const;
+		FixedVector3 operator /(T divider) const;
+		bool operator ==(FixedVector3 const& other) const = default;
+
+		static FixedVector3 FromVector3(Vector3 const& value);
+		Vector3 ToVector3() const;
+
+		T Length() const;
+		T LengthSquared() const;
+
+		static FixedVector3 Clamp(FixedVector3 const& value, FixedVector3 const& min, FixedVector3 const& max);
+		static FixedVector3 Cross(FixedVector3 const& vector1, FixedVector3 const& vector2);
+		static T Distance(FixedVector3 const& value1, FixedVector3 const& value2);
+		static T DistanceSquared(FixedVector3 const& value1, FixedVector3 const& value2);
+		static T Dot(FixedVector3 const& value1, FixedVector3 const& value2);
+		static FixedVector3 Lerp(FixedVector3 const& value1, FixedVector3 const& value2, T amount);
+		static FixedVector3 Max(FixedVector3 const& value1, FixedVector3 const& value2);
+		static FixedVector3 Min(FixedVector3 const& value1, FixedVector3 const& value2);
+		// A zero vector stays zero.
+		static FixedVector3 Normalize(FixedVector3 const& value);
+
+		static FixedVector3 Transform(FixedVector3 const& position, FixedMatrix<T> const& matrix);
+		static FixedVector3 Transform(FixedVector3 const& value, FixedQuaternion<T> const& rotation);
+		static FixedVector3 TransformNormal(FixedVector3 const& normal, FixedMatrix<T> const& matrix);
+
+		// Batch forms with the same results as the scalar functions. Fixed16 arrays use the Simd::Dispatch kernels,
+		// 4 (SSE2) or 8 (AVX2) vectors at a time with 32x32->64-bit integer multiplies; Fixed32 has no such
+		// instruction and stays scalar.
+		static void Transform(std::vector<FixedVector3> const& sourceArray, size_t sourceIndex, FixedMatrix<T> const& matrix,
+			std::vector<FixedVector3>& destinationArray, size_t destinationIndex, size_t length);
+		static void Transform(std::vector<FixedVector3> const& sourceArray, FixedMatrix<T> const& matrix, std::vector<FixedVector3>& destinationArray);
+		static void TransformNormal(std::vector<FixedVector3> const& sourceArray, size_t sourceIndex, FixedMatrix<T> const& matrix,
+			std::vector<FixedVector3>& destinationArray, size_t destinationIndex, size_t length);
+		static void TransformNormal(std::vector<FixedVector3> const& sourceArray, FixedMatrix<T> const& matrix, std::vector<FixedVector3>& destinationArray);
+	};
+
+	using Vector3Fixed16 = FixedVector3<Fixed16>;
+	using Vector3Fixed32 = FixedVector3<Fixed32>;
+}
+
+#endif
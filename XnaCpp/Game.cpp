@@ -0,0 +1,234 @@
+#include <chrono>
+#include <thread>
+#include "Game.hpp"
+#include "GameComponent.hpp"
+#include "Profiler.hpp"
+
+using CSharp::TimeSpan;
+
+//Constructors
+namespace Xna {
+	Game::Game() {}
+
+	Game::~Game() {}
+}
+
+//Functions
+namespace Xna {
+	bool Game::IsFixedTimeStep() const {
+		return _isFixedTimeStep;
+	}
+
+	void Game::IsFixedTimeStep(bool value) {
+		_isFixedTimeStep = value;
+	}
+
+	TimeSpan Game::TargetElapsedTime() const {
+		return _targetElapsedTime;
+	}
+
+	void Game::TargetElapsedTime(TimeSpan value) {
+		_targetElapsedTime = value.Ticks() > 0 ? value : TimeSpan(1);
+
+		if (_maxElapsedTime < _targetElapsedTime)
+			_maxElapsedTime = _targetElapsedTime;
+	}
+
+	TimeSpan Game::MaxElapsedTime() const {
+		return _maxElapsedTime;
+	}
+
+	void Game::MaxElapsedTime(TimeSpan value) {
+		_maxElapsedTime = value < _targetElapsedTime ? _targetElapsedTime : value;
+	}
+
+	int32_t Game::MaxUpdatesPerTick() const {
+		return _maxUpdatesPerTick;
+	}
+
+	void Game::MaxUpdatesPerTick(int32_t value) {
+		_maxUpdatesPerTick = value < 0 ? 0 : value;
+	}
+
+	TimeSpan Game::SpinThreshold() const {
+		return _spinThreshold;
+	}
+
+	void Game::SpinThreshold(TimeSpan value) {
+		_spinThreshold = value.Ticks() > 0 ? value : TimeSpan::Zero;
+	}
+
+	GameComponentCollection& Game::Components() {
+		return _components;
+	}
+
+	GameComponentScheduler& Game::ComponentScheduler() {
+		return _componentScheduler;
+	}
+
+	void Game::Run() {
+		if (!_initialized) {
+			Initialize();
+			_initialized = true;
+		}
+
+		_shouldExit = false;
+
+		BeginRun();
+		ResetElapsedTime();
+
+		while (!_shouldExit)
+			Tick();
+
+		EndRun();
+	}
+
+	void Game::RunOneFrame() {
+		if (!_initialized) {
+			Initialize();
+			_initialized = true;
+		}
+
+		Tick();
+	}
+
+	void Game::Tick() {
+		XNA_PROFILE_FRAME();
+
+		if (!_gameTimer.IsRunning())
+			_gameTimer.Start();
+
+		advanceElapsedTime();
+
+		// Wait out the rest of the frame rather than running an update early.
+		while (_isFixedTimeStep && _accumulatedElapsedTime < _targetElapsedTime) {
+			waitFor(_targetElapsedTime - _accumulatedElapsedTime);
+			advanceElapsedTime();
+		}
+
+		if (_accumulatedElapsedTime > _maxElapsedTime)
+			_accumulatedElapsedTime = _maxElapsedTime;
+
+		if (_isFixedTimeStep) {
+			_gameTime.ElapsedGameTime(_targetElapsedTime);
+			int32_t stepCount = 0;
+
+			while (_accumulatedElapsedTime >= _targetElapsedTime && !_shouldExit) {
+				if (_maxUpdatesPerTick > 0 && stepCount >= _maxUpdatesPerTick) {
+					// Give up on the backlog instead of spiralling; keep only the partial frame.
+					_accumulatedElapsedTime = TimeSpan(_accumulatedElapsedTime.Ticks() % _targetElapsedTime.Ticks());
+					_updateFrameLag = _updateFrameLag > 5 ? _updateFrameLag : 5;
+					break;
+				}
+
+				_gameTime.TotalGameTime(_gameTime.TotalGameTime() + _targetElapsedTime);
+				_accumulatedElapsedTime = _accumulatedElapsedTime - _targetElapsedTime;
+				++stepCount;
+
+				doUpdate(_gameTime);
+			}
+
+			// Every update after the first accumulates lag.
+			_updateFrameLag += stepCount > 1 ? stepCount - 1 : 0;
+
+			// Once running slowly, wait until the lag clears before resetting it.
+			if (_gameTime.IsRunningSlowly()) {
+				if (_updateFrameLag == 0)
+					_gameTime.IsRunningSlowly(false);
+			}
+			else if (_updateFrameLag >= 5) {
+				_gameTime.IsRunningSlowly(true);
+			}
+
+			// A single update per tick means we are keeping up, so the lag decreases.
+			if (stepCount == 1 && _updateFrameLag > 0)
+				--_updateFrameLag;
+
+			// Draw needs to know the total elapsed time that occurred for the fixed length updates.
+			_gameTime.ElapsedGameTime(TimeSpan(_targetElapsedTime.Ticks() * stepCount));
+		}
+		else {
+			_gameTime.ElapsedGameTime(_accumulatedElapsedTime);
+			_gameTime.TotalGameTime(_gameTime.TotalGameTime() + _accumulatedElapsedTime);
+			_accumulatedElapsedTime = TimeSpan::Zero;
+
+			doUpdate(_gameTime);
+		}
+
+		if (_suppressDraw)
+			_suppressDraw = false;
+		else
+			doDraw(_gameTime);
+	}
+
+	void Game::Exit() {
+		_shouldExit = true;
+	}
+
+	void Game::ResetElapsedTime() {
+		_gameTimer.Restart();
+		_accumulatedElapsedTime = TimeSpan::Zero;
+		_gameTime.ElapsedGameTime(TimeSpan::Zero);
+		_previousTicks = 0;
+	}
+
+	void Game::SuppressDraw() {
+		_suppressDraw = true;
+	}
+
+	void Game::Initialize() {
+		// Components added from here on are initialized by the collection as they arrive.
+		for (size_t i = 0; i < _components.Count(); ++i)
+			_components[i]->Initialize();
+
+		_components._initializeOnAdd = true;
+	}
+
+	void Game::BeginRun() {}
+
+	void Game::EndRun() {}
+
+	void Game::Update(GameTime const& gameTime) {
+		_componentScheduler.Update(_components, gameTime);
+	}
+
+	void Game::Draw(GameTime const&) {}
+}
+
+//Private
+namespace Xna {
+	void Game::doUpdate(GameTime const& gameTime) {
+		XNA_PROFILE_ZONE("Game::Update");
+		Update(gameTime);
+	}
+
+	void Game::doDraw(GameTime const& gameTime) {
+		XNA_PROFILE_ZONE("Game::Draw");
+		Draw(gameTime);
+	}
+
+	void Game::advanceElapsedTime() {
+		auto currentTicks = _gameTimer.Elapsed().Ticks();
+		_accumulatedElapsedTime = _accumulatedElapsedTime + TimeSpan(currentTicks - _previousTicks);
+		_previousTicks = currentTicks;
+	}
+
+	void Game::waitFor(TimeSpan duration) {
+		using Ticks = std::chrono::duration<int64_t, std::ratio<1, TimeSpan::TicksPerSecond>>;
+
+		auto deadline = _gameTimer.Elapsed().Ticks() + duration.Ticks();
+
+		// Sleep while the scheduler's wake-up latency cannot overshoot the deadline, then spin the rest.
+		for (;;) {
+			auto remaining = deadline - _gameTimer.Elapsed().Ticks();
+
+			if (remaining <= 0)
+				break;
+
+			if (remaining > _spinThreshold.Ticks())
+				std::this_thread::sleep_for(Ticks(remaining - _spinThreshold.Ticks()));
+			else
+				std::this_thread::yield();
+		}
+	}
+}
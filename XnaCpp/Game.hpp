@@ -0,0 +1,84 @@
+#ifndef _GAME_HPP_
+#define _GAME_HPP_
+
+#include <cstdint>
+#include "GameComponentCollection.hpp"
+#include "GameComponentScheduler.hpp"
+#include "GameTime.hpp"
+#include "CSharp/Stopwatch.hpp"
+#include "CSharp/TimeSpan.hpp"
+
+namespace Xna {
+
+	// Headless port of the XNA Game loop. Derived classes override Update and Draw; Run() drives them
+	// from a monotonic clock in either fixed or variable timestep mode.
+	class Game {
+	public:
+		Game();
+		virtual ~Game();
+
+		bool IsFixedTimeStep() const;
+		void IsFixedTimeStep(bool value);
+
+		// Values are kept positive and MaxElapsedTime() is raised to match if needed.
+		CSharp::TimeSpan TargetElapsedTime() const;
+		void TargetElapsedTime(CSharp::TimeSpan value);
+
+		// The longest stretch of real time a single Tick() will simulate. Never below TargetElapsedTime().
+		CSharp::TimeSpan MaxElapsedTime() const;
+		void MaxElapsedTime(CSharp::TimeSpan value);
+
+		// The most fixed updates one Tick() runs before dropping the backlog and flagging IsRunningSlowly.
+		// 0 lets MaxElapsedTime() alone bound the catch-up, as in XNA.
+		int32_t MaxUpdatesPerTick() const;
+		void MaxUpdatesPerTick(int32_t value);
+
+		// While waiting for the next fixed update the thread sleeps until this much time is left, then spins.
+		CSharp::TimeSpan SpinThreshold() const;
+		void SpinThreshold(CSharp::TimeSpan value);
+
+		GameComponentCollection& Components();
+
+		// Runs the components from Update(); see GameComponentScheduler for how they are parallelized.
+		GameComponentScheduler& ComponentScheduler();
+
+		void Run();
+		void RunOneFrame();
+		void Tick();
+		void Exit();
+		void ResetElapsedTime();
+		void SuppressDraw();
+
+	protected:
+		// The base implementations initialize and update Components(); overrides should call them.
+		virtual void Initialize();
+		virtual void BeginRun();
+		virtual void EndRun();
+		virtual void Update(GameTime const& gameTime);
+		virtual void Draw(GameTime const& gameTime);
+
+	private:
+		GameComponentCollection _components;
+		GameComponentScheduler _componentScheduler;
+		CSharp::Stopwatch _gameTimer;
+		GameTime _gameTime;
+		CSharp::TimeSpan _accumulatedElapsedTime{ CSharp::TimeSpan::Zero };
+		CSharp::TimeSpan _targetElapsedTime{ 166667 };
+		CSharp::TimeSpan _maxElapsedTime{ 500 * CSharp::TimeSpan::TicksPerMillisecond };
+		CSharp::TimeSpan _spinThreshold{ 2 * CSharp::TimeSpan::TicksPerMillisecond };
+		int64_t _previousTicks{ 0 };
+		int32_t _updateFrameLag{ 0 };
+		int32_t _maxUpdatesPerTick{ 0 };
+		bool _isFixedTimeStep{ true };
+		bool _initialized{ false };
+		bool _shouldExit{ false };
+		bool _suppressDraw{ false };
+
+		void doUpdate(GameTime const& gameTime);
+		void doDraw(GameTime const& gameTime);
+		void advanceElapsedTime();
+		void waitFor(CSharp::TimeSpan duration);
+	};
+}
+
+#endif
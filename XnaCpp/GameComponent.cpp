@@ -0,0 +1,92 @@
+#include <algorithm>
+#include "GameComponent.hpp"
+
+using std::string;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		bool insert(vector<string>& resources, string const& resource) {
+			if (std::find(resources.begin(), resources.end(), resource) != resources.end())
+				return false;
+
+			resources.push_back(resource);
+			return true;
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	GameComponent::GameComponent(Xna::Game* game) :
+		_game(game) {}
+
+	GameComponent::~GameComponent() {}
+}
+
+//Functions
+namespace Xna {
+	Game* GameComponent::GetGame() const {
+		return _game;
+	}
+
+	bool GameComponent::Enabled() const {
+		return _enabled;
+	}
+
+	void GameComponent::Enabled(bool value) {
+		_enabled = value;
+	}
+
+	int32_t GameComponent::UpdateOrder() const {
+		return _updateOrder;
+	}
+
+	void GameComponent::UpdateOrder(int32_t value) {
+		if (_updateOrder == value)
+			return;
+
+		_updateOrder = value;
+		++_version;
+	}
+
+	void GameComponent::Initialize() {}
+
+	void GameComponent::Update(GameTime const&) {}
+
+	void GameComponent::DeclareRead(string const& resource) {
+		if (insert(_reads, resource))
+			++_version;
+	}
+
+	void GameComponent::DeclareWrite(string const& resource) {
+		if (insert(_writes, resource))
+			++_version;
+	}
+
+	void GameComponent::ClearDependencies() {
+		if (_reads.empty() && _writes.empty())
+			return;
+
+		_reads.clear();
+		_writes.clear();
+		++_version;
+	}
+
+	vector<string> const& GameComponent::ReadResources() const {
+		return _reads;
+	}
+
+	vector<string> const& GameComponent::WriteResources() const {
+		return _writes;
+	}
+
+	bool GameComponent::HasDependencies() const {
+		return !_reads.empty() || !_writes.empty();
+	}
+
+	uint64_t GameComponent::Version() const {
+		return _version;
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef _GAMECOMPONENT_HPP_
+#define _GAMECOMPONENT_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Xna {
+
+	class Game;
+	class GameTime;
+
+	// Port of the XNA GameComponent. Components may additionally declare the shared resources their Update
+	// reads and writes, which lets GameComponentScheduler run non-conflicting components in parallel.
+	// A component that declares nothing is treated as touching everything and always runs alone.
+	class GameComponent {
+	public:
+		GameComponent(Xna::Game* game);
+		virtual ~GameComponent();
+
+		// Named so the accessor does not hide the Game type inside derived components.
+		Xna::Game* GetGame() const;
+
+		bool Enabled() const;
+		void Enabled(bool value);
+
+		int32_t UpdateOrder() const;
+		void UpdateOrder(int32_t value);
+
+		virtual void Initialize();
+		virtual void Update(GameTime const& gameTime);
+
+		// Resources are arbitrary names agreed on by the components, e.g. "Physics.Bodies".
+		void DeclareRead(std::string const& resource);
+		void DeclareWrite(std::string const& resource);
+		void ClearDependencies();
+
+		std::vector<std::string> const& ReadResources() const;
+		std::vector<std::string> const& WriteResources() const;
+		bool HasDependencies() const;
+
+		// Changes whenever UpdateOrder or the declared dependencies change.
+		uint64_t Version() const;
+
+	private:
+		Xna::Game* _game{ nullptr };
+		std::vector<std::string> _reads;
+		std::vector<std::string> _writes;
+		uint64_t _version{ 0 };
+		int32_t _updateOrder{ 0 };
+		bool _enabled{ true };
+	};
+}
+
+#endif
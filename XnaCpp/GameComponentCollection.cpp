@@ -0,0 +1,105 @@
+#include <algorithm>
+#include "GameComponent.hpp"
+#include "GameComponentCollection.hpp"
+
+using std::shared_ptr;
+
+//Operators
+namespace Xna {
+	shared_ptr<GameComponent> const& GameComponentCollection::operator [](size_t index) const {
+		return _items[index];
+	}
+}
+
+//Functions
+namespace Xna {
+	bool GameComponentCollection::Add(shared_ptr<GameComponent> const& item) {
+		if (!item || Contains(item))
+			return false;
+
+		if (_deferring) {
+			defer(Change::Add, item);
+			return true;
+		}
+
+		_items.push_back(item);
+		++_version;
+
+		if (_initializeOnAdd)
+			item->Initialize();
+
+		return true;
+	}
+
+	bool GameComponentCollection::Remove(shared_ptr<GameComponent> const& item) {
+		auto it = std::find(_items.begin(), _items.end(), item);
+
+		if (it == _items.end())
+			return false;
+
+		if (_deferring) {
+			defer(Change::Remove, item);
+			return true;
+		}
+
+		_items.erase(it);
+		++_version;
+
+		return true;
+	}
+
+	bool GameComponentCollection::Contains(shared_ptr<GameComponent> const& item) const {
+		return std::find(_items.begin(), _items.end(), item) != _items.end();
+	}
+
+	void GameComponentCollection::Clear() {
+		if (_deferring) {
+			defer(Change::Clear, nullptr);
+			return;
+		}
+
+		if (_items.empty())
+			return;
+
+		_items.clear();
+		++_version;
+	}
+
+	size_t GameComponentCollection::Count() const {
+		return _items.size();
+	}
+
+	uint64_t GameComponentCollection::Version() const {
+		return _version;
+	}
+}
+
+//Private
+namespace Xna {
+	void GameComponentCollection::defer(Change change, shared_ptr<GameComponent> const& item) {
+		std::lock_guard<std::mutex> lock(_changesMutex);
+		_changes.emplace_back(change, item);
+	}
+
+	void GameComponentCollection::applyDeferred() {
+		_deferring = false;
+
+		// Taken first: components initialized by Add may change the collection again, directly this time.
+		auto changes = std::move(_changes);
+		_changes.clear();
+
+		for (auto const& change : changes) {
+			switch (change.first) {
+			case Change::Add:
+				Add(change.second);
+				break;
+			case Change::Remove:
+				Remove(change.second);
+				break;
+			case Change::Clear:
+				Clear();
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,56 @@
+#ifndef _GAMECOMPONENTCOLLECTION_HPP_
+#define _GAMECOMPONENTCOLLECTION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Xna {
+
+	class GameComponent;
+
+	// Port of the XNA GameComponentCollection. Once the owning Game has initialized, components added
+	// to its collection are initialized as they are added.
+	// While GameComponentScheduler updates the collection, Add, Remove and Clear may be called from any component's
+	// Update. They are queued and applied in call order once every component has updated, as XNA updates a copy of
+	// the collection; their results reflect the collection as it was when the update began.
+	class GameComponentCollection {
+	public:
+		// Null and duplicate components are rejected and return false.
+		bool Add(std::shared_ptr<GameComponent> const& item);
+		bool Remove(std::shared_ptr<GameComponent> const& item);
+		bool Contains(std::shared_ptr<GameComponent> const& item) const;
+		void Clear();
+
+		size_t Count() const;
+		std::shared_ptr<GameComponent> const& operator [](size_t index) const;
+
+		// Changes whenever a component is added or removed.
+		uint64_t Version() const;
+
+	private:
+		friend class Game;
+		friend class GameComponentScheduler;
+
+		enum class Change {
+			Add,
+			Remove,
+			Clear
+		};
+
+		std::vector<std::shared_ptr<GameComponent>> _items;
+		std::vector<std::pair<Change, std::shared_ptr<GameComponent>>> _changes;
+		std::mutex _changesMutex;
+		uint64_t _version{ 0 };
+		bool _initializeOnAdd{ false };
+		bool _deferring{ false };
+
+		void defer(Change change, std::shared_ptr<GameComponent> const& item);
+		void applyDeferred();
+	};
+}
+
+#endif
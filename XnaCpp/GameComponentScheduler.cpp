@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <string>
+#include "GameComponent.hpp"
+#include "GameComponentCollection.hpp"
+#include "GameComponentScheduler.hpp"
+#include "Profiler.hpp"
+
+using std::string;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		bool intersects(vector<string> const& a, vector<string> const& b) {
+			for (auto const& resource : a) {
+				if (std::find(b.begin(), b.end(), resource) != b.end())
+					return true;
+			}
+
+			return false;
+		}
+
+		bool conflicts(GameComponent const& a, GameComponent const& b) {
+			if (!a.HasDependencies() || !b.HasDependencies())
+				return true;
+
+			return intersects(a.WriteResources(), b.WriteResources())
+				|| intersects(a.WriteResources(), b.ReadResources())
+				|| intersects(a.ReadResources(), b.WriteResources());
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	GameComponentScheduler::GameComponentScheduler(size_t threadCount) :
+		_threadCount(threadCount) {}
+}
+
+//Functions
+namespace Xna {
+	size_t GameComponentScheduler::ThreadCount() const {
+		return _threadCount;
+	}
+
+	void GameComponentScheduler::ThreadCount(size_t value) {
+		if (_threadCount == value)
+			return;
+
+		_threadCount = value;
+		_executor.reset();
+	}
+
+	void GameComponentScheduler::Update(GameComponentCollection& components, GameTime const& gameTime) {
+		XNA_PROFILE_ZONE("GameComponentScheduler::Update");
+
+		if (!isCurrent(components))
+			build(components);
+
+		if (_graph.Count() == 0)
+			return;
+
+		// Threads are only started once there is something to run.
+		if (!_executor)
+			_executor = std::make_unique<WorkStealingExecutor>(_threadCount);
+
+		_gameTime = &gameTime;
+		components._deferring = true;
+		_executor->Run(_graph);
+		components.applyDeferred();
+		_gameTime = nullptr;
+	}
+
+	size_t GameComponentScheduler::CriticalPathLength() const {
+		return _criticalPathLength;
+	}
+}
+
+//Private
+namespace Xna {
+	bool GameComponentScheduler::isCurrent(GameComponentCollection const& components) const {
+		if (!_built || _collectionVersion != components.Version() || _signature.size() != components.Count())
+			return false;
+
+		for (size_t i = 0; i < _signature.size(); ++i) {
+			auto component = components[i].get();
+
+			if (_signature[i].first != component || _signature[i].second != component->Version())
+				return false;
+		}
+
+		return true;
+	}
+
+	void GameComponentScheduler::build(GameComponentCollection const& components) {
+		auto count = components.Count();
+
+		_signature.clear();
+		_signature.reserve(count);
+
+		// The tasks share ownership, so a component removed during an update outlives its task.
+		vector<std::shared_ptr<GameComponent>> order;
+		order.reserve(count);
+
+		for (size_t i = 0; i < count; ++i) {
+			auto const& component = components[i];
+			_signature.emplace_back(component.get(), component->Version());
+			order.push_back(component);
+		}
+
+		std::stable_sort(order.begin(), order.end(), [](auto const& a, auto const& b) {
+			return a->UpdateOrder() < b->UpdateOrder();
+			});
+
+		_graph.Clear();
+
+		for (auto const& component : order) {
+			_graph.Add([this, component]() {
+				if (!component->Enabled())
+					return;
+
+				XNA_PROFILE_ZONE("GameComponent::Update");
+				component->Update(*_gameTime);
+				});
+		}
+
+		// Depth of each task along its longest chain of predecessors.
+		vector<size_t> depth(count, 1);
+		_criticalPathLength = count == 0 ? 0 : 1;
+
+		for (size_t j = 1; j < count; ++j) {
+			for (size_t i = 0; i < j; ++i) {
+				if (!conflicts(*order[i], *order[j]))
+					continue;
+
+				_graph.Precede(i, j);
+				depth[j] = std::max(depth[j], depth[i] + 1);
+			}
+
+			_criticalPathLength = std::max(_criticalPathLength, depth[j]);
+		}
+
+		_collectionVersion = components.Version();
+		_built = true;
+	}
+}
@@ -0,0 +1,53 @@
+#ifndef _GAMECOMPONENTSCHEDULER_HPP_
+#define _GAMECOMPONENTSCHEDULER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "TaskGraph.hpp"
+#include "WorkStealingExecutor.hpp"
+
+namespace Xna {
+
+	class GameComponent;
+	class GameComponentCollection;
+	class GameTime;
+
+	// Updates a GameComponentCollection through a task graph. Components are ordered by UpdateOrder, then by
+	// position in the collection, and a component waits only for earlier ones it conflicts with: a write
+	// against a read or write of the same resource, or either side declaring no dependencies at all.
+	// The graph is built once and re-run every tick; it is rebuilt when components are added or removed or
+	// when a component's UpdateOrder or dependencies change. Disabled components are skipped at run time.
+	// The graph holds its own references to the components, and changes made to the collection during Update are
+	// applied once the graph has finished; see GameComponentCollection.
+	class GameComponentScheduler {
+	public:
+		// threadCount includes the updating thread; 0 uses every processor.
+		GameComponentScheduler(size_t threadCount = 0);
+
+		size_t ThreadCount() const;
+		void ThreadCount(size_t value);
+
+		void Update(GameComponentCollection& components, GameTime const& gameTime);
+
+		// Tasks on the longest chain of the current graph; equal to the component count when nothing can overlap.
+		size_t CriticalPathLength() const;
+
+	private:
+		std::unique_ptr<WorkStealingExecutor> _executor;
+		TaskGraph _graph;
+		std::vector<std::pair<GameComponent*, uint64_t>> _signature;
+		GameTime const* _gameTime{ nullptr };
+		uint64_t _collectionVersion{ 0 };
+		size_t _threadCount{ 0 };
+		size_t _criticalPathLength{ 0 };
+		bool _built{ false };
+
+		bool isCurrent(GameComponentCollection const& components) const;
+		void build(GameComponentCollection const& components);
+	};
+}
+
+#endif
@@ -11,11 +11,23 @@ namespace Xna {
 		return totalGameTime;
 	}
 
+	void GameTime::TotalGameTime(TimeSpan value) {
+		totalGameTime = value;
+	}
+
 	TimeSpan GameTime::ElapsedGameTime() const {
 		return elapsedGameTime;
 	}
 
+	void GameTime::ElapsedGameTime(TimeSpan value) {
+		elapsedGameTime = value;
+	}
+
 	bool GameTime::IsRunningSlowly() const {
 		return isRunningSlowly;
 	}
+
+	void GameTime::IsRunningSlowly(bool value) {
+		isRunningSlowly = value;
+	}
 }
\ No newline at end of file
@@ -9,13 +9,16 @@ namespace Xna {
 		CSharp::TimeSpan elapsedGameTime{ CSharp::TimeSpan::Zero };
 		bool isRunningSlowly{ false };
 
+	public:
 		GameTime();
 		GameTime(CSharp::TimeSpan totalGameTime, CSharp::TimeSpan elapsedGameTime, bool isRunningSlowly = false);
 
-	public:
 		CSharp::TimeSpan TotalGameTime() const;
+		void TotalGameTime(CSharp::TimeSpan value);
 		CSharp::TimeSpan ElapsedGameTime() const;
+		void ElapsedGameTime(CSharp::TimeSpan value);
 		bool IsRunningSlowly() const;
+		void IsRunningSlowly(bool value);
 	};
 }
 
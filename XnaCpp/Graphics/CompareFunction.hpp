@@ -0,0 +1,33 @@
+#ifndef _COMPAREFUNCTION_HPP_
+#define _COMPAREFUNCTION_HPP_
+
+namespace Xna {
+	enum class CompareFunction {
+
+		// Always passes the test.
+		Always,
+
+		// Never passes the test.
+		Never,
+
+		// Passes if the new value is less than the stored value.
+		Less,
+
+		// Passes if the new value is less than or equal to the stored value.
+		LessEqual,
+
+		// Passes if the new value is equal to the stored value.
+		Equal,
+
+		// Passes if the new value is greater than or equal to the stored value.
+		GreaterEqual,
+
+		// Passes if the new value is greater than the stored value.
+		Greater,
+
+		// Passes if the new value does not equal the stored value.
+		NotEqual
+	};
+}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef _CULLMODE_HPP_
+#define _CULLMODE_HPP_
+
+namespace Xna {
+	enum class CullMode {
+
+		// Triangles are drawn regardless of winding.
+		None,
+
+		// Triangles that wind clockwise on screen are culled.
+		CullClockwiseFace,
+
+		// Triangles that wind counter-clockwise on screen are culled.
+		CullCounterClockwiseFace
+	};
+}
+
+#endif
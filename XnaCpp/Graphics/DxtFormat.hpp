@@ -0,0 +1,18 @@
+#ifndef _DXTFORMAT_HPP_
+#define _DXTFORMAT_HPP_
+
+namespace Xna {
+	enum class DxtFormat {
+
+		// BC1. 8 bytes per 4x4 block, optional 1-bit alpha. Same as SurfaceFormat.Dxt1.
+		Dxt1,
+
+		// BC2. 16 bytes per 4x4 block with explicit 4-bit alpha. Same as SurfaceFormat.Dxt3.
+		Dxt3,
+
+		// BC3. 16 bytes per 4x4 block with interpolated alpha. Same as SurfaceFormat.Dxt5.
+		Dxt5
+	};
+}
+
+#endif
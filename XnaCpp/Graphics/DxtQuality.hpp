@@ -0,0 +1,18 @@
+#ifndef _DXTQUALITY_HPP_
+#define _DXTQUALITY_HPP_
+
+namespace Xna {
+	enum class DxtQuality {
+
+		// Endpoints from the bounding box of the block colors.
+		Fast,
+
+		// Endpoints along the principal axis of the block colors.
+		Normal,
+
+		// Principal axis followed by least-squares endpoint refinement.
+		High
+	};
+}
+
+#endif
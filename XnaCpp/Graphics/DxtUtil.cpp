@@ -0,0 +1,643 @@
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "DxtUtil.hpp"
+#include "../Color.hpp"
+#include "../Parallel.hpp"
+#include "../Profiler.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		// A block of 16 pixels as R, G, B, A bytes.
+		using Block = uint8_t[16][4];
+
+		inline uint16_t readUInt16(uint8_t const* data) {
+			return static_cast<uint16_t>(data[0] | (data[1] << 8));
+		}
+
+		inline uint32_t readUInt32(uint8_t const* data) {
+			return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+				| (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+		}
+
+		inline void writeUInt16(uint8_t* data, uint16_t value) {
+			data[0] = static_cast<uint8_t>(value);
+			data[1] = static_cast<uint8_t>(value >> 8);
+		}
+
+		inline void writeUInt32(uint8_t* data, uint32_t value) {
+			for (int32_t i = 0; i < 4; ++i)
+				data[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+
+		inline void convertRgb565ToRgb888(uint16_t color, uint8_t* rgb) {
+			int32_t temp = (color >> 11) * 255 + 16;
+			rgb[0] = static_cast<uint8_t>((temp / 32 + temp) / 32);
+			temp = ((color & 0x07E0) >> 5) * 255 + 32;
+			rgb[1] = static_cast<uint8_t>((temp / 64 + temp) / 64);
+			temp = (color & 0x001F) * 255 + 16;
+			rgb[2] = static_cast<uint8_t>((temp / 32 + temp) / 32);
+		}
+
+		inline int32_t quantize(float value, int32_t maximum) {
+			auto scaled = static_cast<int32_t>(value * maximum / 255.0F + 0.5F);
+			return scaled < 0 ? 0 : (scaled > maximum ? maximum : scaled);
+		}
+
+		inline uint16_t convertRgb888ToRgb565(float const* rgb) {
+			return static_cast<uint16_t>((quantize(rgb[0], 31) << 11) | (quantize(rgb[1], 63) << 5) | quantize(rgb[2], 31));
+		}
+
+		// Builds the four palette entries the decoder produces for a pair of endpoints.
+		void colorPalette(uint16_t c0, uint16_t c1, bool fourColor, uint8_t palette[4][4]) {
+			convertRgb565ToRgb888(c0, palette[0]);
+			convertRgb565ToRgb888(c1, palette[1]);
+
+			for (int32_t c = 0; c < 3; ++c) {
+				auto p0 = palette[0][c];
+				auto p1 = palette[1][c];
+
+				if (fourColor) {
+					palette[2][c] = static_cast<uint8_t>((2 * p0 + p1) / 3);
+					palette[3][c] = static_cast<uint8_t>((p0 + 2 * p1) / 3);
+				}
+				else {
+					palette[2][c] = static_cast<uint8_t>((p0 + p1) / 2);
+					palette[3][c] = 0;
+				}
+			}
+
+			palette[0][3] = palette[1][3] = palette[2][3] = 255;
+			palette[3][3] = fourColor ? 255 : 0;
+		}
+
+		// Decodes the color half of a block. Dxt3 and Dxt5 always use the four-color palette.
+		void decodeColorBlock(uint8_t const* data, bool dxt1, Block pixels) {
+			auto c0 = readUInt16(data);
+			auto c1 = readUInt16(data + 2);
+			auto lookupTable = readUInt32(data + 4);
+
+			uint8_t palette[4][4];
+			colorPalette(c0, c1, !dxt1 || c0 > c1, palette);
+
+			for (int32_t i = 0; i < 16; ++i)
+				std::memcpy(pixels[i], palette[(lookupTable >> (2 * i)) & 0x03], 4);
+		}
+
+		void decodeDxt3Alpha(uint8_t const* data, Block pixels) {
+			for (int32_t i = 0; i < 16; ++i) {
+				auto nibble = (data[i >> 1] >> ((i & 1) * 4)) & 0x0F;
+				pixels[i][3] = static_cast<uint8_t>(nibble | (nibble << 4));
+			}
+		}
+
+		void alphaPalette(uint8_t alpha0, uint8_t alpha1, uint8_t palette[8]) {
+			palette[0] = alpha0;
+			palette[1] = alpha1;
+
+			if (alpha0 > alpha1) {
+				for (int32_t i = 2; i < 8; ++i)
+					palette[i] = static_cast<uint8_t>(((8 - i) * alpha0 + (i - 1) * alpha1) / 7);
+			}
+			else {
+				for (int32_t i = 2; i < 6; ++i)
+					palette[i] = static_cast<uint8_t>(((6 - i) * alpha0 + (i - 1) * alpha1) / 5);
+
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+		}
+
+		void decodeDxt5Alpha(uint8_t const* data, Block pixels) {
+			uint8_t palette[8];
+			alphaPalette(data[0], data[1], palette);
+
+			uint64_t alphaMask = 0;
+			for (int32_t i = 0; i < 6; ++i)
+				alphaMask |= static_cast<uint64_t>(data[2 + i]) << (8 * i);
+
+			for (int32_t i = 0; i < 16; ++i)
+				pixels[i][3] = palette[(alphaMask >> (3 * i)) & 0x07];
+		}
+
+		void decodeBlock(DxtFormat format, uint8_t const* data, Block pixels) {
+			switch (format) {
+			case DxtFormat::Dxt1:
+				decodeColorBlock(data, true, pixels);
+				break;
+			case DxtFormat::Dxt3:
+				decodeColorBlock(data + 8, false, pixels);
+				decodeDxt3Alpha(data, pixels);
+				break;
+			case DxtFormat::Dxt5:
+				decodeColorBlock(data + 8, false, pixels);
+				decodeDxt5Alpha(data, pixels);
+				break;
+			}
+		}
+
+		// Reads a block, repeating the last row and column for blocks that overhang the image.
+		void readBlock(Color const* image, int32_t width, int32_t height, int32_t blockX, int32_t blockY, Block pixels) {
+			for (int32_t y = 0; y < 4; ++y) {
+				auto py = blockY * 4 + y < height ? blockY * 4 + y : height - 1;
+
+				for (int32_t x = 0; x < 4; ++x) {
+					auto px = blockX * 4 + x < width ? blockX * 4 + x : width - 1;
+					std::memcpy(pixels[y * 4 + x], image + static_cast<size_t>(py) * width + px, 4);
+				}
+			}
+		}
+
+		void writeBlock(Block const pixels, int32_t width, int32_t height, int32_t blockX, int32_t blockY, Color* image) {
+			auto columns = width - blockX * 4 < 4 ? width - blockX * 4 : 4;
+			auto rows = height - blockY * 4 < 4 ? height - blockY * 4 : 4;
+
+			for (int32_t y = 0; y < rows; ++y)
+				std::memcpy(image + static_cast<size_t>(blockY * 4 + y) * width + blockX * 4, pixels[y * 4], columns * 4);
+		}
+
+		inline int32_t squaredDistance(uint8_t const* a, uint8_t const* b) {
+			auto dr = a[0] - b[0];
+			auto dg = a[1] - b[1];
+			auto db = a[2] - b[2];
+			return dr * dr + dg * dg + db * db;
+		}
+
+		struct ColorFit {
+			uint16_t C0{ 0 };
+			uint16_t C1{ 0 };
+			uint32_t Indices{ 0 };
+			int32_t Error{ std::numeric_limits<int32_t>::max() };
+		};
+
+		// Orders the endpoints for the requested palette mode and picks the nearest entry for each pixel.
+		// Pixels flagged as transparent use index 3 of the three-color palette.
+		ColorFit fitColors(uint16_t c0, uint16_t c1, bool threeColor, Block const pixels, bool const transparent[16]) {
+			ColorFit fit;
+
+			if (threeColor ? c0 > c1 : c0 < c1) {
+				auto swap = c0;
+				c0 = c1;
+				c1 = swap;
+			}
+
+			fit.C0 = c0;
+			fit.C1 = c1;
+			fit.Error = 0;
+
+			// Equal endpoints decode as the three-color palette whose first entry is the only color needed.
+			auto fourColor = !threeColor && c0 != c1;
+			auto entries = fourColor ? 4 : 3;
+
+			uint8_t palette[4][4];
+			colorPalette(c0, c1, fourColor, palette);
+
+			for (int32_t i = 0; i < 16; ++i) {
+				uint32_t index = 3;
+
+				if (!transparent[i]) {
+					auto best = std::numeric_limits<int32_t>::max();
+
+					for (int32_t p = 0; p < entries; ++p) {
+						auto error = squaredDistance(pixels[i], palette[p]);
+
+						if (error < best) {
+							best = error;
+							index = static_cast<uint32_t>(p);
+						}
+					}
+
+					fit.Error += best;
+				}
+
+				fit.Indices |= index << (2 * i);
+			}
+
+			return fit;
+		}
+
+		// Solves for the endpoints that minimize the squared error of the current index assignment.
+		bool refineEndpoints(ColorFit const& fit, bool threeColor, Block const pixels, bool const transparent[16],
+			float endpoint0[3], float endpoint1[3]) {
+
+			auto fourColor = !threeColor && fit.C0 != fit.C1;
+			float aa = 0, ab = 0, bb = 0;
+			float ax[3] = { 0, 0, 0 };
+			float bx[3] = { 0, 0, 0 };
+
+			for (int32_t i = 0; i < 16; ++i) {
+				if (transparent[i])
+					continue;
+
+				auto index = (fit.Indices >> (2 * i)) & 0x03;
+				float a = 1.0F;
+
+				if (index == 1)
+					a = 0.0F;
+				else if (index == 2)
+					a = fourColor ? 2.0F / 3.0F : 0.5F;
+				else if (index == 3)
+					a = 1.0F / 3.0F;
+
+				auto b = 1.0F - a;
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+
+				for (int32_t c = 0; c < 3; ++c) {
+					ax[c] += a * pixels[i][c];
+					bx[c] += b * pixels[i][c];
+				}
+			}
+
+			auto determinant = aa * bb - ab * ab;
+
+			if (std::fabs(determinant) < 1e-6F)
+				return false;
+
+			for (int32_t c = 0; c < 3; ++c) {
+				endpoint0[c] = (bb * ax[c] - ab * bx[c]) / determinant;
+				endpoint1[c] = (aa * bx[c] - ab * ax[c]) / determinant;
+			}
+
+			return true;
+		}
+
+		void encodeColorBlock(Block const pixels, bool dxt1, DxtQuality quality, uint8_t* data) {
+			bool transparent[16];
+			int32_t count = 0;
+
+			for (int32_t i = 0; i < 16; ++i) {
+				transparent[i] = dxt1 && pixels[i][3] < 128;
+				count += transparent[i] ? 0 : 1;
+			}
+
+			auto threeColor = count < 16;
+
+			if (count == 0) {
+				writeUInt16(data, 0);
+				writeUInt16(data + 2, 0);
+				writeUInt32(data + 4, 0xFFFFFFFF);
+				return;
+			}
+
+			float minimum[3] = { 255, 255, 255 };
+			float maximum[3] = { 0, 0, 0 };
+			float mean[3] = { 0, 0, 0 };
+
+			for (int32_t i = 0; i < 16; ++i) {
+				if (transparent[i])
+					continue;
+
+				for (int32_t c = 0; c < 3; ++c) {
+					float value = pixels[i][c];
+					minimum[c] = value < minimum[c] ? value : minimum[c];
+					maximum[c] = value > maximum[c] ? value : maximum[c];
+					mean[c] += value;
+				}
+			}
+
+			float endpoint0[3], endpoint1[3];
+
+			if (quality == DxtQuality::Fast) {
+				for (int32_t c = 0; c < 3; ++c) {
+					endpoint0[c] = maximum[c];
+					endpoint1[c] = minimum[c];
+				}
+			}
+			else {
+				float covariance[6] = { 0, 0, 0, 0, 0, 0 };
+
+				for (int32_t c = 0; c < 3; ++c)
+					mean[c] /= count;
+
+				for (int32_t i = 0; i < 16; ++i) {
+					if (transparent[i])
+						continue;
+
+					auto r = pixels[i][0] - mean[0];
+					auto g = pixels[i][1] - mean[1];
+					auto b = pixels[i][2] - mean[2];
+
+					covariance[0] += r * r;
+					covariance[1] += r * g;
+					covariance[2] += r * b;
+					covariance[3] += g * g;
+					covariance[4] += g * b;
+					covariance[5] += b * b;
+				}
+
+				// Power iteration for the principal axis, seeded with the bounding box diagonal.
+				float axis[3] = { maximum[0] - minimum[0], maximum[1] - minimum[1], maximum[2] - minimum[2] };
+
+				for (int32_t iteration = 0; iteration < 8; ++iteration) {
+					float next[3] = {
+						covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+						covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+						covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]
+					};
+
+					auto length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+
+					if (length < 1e-6F)
+						break;
+
+					for (int32_t c = 0; c < 3; ++c)
+						axis[c] = next[c] / length;
+				}
+
+				auto tMinimum = std::numeric_limits<float>::max();
+				auto tMaximum = -std::numeric_limits<float>::max();
+
+				for (int32_t i = 0; i < 16; ++i) {
+					if (transparent[i])
+						continue;
+
+					auto t = (pixels[i][0] - mean[0]) * axis[0] + (pixels[i][1] - mean[1]) * axis[1] + (pixels[i][2] - mean[2]) * axis[2];
+					tMinimum = t < tMinimum ? t : tMinimum;
+					tMaximum = t > tMaximum ? t : tMaximum;
+				}
+
+				for (int32_t c = 0; c < 3; ++c) {
+					endpoint0[c] = mean[c] + tMaximum * axis[c];
+					endpoint1[c] = mean[c] + tMinimum * axis[c];
+				}
+			}
+
+			// Pull the endpoints in slightly so the interpolated entries land closer to the block colors.
+			for (int32_t c = 0; c < 3; ++c) {
+				auto inset = (endpoint0[c] - endpoint1[c]) / 16.0F;
+				endpoint0[c] -= inset;
+				endpoint1[c] += inset;
+			}
+
+			auto fit = fitColors(convertRgb888ToRgb565(endpoint0), convertRgb888ToRgb565(endpoint1), threeColor, pixels, transparent);
+
+			if (quality == DxtQuality::High) {
+				for (int32_t iteration = 0; iteration < 3 && fit.Error > 0; ++iteration) {
+					if (!refineEndpoints(fit, threeColor, pixels, transparent, endpoint0, endpoint1))
+						break;
+
+					auto refined = fitColors(convertRgb888ToRgb565(endpoint0), convertRgb888ToRgb565(endpoint1), threeColor, pixels, transparent);
+
+					if (refined.Error >= fit.Error)
+						break;
+
+					fit = refined;
+				}
+			}
+
+			writeUInt16(data, fit.C0);
+			writeUInt16(data + 2, fit.C1);
+			writeUInt32(data + 4, fit.Indices);
+		}
+
+		void encodeDxt3Alpha(Block const pixels, uint8_t* data) {
+			std::memset(data, 0, 8);
+
+			for (int32_t i = 0; i < 16; ++i) {
+				auto nibble = (pixels[i][3] * 15 + 127) / 255;
+				data[i >> 1] |= static_cast<uint8_t>(nibble << ((i & 1) * 4));
+			}
+		}
+
+		int32_t fitAlpha(uint8_t alpha0, uint8_t alpha1, Block const pixels, uint64_t& alphaMask) {
+			uint8_t palette[8];
+			alphaPalette(alpha0, alpha1, palette);
+
+			int32_t total = 0;
+			alphaMask = 0;
+
+			for (int32_t i = 0; i < 16; ++i) {
+				auto best = std::numeric_limits<int32_t>::max();
+				uint64_t index = 0;
+
+				for (int32_t p = 0; p < 8; ++p) {
+					auto error = (pixels[i][3] - palette[p]) * (pixels[i][3] - palette[p]);
+
+					if (error < best) {
+						best = error;
+						index = static_cast<uint64_t>(p);
+					}
+				}
+
+				total += best;
+				alphaMask |= index << (3 * i);
+			}
+
+			return total;
+		}
+
+		void encodeDxt5Alpha(Block const pixels, DxtQuality quality, uint8_t* data) {
+			uint8_t minimum = 255, maximum = 0;
+			uint8_t innerMinimum = 255, innerMaximum = 0;
+
+			for (int32_t i = 0; i < 16; ++i) {
+				auto alpha = pixels[i][3];
+				minimum = alpha < minimum ? alpha : minimum;
+				maximum = alpha > maximum ? alpha : maximum;
+
+				if (alpha != 0 && alpha != 255) {
+					innerMinimum = alpha < innerMinimum ? alpha : innerMinimum;
+					innerMaximum = alpha > innerMaximum ? alpha : innerMaximum;
+				}
+			}
+
+			// Eight interpolated values between the extremes.
+			uint8_t alpha0 = maximum;
+			uint8_t alpha1 = minimum;
+			uint64_t alphaMask = 0;
+			auto error = fitAlpha(alpha0, alpha1, pixels, alphaMask);
+
+			// Six interpolated values plus exact 0 and 255, which suits blocks with hard edges.
+			if (quality != DxtQuality::Fast && error > 0 && innerMinimum <= innerMaximum) {
+				uint64_t mask = 0;
+				auto candidate = fitAlpha(innerMinimum, innerMaximum, pixels, mask);
+
+				if (candidate < error) {
+					alpha0 = innerMinimum;
+					alpha1 = innerMaximum;
+					alphaMask = mask;
+				}
+			}
+
+			data[0] = alpha0;
+			data[1] = alpha1;
+
+			for (int32_t i = 0; i < 6; ++i)
+				data[2 + i] = static_cast<uint8_t>(alphaMask >> (8 * i));
+		}
+
+		void encodeBlock(DxtFormat format, Block const pixels, DxtQuality quality, uint8_t* data) {
+			switch (format) {
+			case DxtFormat::Dxt1:
+				encodeColorBlock(pixels, true, quality, data);
+				break;
+			case DxtFormat::Dxt3:
+				encodeDxt3Alpha(pixels, data);
+				encodeColorBlock(pixels, false, quality, data + 8);
+				break;
+			case DxtFormat::Dxt5:
+				encodeDxt5Alpha(pixels, quality, data);
+				encodeColorBlock(pixels, false, quality, data + 8);
+				break;
+			}
+		}
+	}
+}
+
+//Static
+namespace Xna {
+	size_t DxtUtil::BlockSize(DxtFormat format) {
+		return format == DxtFormat::Dxt1 ? 8 : 16;
+	}
+
+	size_t DxtUtil::CompressedSize(DxtFormat format, int32_t width, int32_t height) {
+		if (width <= 0 || height <= 0)
+			return 0;
+
+		auto blockCountX = static_cast<size_t>((width + 3) / 4);
+		auto blockCountY = static_cast<size_t>((height + 3) / 4);
+
+		return blockCountX * blockCountY * BlockSize(format);
+	}
+
+	vector<Color> DxtUtil::DecompressDxt1(vector<uint8_t> const& imageData, int32_t width, int32_t height) {
+		vector<Color> image;
+		Decompress(DxtFormat::Dxt1, imageData, width, height, image);
+		return image;
+	}
+
+	vector<Color> DxtUtil::DecompressDxt3(vector<uint8_t> const& imageData, int32_t width, int32_t height) {
+		vector<Color> image;
+		Decompress(DxtFormat::Dxt3, imageData, width, height, image);
+		return image;
+	}
+
+	vector<Color> DxtUtil::DecompressDxt5(vector<uint8_t> const& imageData, int32_t width, int32_t height) {
+		vector<Color> image;
+		Decompress(DxtFormat::Dxt5, imageData, width, height, image);
+		return image;
+	}
+
+	void DxtUtil::Decompress(DxtFormat format, vector<uint8_t> const& imageData, int32_t width, int32_t height,
+		vector<Color>& destination, size_t threadCount) {
+		XNA_PROFILE_ZONE("DxtUtil::Decompress");
+
+		if (width <= 0 || height <= 0)
+			return;
+
+		destination.resize(static_cast<size_t>(width) * height);
+
+		auto blockSize = BlockSize(format);
+		auto blockCountX = (width + 3) / 4;
+		auto blockCountY = static_cast<size_t>((height + 3) / 4);
+		auto rowSize = blockSize * blockCountX;
+		auto rows = imageData.size() / rowSize < blockCountY ? imageData.size() / rowSize : blockCountY;
+
+		Parallel::For(0, rows, threadCount, [&](size_t row) {
+			auto data = imageData.data() + row * rowSize;
+			Block pixels;
+
+			for (int32_t x = 0; x < blockCountX; ++x, data += blockSize) {
+				decodeBlock(format, data, pixels);
+				writeBlock(pixels, width, height, x, static_cast<int32_t>(row), destination.data());
+			}
+			});
+	}
+
+	vector<uint8_t> DxtUtil::Compress(DxtFormat format, vector<Color> const& image, int32_t width, int32_t height,
+		DxtQuality quality, size_t threadCount) {
+		vector<uint8_t> data;
+		Compress(format, image, width, height, data, quality, threadCount);
+		return data;
+	}
+
+	void DxtUtil::Compress(DxtFormat format, vector<Color> const& image, int32_t width, int32_t height,
+		vector<uint8_t>& destination, DxtQuality quality, size_t threadCount) {
+		XNA_PROFILE_ZONE("DxtUtil::Compress");
+
+		if (width <= 0 || height <= 0 || image.size() < static_cast<size_t>(width) * height)
+			return;
+
+		destination.resize(CompressedSize(format, width, height));
+
+		auto blockSize = BlockSize(format);
+		auto blockCountX = (width + 3) / 4;
+		auto blockCountY = static_cast<size_t>((height + 3) / 4);
+		auto rowSize = blockSize * blockCountX;
+
+		Parallel::For(0, blockCountY, threadCount, [&](size_t row) {
+			auto data = destination.data() + row * rowSize;
+			Block pixels;
+
+			for (int32_t x = 0; x < blockCountX; ++x, data += blockSize) {
+				readBlock(image.data(), width, height, x, static_cast<int32_t>(row), pixels);
+				encodeBlock(format, pixels, quality, data);
+			}
+			});
+	}
+
+	double DxtUtil::Psnr(vector<Color> const& reference, vector<Color> const& image, bool includeAlpha) {
+		auto count = reference.size() < image.size() ? reference.size() : image.size();
+		auto channels = includeAlpha ? 4 : 3;
+		double sum = 0;
+
+		for (size_t i = 0; i < count; ++i) {
+			uint8_t a[4], b[4];
+			std::memcpy(a, &reference[i], 4);
+			std::memcpy(b, &image[i], 4);
+
+			for (int32_t c = 0; c < channels; ++c) {
+				double difference = static_cast<double>(a[c]) - b[c];
+				sum += difference * difference;
+			}
+		}
+
+		if (count == 0 || sum == 0)
+			return std::numeric_limits<double>::infinity();
+
+		auto mse = sum / (static_cast<double>(count) * channels);
+		return 10.0 * std::log10(255.0 * 255.0 / mse);
+	}
+
+	DxtBenchmarkResult DxtUtil::Benchmark(DxtFormat format, vector<Color> const& image, int32_t width, int32_t height,
+		DxtQuality quality, size_t threadCount, int32_t iterations) {
+
+		using Clock = std::chrono::steady_clock;
+
+		DxtBenchmarkResult result;
+
+		if (width <= 0 || height <= 0 || iterations <= 0)
+			return result;
+
+		vector<uint8_t> compressed;
+		vector<Color> decompressed;
+		Clock::duration encodeTime{}, decodeTime{};
+
+		for (int32_t i = 0; i < iterations; ++i) {
+			auto start = Clock::now();
+			Compress(format, image, width, height, compressed, quality, threadCount);
+			auto middle = Clock::now();
+			Decompress(format, compressed, width, height, decompressed, threadCount);
+			auto end = Clock::now();
+
+			encodeTime += middle - start;
+			decodeTime += end - middle;
+		}
+
+		auto megapixels = static_cast<double>(width) * height * iterations / 1e6;
+		auto encodeSeconds = std::chrono::duration<double>(encodeTime).count();
+		auto decodeSeconds = std::chrono::duration<double>(decodeTime).count();
+
+		result.EncodeMegapixelsPerSecond = encodeSeconds > 0 ? megapixels / encodeSeconds : 0;
+		result.DecodeMegapixelsPerSecond = decodeSeconds > 0 ? megapixels / decodeSeconds : 0;
+		result.Psnr = Psnr(image, decompressed, format != DxtFormat::Dxt1);
+
+		return result;
+	}
+}
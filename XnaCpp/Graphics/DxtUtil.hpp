@@ -0,0 +1,49 @@
+#ifndef _DXTUTIL_HPP_
+#define _DXTUTIL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "DxtFormat.hpp"
+#include "DxtQuality.hpp"
+
+namespace Xna {
+
+	struct Color;
+
+	struct DxtBenchmarkResult {
+		double EncodeMegapixelsPerSecond{ 0 };
+		double DecodeMegapixelsPerSecond{ 0 };
+		double Psnr{ 0 };
+	};
+
+	// Block compression of Color buffers to and from DXT1/3/5 (BC1/2/3).
+	// Images are row-major; partial blocks at the right and bottom edges are handled.
+	// Block rows are independent and are distributed over threadCount threads (0 uses every processor).
+	class DxtUtil {
+	public:
+		static size_t BlockSize(DxtFormat format);
+		static size_t CompressedSize(DxtFormat format, int32_t width, int32_t height);
+
+		static std::vector<Color> DecompressDxt1(std::vector<uint8_t> const& imageData, int32_t width, int32_t height);
+		static std::vector<Color> DecompressDxt3(std::vector<uint8_t> const& imageData, int32_t width, int32_t height);
+		static std::vector<Color> DecompressDxt5(std::vector<uint8_t> const& imageData, int32_t width, int32_t height);
+		static void Decompress(DxtFormat format, std::vector<uint8_t> const& imageData, int32_t width, int32_t height,
+			std::vector<Color>& destination, size_t threadCount = 1);
+
+		static std::vector<uint8_t> Compress(DxtFormat format, std::vector<Color> const& image, int32_t width, int32_t height,
+			DxtQuality quality = DxtQuality::Normal, size_t threadCount = 1);
+		static void Compress(DxtFormat format, std::vector<Color> const& image, int32_t width, int32_t height,
+			std::vector<uint8_t>& destination, DxtQuality quality = DxtQuality::Normal, size_t threadCount = 1);
+
+		// Peak signal-to-noise ratio in dB over the RGB channels, and alpha when includeAlpha is set.
+		// Identical images return infinity.
+		static double Psnr(std::vector<Color> const& reference, std::vector<Color> const& image, bool includeAlpha = false);
+
+		// Times iterations round trips of the image and reports throughput and the PSNR of the decoded result.
+		static DxtBenchmarkResult Benchmark(DxtFormat format, std::vector<Color> const& image, int32_t width, int32_t height,
+			DxtQuality quality = DxtQuality::Normal, size_t threadCount = 1, int32_t iterations = 1);
+	};
+}
+
+#endif
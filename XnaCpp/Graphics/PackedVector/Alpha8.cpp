@@ -0,0 +1,93 @@
+#include <cmath>
+#include "Alpha8.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Alpha8::Alpha8() {}
+
+	Alpha8::Alpha8(float alpha) :
+		_packedValue(pack(alpha)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Alpha8 const& a, Alpha8 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Alpha8 const& a, Alpha8 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Alpha8::Pack(vector<float> const& sourceArray, size_t sourceIndex,
+		vector<Alpha8>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToUInt8(&sourceArray[sourceIndex], &destinationArray[destinationIndex], length, 255.0F, 0.0F, 255.0F);
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = Alpha8(sourceArray[sourceIndex + i]);
+	}
+
+	void Alpha8::Pack(vector<float> const& sourceArray, vector<Alpha8>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Alpha8::Unpack(vector<Alpha8> const& sourceArray, size_t sourceIndex,
+		vector<float>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromUInt8(&sourceArray[sourceIndex], &destinationArray[destinationIndex], length, 255.0F);
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToAlpha();
+	}
+
+	void Alpha8::Unpack(vector<Alpha8> const& sourceArray, vector<float>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint8_t Alpha8::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Alpha8::PackedValue(uint8_t value) {
+		_packedValue = value;
+	}
+
+	void Alpha8::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.W);
+	}
+
+	float Alpha8::ToAlpha() const {
+		return _packedValue / 255.0F;
+	}
+
+	Vector4 Alpha8::ToVector4() const {
+		return Vector4(0.0F, 0.0F, 0.0F, _packedValue / 255.0F);
+	}
+
+	bool Alpha8::Equals(Alpha8 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint8_t Alpha8::pack(float alpha) {
+		return static_cast<uint8_t>(std::nearbyint(MathHelper::Clamp(alpha, 0.0F, 1.0F) * 255.0F));
+	}
+}
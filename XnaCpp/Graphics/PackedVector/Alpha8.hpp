@@ -0,0 +1,39 @@
+#ifndef _ALPHA8_HPP_
+#define _ALPHA8_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct Alpha8 {
+		Alpha8();
+		Alpha8(float alpha);
+
+		friend bool operator ==(Alpha8 const& a, Alpha8 const& b);
+		friend bool operator !=(Alpha8 const& a, Alpha8 const& b);
+
+		static void Pack(std::vector<float> const& sourceArray, size_t sourceIndex,
+			std::vector<Alpha8>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<float> const& sourceArray, std::vector<Alpha8>& destinationArray);
+		static void Unpack(std::vector<Alpha8> const& sourceArray, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Alpha8> const& sourceArray, std::vector<float>& destinationArray);
+
+		uint8_t PackedValue() const;
+		void PackedValue(uint8_t value);
+		void PackFromVector4(Vector4 const& vector);
+		float ToAlpha() const;
+		Vector4 ToVector4() const;
+		bool Equals(Alpha8 const& other) const;
+
+	private:
+		uint8_t _packedValue{ 0 };
+
+		static uint8_t pack(float alpha);
+	};
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include <cmath>
+#include "Bgr565.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector3.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Bgr565::Bgr565() {}
+
+	Bgr565::Bgr565(float x, float y, float z) :
+		_packedValue(pack(x, y, z)) {}
+
+	Bgr565::Bgr565(Vector3 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Bgr565 const& a, Bgr565 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Bgr565 const& a, Bgr565 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Bgr565::Pack(vector<Vector3> const& sourceArray, size_t sourceIndex,
+		vector<Bgr565>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = Bgr565(sourceArray[sourceIndex + i]);
+	}
+
+	void Bgr565::Pack(vector<Vector3> const& sourceArray, vector<Bgr565>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Bgr565::Unpack(vector<Bgr565> const& sourceArray, size_t sourceIndex,
+		vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector3();
+	}
+
+	void Bgr565::Unpack(vector<Bgr565> const& sourceArray, vector<Vector3>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint16_t Bgr565::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Bgr565::PackedValue(uint16_t value) {
+		_packedValue = value;
+	}
+
+	void Bgr565::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z);
+	}
+
+	Vector3 Bgr565::ToVector3() const {
+		return Vector3(
+			((_packedValue >> 11) & 0x1F) * (1.0F / 31.0F),
+			((_packedValue >> 5) & 0x3F) * (1.0F / 63.0F),
+			(_packedValue & 0x1F) * (1.0F / 31.0F));
+	}
+
+	Vector4 Bgr565::ToVector4() const {
+		return Vector4(ToVector3(), 1.0F);
+	}
+
+	bool Bgr565::Equals(Bgr565 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint16_t Bgr565::pack(float x, float y, float z) {
+		return static_cast<uint16_t>(
+			((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, 0.0F, 1.0F) * 31.0F)) & 0x1F) << 11)
+			| ((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, 0.0F, 1.0F) * 63.0F)) & 0x3F) << 5)
+			| (static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(z, 0.0F, 1.0F) * 31.0F)) & 0x1F));
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef _BGR565_HPP_
+#define _BGR565_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector3;
+	struct Vector4;
+
+	struct Bgr565 {
+		Bgr565();
+		Bgr565(float x, float y, float z);
+		Bgr565(Vector3 const& vector);
+
+		friend bool operator ==(Bgr565 const& a, Bgr565 const& b);
+		friend bool operator !=(Bgr565 const& a, Bgr565 const& b);
+
+		static void Pack(std::vector<Vector3> const& sourceArray, size_t sourceIndex,
+			std::vector<Bgr565>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector3> const& sourceArray, std::vector<Bgr565>& destinationArray);
+		static void Unpack(std::vector<Bgr565> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Bgr565> const& sourceArray, std::vector<Vector3>& destinationArray);
+
+		uint16_t PackedValue() const;
+		void PackedValue(uint16_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector3 ToVector3() const;
+		Vector4 ToVector4() const;
+		bool Equals(Bgr565 const& other) const;
+
+	private:
+		uint16_t _packedValue{ 0 };
+
+		static uint16_t pack(float x, float y, float z);
+	};
+}
+
+#endif
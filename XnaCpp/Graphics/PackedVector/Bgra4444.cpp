@@ -0,0 +1,91 @@
+#include <cmath>
+#include "Bgra4444.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Bgra4444::Bgra4444() {}
+
+	Bgra4444::Bgra4444(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	Bgra4444::Bgra4444(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Bgra4444 const& a, Bgra4444 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Bgra4444 const& a, Bgra4444 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Bgra4444::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Bgra4444>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = Bgra4444(sourceArray[sourceIndex + i]);
+	}
+
+	void Bgra4444::Pack(vector<Vector4> const& sourceArray, vector<Bgra4444>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Bgra4444::Unpack(vector<Bgra4444> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void Bgra4444::Unpack(vector<Bgra4444> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint16_t Bgra4444::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Bgra4444::PackedValue(uint16_t value) {
+		_packedValue = value;
+	}
+
+	void Bgra4444::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 Bgra4444::ToVector4() const {
+		constexpr float maxVal = 1.0F / 15.0F;
+
+		return Vector4(
+			((_packedValue >> 8) & 0x0F) * maxVal,
+			((_packedValue >> 4) & 0x0F) * maxVal,
+			(_packedValue & 0x0F) * maxVal,
+			((_packedValue >> 12) & 0x0F) * maxVal);
+	}
+
+	bool Bgra4444::Equals(Bgra4444 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint16_t Bgra4444::pack(float x, float y, float z, float w) {
+		return static_cast<uint16_t>(
+			((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(w, 0.0F, 1.0F) * 15.0F)) & 0x0F) << 12)
+			| ((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, 0.0F, 1.0F) * 15.0F)) & 0x0F) << 8)
+			| ((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, 0.0F, 1.0F) * 15.0F)) & 0x0F) << 4)
+			| (static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(z, 0.0F, 1.0F) * 15.0F)) & 0x0F));
+	}
+}
@@ -0,0 +1,39 @@
+#ifndef _BGRA4444_HPP_
+#define _BGRA4444_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct Bgra4444 {
+		Bgra4444();
+		Bgra4444(float x, float y, float z, float w);
+		Bgra4444(Vector4 const& vector);
+
+		friend bool operator ==(Bgra4444 const& a, Bgra4444 const& b);
+		friend bool operator !=(Bgra4444 const& a, Bgra4444 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Bgra4444>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<Bgra4444>& destinationArray);
+		static void Unpack(std::vector<Bgra4444> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Bgra4444> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint16_t PackedValue() const;
+		void PackedValue(uint16_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(Bgra4444 const& other) const;
+
+	private:
+		uint16_t _packedValue{ 0 };
+
+		static uint16_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include <cmath>
+#include "Bgra5551.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Bgra5551::Bgra5551() {}
+
+	Bgra5551::Bgra5551(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	Bgra5551::Bgra5551(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Bgra5551 const& a, Bgra5551 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Bgra5551 const& a, Bgra5551 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Bgra5551::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Bgra5551>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = Bgra5551(sourceArray[sourceIndex + i]);
+	}
+
+	void Bgra5551::Pack(vector<Vector4> const& sourceArray, vector<Bgra5551>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Bgra5551::Unpack(vector<Bgra5551> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void Bgra5551::Unpack(vector<Bgra5551> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint16_t Bgra5551::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Bgra5551::PackedValue(uint16_t value) {
+		_packedValue = value;
+	}
+
+	void Bgra5551::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 Bgra5551::ToVector4() const {
+		return Vector4(
+			((_packedValue >> 10) & 0x1F) / 31.0F,
+			((_packedValue >> 5) & 0x1F) / 31.0F,
+			(_packedValue & 0x1F) / 31.0F,
+			static_cast<float>((_packedValue >> 15) & 0x01));
+	}
+
+	bool Bgra5551::Equals(Bgra5551 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint16_t Bgra5551::pack(float x, float y, float z, float w) {
+		return static_cast<uint16_t>(
+			((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, 0.0F, 1.0F) * 31.0F)) & 0x1F) << 10)
+			| ((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, 0.0F, 1.0F) * 31.0F)) & 0x1F) << 5)
+			| (static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(z, 0.0F, 1.0F) * 31.0F)) & 0x1F)
+			| ((static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(w, 0.0F, 1.0F))) & 0x1) << 15));
+	}
+}
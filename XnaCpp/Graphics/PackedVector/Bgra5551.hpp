@@ -0,0 +1,39 @@
+#ifndef _BGRA5551_HPP_
+#define _BGRA5551_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct Bgra5551 {
+		Bgra5551();
+		Bgra5551(float x, float y, float z, float w);
+		Bgra5551(Vector4 const& vector);
+
+		friend bool operator ==(Bgra5551 const& a, Bgra5551 const& b);
+		friend bool operator !=(Bgra5551 const& a, Bgra5551 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Bgra5551>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<Bgra5551>& destinationArray);
+		static void Unpack(std::vector<Bgra5551> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Bgra5551> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint16_t PackedValue() const;
+		void PackedValue(uint16_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(Bgra5551 const& other) const;
+
+	private:
+		uint16_t _packedValue{ 0 };
+
+		static uint16_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
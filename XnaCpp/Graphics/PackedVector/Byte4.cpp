@@ -0,0 +1,99 @@
+#include <cmath>
+#include "Byte4.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Byte4::Byte4() {}
+
+	Byte4::Byte4(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	Byte4::Byte4(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Byte4 const& a, Byte4 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Byte4 const& a, Byte4 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Byte4::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Byte4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToUInt8(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 4, 1.0F, 0.0F, 255.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = Byte4(sourceArray[sourceIndex + i]);
+	}
+
+	void Byte4::Pack(vector<Vector4> const& sourceArray, vector<Byte4>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Byte4::Unpack(vector<Byte4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromUInt8(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 4, 1.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void Byte4::Unpack(vector<Byte4> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t Byte4::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Byte4::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void Byte4::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 Byte4::ToVector4() const {
+		return Vector4(
+			static_cast<float>(_packedValue & 0xFF),
+			static_cast<float>((_packedValue >> 8) & 0xFF),
+			static_cast<float>((_packedValue >> 16) & 0xFF),
+			static_cast<float>((_packedValue >> 24) & 0xFF));
+	}
+
+	bool Byte4::Equals(Byte4 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t Byte4::pack(float x, float y, float z, float w) {
+		return (static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(x, 0.0F, 255.0F))) & 0xFF)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(y, 0.0F, 255.0F))) & 0xFF) << 8)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(z, 0.0F, 255.0F))) & 0xFF) << 16)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(w, 0.0F, 255.0F))) & 0xFF) << 24);
+	}
+}
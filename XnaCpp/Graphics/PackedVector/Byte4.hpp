@@ -0,0 +1,39 @@
+#ifndef _BYTE4_HPP_
+#define _BYTE4_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct Byte4 {
+		Byte4();
+		Byte4(float x, float y, float z, float w);
+		Byte4(Vector4 const& vector);
+
+		friend bool operator ==(Byte4 const& a, Byte4 const& b);
+		friend bool operator !=(Byte4 const& a, Byte4 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Byte4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<Byte4>& destinationArray);
+		static void Unpack(std::vector<Byte4> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Byte4> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint32_t PackedValue() const;
+		void PackedValue(uint32_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(Byte4 const& other) const;
+
+	private:
+		uint32_t _packedValue{ 0 };
+
+		static uint32_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <cmath>
+#include "HalfSingle.hpp"
+#include "HalfTypeHelper.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	HalfSingle::HalfSingle() {}
+
+	HalfSingle::HalfSingle(float single) :
+		_packedValue(pack(single)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(HalfSingle const& a, HalfSingle const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(HalfSingle const& a, HalfSingle const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void HalfSingle::Pack(vector<float> const& sourceArray, size_t sourceIndex,
+		vector<HalfSingle>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToHalf(&sourceArray[sourceIndex], &destinationArray[destinationIndex], length);
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = HalfSingle(sourceArray[sourceIndex + i]);
+	}
+
+	void HalfSingle::Pack(vector<float> const& sourceArray, vector<HalfSingle>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void HalfSingle::Unpack(vector<HalfSingle> const& sourceArray, size_t sourceIndex,
+		vector<float>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromHalf(&sourceArray[sourceIndex], &destinationArray[destinationIndex], length);
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToSingle();
+	}
+
+	void HalfSingle::Unpack(vector<HalfSingle> const& sourceArray, vector<float>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint16_t HalfSingle::PackedValue() const {
+		return _packedValue;
+	}
+
+	void HalfSingle::PackedValue(uint16_t value) {
+		_packedValue = value;
+	}
+
+	void HalfSingle::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X);
+	}
+
+	float HalfSingle::ToSingle() const {
+		return HalfTypeHelper::Convert(_packedValue);
+	}
+
+	Vector4 HalfSingle::ToVector4() const {
+		return Vector4(ToSingle(), 0.0F, 0.0F, 1.0F);
+	}
+
+	bool HalfSingle::Equals(HalfSingle const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint16_t HalfSingle::pack(float single) {
+		return HalfTypeHelper::Convert(single);
+	}
+}
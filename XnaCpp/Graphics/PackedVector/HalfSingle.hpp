@@ -0,0 +1,39 @@
+#ifndef _HALFSINGLE_HPP_
+#define _HALFSINGLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct HalfSingle {
+		HalfSingle();
+		HalfSingle(float single);
+
+		friend bool operator ==(HalfSingle const& a, HalfSingle const& b);
+		friend bool operator !=(HalfSingle const& a, HalfSingle const& b);
+
+		static void Pack(std::vector<float> const& sourceArray, size_t sourceIndex,
+			std::vector<HalfSingle>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<float> const& sourceArray, std::vector<HalfSingle>& destinationArray);
+		static void Unpack(std::vector<HalfSingle> const& sourceArray, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<HalfSingle> const& sourceArray, std::vector<float>& destinationArray);
+
+		uint16_t PackedValue() const;
+		void PackedValue(uint16_t value);
+		void PackFromVector4(Vector4 const& vector);
+		float ToSingle() const;
+		Vector4 ToVector4() const;
+		bool Equals(HalfSingle const& other) const;
+
+	private:
+		uint16_t _packedValue{ 0 };
+
+		static uint16_t pack(float single);
+	};
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include <cstring>
+#include "HalfTypeHelper.hpp"
+
+namespace Xna {
+	uint16_t HalfTypeHelper::Convert(float value) {
+		int32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return Convert(bits);
+	}
+
+	uint16_t HalfTypeHelper::Convert(int32_t bits) {
+		int32_t s = (bits >> 16) & 0x00008000;
+		int32_t e = ((bits >> 23) & 0x000000ff) - (127 - 15);
+		int32_t m = bits & 0x007fffff;
+
+		if (e <= 0) {
+			if (e < -10)
+				return static_cast<uint16_t>(s);
+
+			m = m | 0x00800000;
+
+			int32_t t = 14 - e;
+			int32_t a = (1 << (t - 1)) - 1;
+			int32_t b = (m >> t) & 1;
+
+			m = (m + a + b) >> t;
+			return static_cast<uint16_t>(s | m);
+		}
+
+		if (e == 0xff - (127 - 15)) {
+			if (m == 0)
+				return static_cast<uint16_t>(s | 0x7c00);
+
+			m >>= 13;
+			return static_cast<uint16_t>(s | 0x7c00 | m | ((m == 0) ? 1 : 0));
+		}
+
+		m = m + 0x00000fff + ((m >> 13) & 1);
+
+		if ((m & 0x00800000) != 0) {
+			m = 0;
+			e += 1;
+		}
+
+		if (e > 30)
+			return static_cast<uint16_t>(s | 0x7c00);
+
+		return static_cast<uint16_t>(s | (e << 10) | (m >> 13));
+	}
+
+	float HalfTypeHelper::Convert(uint16_t value) {
+		uint32_t rst;
+		uint32_t mantissa = static_cast<uint32_t>(value & 1023);
+		uint32_t exp = 0xfffffff2;
+
+		if ((value & 0x7c00) == 0) {
+			if (mantissa != 0) {
+				while ((mantissa & 1024) == 0) {
+					exp--;
+					mantissa = mantissa << 1;
+				}
+
+				mantissa &= 0xfffffbff;
+				rst = ((static_cast<uint32_t>(value) & 0x8000) << 16) | ((exp + 127) << 23) | (mantissa << 13);
+			}
+			else {
+				rst = (static_cast<uint32_t>(value) & 0x8000) << 16;
+			}
+		}
+		else if ((value & 0x7c00) == 0x7c00) {
+			rst = ((static_cast<uint32_t>(value) & 0x8000) << 16) | 0x7f800000 | (mantissa << 13);
+		}
+		else {
+			rst = ((static_cast<uint32_t>(value) & 0x8000) << 16)
+				| ((((static_cast<uint32_t>(value) >> 10) & 0x1f) - 15 + 127) << 23)
+				| (mantissa << 13);
+		}
+
+		float result;
+		std::memcpy(&result, &rst, sizeof(result));
+		return result;
+	}
+}
@@ -0,0 +1,15 @@
+#ifndef _HALFTYPEHELPER_HPP_
+#define _HALFTYPEHELPER_HPP_
+
+#include <cstdint>
+
+namespace Xna {
+	class HalfTypeHelper {
+	public:
+		static uint16_t Convert(float value);
+		static uint16_t Convert(int32_t bits);
+		static float Convert(uint16_t value);
+	};
+}
+
+#endif
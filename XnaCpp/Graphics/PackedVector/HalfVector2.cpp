@@ -0,0 +1,102 @@
+#include <cmath>
+#include "HalfVector2.hpp"
+#include "HalfTypeHelper.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector2.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	HalfVector2::HalfVector2() {}
+
+	HalfVector2::HalfVector2(float x, float y) :
+		_packedValue(pack(x, y)) {}
+
+	HalfVector2::HalfVector2(Vector2 const& vector) :
+		_packedValue(pack(vector.X, vector.Y)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(HalfVector2 const& a, HalfVector2 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(HalfVector2 const& a, HalfVector2 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void HalfVector2::Pack(vector<Vector2> const& sourceArray, size_t sourceIndex,
+		vector<HalfVector2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToHalf(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 2) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = HalfVector2(sourceArray[sourceIndex + i]);
+	}
+
+	void HalfVector2::Pack(vector<Vector2> const& sourceArray, vector<HalfVector2>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void HalfVector2::Unpack(vector<HalfVector2> const& sourceArray, size_t sourceIndex,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromHalf(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 2) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector2();
+	}
+
+	void HalfVector2::Unpack(vector<HalfVector2> const& sourceArray, vector<Vector2>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t HalfVector2::PackedValue() const {
+		return _packedValue;
+	}
+
+	void HalfVector2::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void HalfVector2::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y);
+	}
+
+	Vector2 HalfVector2::ToVector2() const {
+		return Vector2(
+			HalfTypeHelper::Convert(static_cast<uint16_t>(_packedValue)),
+			HalfTypeHelper::Convert(static_cast<uint16_t>(_packedValue >> 16)));
+	}
+
+	Vector4 HalfVector2::ToVector4() const {
+		auto vector = ToVector2();
+		return Vector4(vector.X, vector.Y, 0.0F, 1.0F);
+	}
+
+	bool HalfVector2::Equals(HalfVector2 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t HalfVector2::pack(float x, float y) {
+		return static_cast<uint32_t>(HalfTypeHelper::Convert(x))
+			| (static_cast<uint32_t>(HalfTypeHelper::Convert(y)) << 16);
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef _HALFVECTOR2_HPP_
+#define _HALFVECTOR2_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector2;
+	struct Vector4;
+
+	struct HalfVector2 {
+		HalfVector2();
+		HalfVector2(float x, float y);
+		HalfVector2(Vector2 const& vector);
+
+		friend bool operator ==(HalfVector2 const& a, HalfVector2 const& b);
+		friend bool operator !=(HalfVector2 const& a, HalfVector2 const& b);
+
+		static void Pack(std::vector<Vector2> const& sourceArray, size_t sourceIndex,
+			std::vector<HalfVector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector2> const& sourceArray, std::vector<HalfVector2>& destinationArray);
+		static void Unpack(std::vector<HalfVector2> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<HalfVector2> const& sourceArray, std::vector<Vector2>& destinationArray);
+
+		uint32_t PackedValue() const;
+		void PackedValue(uint32_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector2 ToVector2() const;
+		Vector4 ToVector4() const;
+		bool Equals(HalfVector2 const& other) const;
+
+	private:
+		uint32_t _packedValue{ 0 };
+
+		static uint32_t pack(float x, float y);
+	};
+}
+
+#endif
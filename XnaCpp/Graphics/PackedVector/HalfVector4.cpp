@@ -0,0 +1,100 @@
+#include <cmath>
+#include "HalfVector4.hpp"
+#include "HalfTypeHelper.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	HalfVector4::HalfVector4() {}
+
+	HalfVector4::HalfVector4(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	HalfVector4::HalfVector4(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(HalfVector4 const& a, HalfVector4 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(HalfVector4 const& a, HalfVector4 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void HalfVector4::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<HalfVector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToHalf(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 4) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = HalfVector4(sourceArray[sourceIndex + i]);
+	}
+
+	void HalfVector4::Pack(vector<Vector4> const& sourceArray, vector<HalfVector4>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void HalfVector4::Unpack(vector<HalfVector4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromHalf(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 4) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void HalfVector4::Unpack(vector<HalfVector4> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint64_t HalfVector4::PackedValue() const {
+		return _packedValue;
+	}
+
+	void HalfVector4::PackedValue(uint64_t value) {
+		_packedValue = value;
+	}
+
+	void HalfVector4::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 HalfVector4::ToVector4() const {
+		return Vector4(
+			HalfTypeHelper::Convert(static_cast<uint16_t>(_packedValue)),
+			HalfTypeHelper::Convert(static_cast<uint16_t>(_packedValue >> 16)),
+			HalfTypeHelper::Convert(static_cast<uint16_t>(_packedValue >> 32)),
+			HalfTypeHelper::Convert(static_cast<uint16_t>(_packedValue >> 48)));
+	}
+
+	bool HalfVector4::Equals(HalfVector4 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint64_t HalfVector4::pack(float x, float y, float z, float w) {
+		return static_cast<uint64_t>(HalfTypeHelper::Convert(x))
+			| (static_cast<uint64_t>(HalfTypeHelper::Convert(y)) << 16)
+			| (static_cast<uint64_t>(HalfTypeHelper::Convert(z)) << 32)
+			| (static_cast<uint64_t>(HalfTypeHelper::Convert(w)) << 48);
+	}
+}
@@ -0,0 +1,39 @@
+#ifndef _HALFVECTOR4_HPP_
+#define _HALFVECTOR4_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct HalfVector4 {
+		HalfVector4();
+		HalfVector4(float x, float y, float z, float w);
+		HalfVector4(Vector4 const& vector);
+
+		friend bool operator ==(HalfVector4 const& a, HalfVector4 const& b);
+		friend bool operator !=(HalfVector4 const& a, HalfVector4 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<HalfVector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<HalfVector4>& destinationArray);
+		static void Unpack(std::vector<HalfVector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<HalfVector4> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint64_t PackedValue() const;
+		void PackedValue(uint64_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(HalfVector4 const& other) const;
+
+	private:
+		uint64_t _packedValue{ 0 };
+
+		static uint64_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
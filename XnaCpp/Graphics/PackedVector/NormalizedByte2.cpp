@@ -0,0 +1,102 @@
+#include <cmath>
+#include "NormalizedByte2.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector2.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	NormalizedByte2::NormalizedByte2() {}
+
+	NormalizedByte2::NormalizedByte2(float x, float y) :
+		_packedValue(pack(x, y)) {}
+
+	NormalizedByte2::NormalizedByte2(Vector2 const& vector) :
+		_packedValue(pack(vector.X, vector.Y)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(NormalizedByte2 const& a, NormalizedByte2 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(NormalizedByte2 const& a, NormalizedByte2 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void NormalizedByte2::Pack(vector<Vector2> const& sourceArray, size_t sourceIndex,
+		vector<NormalizedByte2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToInt8(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 2, 127.0F, -127.0F, 127.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = NormalizedByte2(sourceArray[sourceIndex + i]);
+	}
+
+	void NormalizedByte2::Pack(vector<Vector2> const& sourceArray, vector<NormalizedByte2>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void NormalizedByte2::Unpack(vector<NormalizedByte2> const& sourceArray, size_t sourceIndex,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromInt8(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 2, 127.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector2();
+	}
+
+	void NormalizedByte2::Unpack(vector<NormalizedByte2> const& sourceArray, vector<Vector2>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint16_t NormalizedByte2::PackedValue() const {
+		return _packedValue;
+	}
+
+	void NormalizedByte2::PackedValue(uint16_t value) {
+		_packedValue = value;
+	}
+
+	void NormalizedByte2::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y);
+	}
+
+	Vector2 NormalizedByte2::ToVector2() const {
+		return Vector2(
+			static_cast<int8_t>(_packedValue & 0xFF) / 127.0F,
+			static_cast<int8_t>((_packedValue >> 8) & 0xFF) / 127.0F);
+	}
+
+	Vector4 NormalizedByte2::ToVector4() const {
+		return Vector4(ToVector2(), 0.0F, 1.0F);
+	}
+
+	bool NormalizedByte2::Equals(NormalizedByte2 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint16_t NormalizedByte2::pack(float x, float y) {
+		auto byte2 = (static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, -1.0F, 1.0F) * 127.0F)) & 0xFF);
+		auto byte1 = (static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, -1.0F, 1.0F) * 127.0F)) & 0xFF) << 8;
+
+		return static_cast<uint16_t>(byte2 | byte1);
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef _NORMALIZEDBYTE2_HPP_
+#define _NORMALIZEDBYTE2_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector2;
+	struct Vector4;
+
+	struct NormalizedByte2 {
+		NormalizedByte2();
+		NormalizedByte2(float x, float y);
+		NormalizedByte2(Vector2 const& vector);
+
+		friend bool operator ==(NormalizedByte2 const& a, NormalizedByte2 const& b);
+		friend bool operator !=(NormalizedByte2 const& a, NormalizedByte2 const& b);
+
+		static void Pack(std::vector<Vector2> const& sourceArray, size_t sourceIndex,
+			std::vector<NormalizedByte2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector2> const& sourceArray, std::vector<NormalizedByte2>& destinationArray);
+		static void Unpack(std::vector<NormalizedByte2> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<NormalizedByte2> const& sourceArray, std::vector<Vector2>& destinationArray);
+
+		uint16_t PackedValue() const;
+		void PackedValue(uint16_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector2 ToVector2() const;
+		Vector4 ToVector4() const;
+		bool Equals(NormalizedByte2 const& other) const;
+
+	private:
+		uint16_t _packedValue{ 0 };
+
+		static uint16_t pack(float x, float y);
+	};
+}
+
+#endif
@@ -0,0 +1,101 @@
+#include <cmath>
+#include "NormalizedByte4.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	NormalizedByte4::NormalizedByte4() {}
+
+	NormalizedByte4::NormalizedByte4(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	NormalizedByte4::NormalizedByte4(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(NormalizedByte4 const& a, NormalizedByte4 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(NormalizedByte4 const& a, NormalizedByte4 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void NormalizedByte4::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<NormalizedByte4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToInt8(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 4, 127.0F, -127.0F, 127.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = NormalizedByte4(sourceArray[sourceIndex + i]);
+	}
+
+	void NormalizedByte4::Pack(vector<Vector4> const& sourceArray, vector<NormalizedByte4>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void NormalizedByte4::Unpack(vector<NormalizedByte4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromInt8(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 4, 127.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void NormalizedByte4::Unpack(vector<NormalizedByte4> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t NormalizedByte4::PackedValue() const {
+		return _packedValue;
+	}
+
+	void NormalizedByte4::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void NormalizedByte4::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 NormalizedByte4::ToVector4() const {
+		return Vector4(
+			static_cast<int8_t>(_packedValue & 0xFF) / 127.0F,
+			static_cast<int8_t>((_packedValue >> 8) & 0xFF) / 127.0F,
+			static_cast<int8_t>((_packedValue >> 16) & 0xFF) / 127.0F,
+			static_cast<int8_t>((_packedValue >> 24) & 0xFF) / 127.0F);
+	}
+
+	bool NormalizedByte4::Equals(NormalizedByte4 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t NormalizedByte4::pack(float x, float y, float z, float w) {
+		auto byte4 = (static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, -1.0F, 1.0F) * 127.0F))) & 0xFF);
+		auto byte3 = (static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, -1.0F, 1.0F) * 127.0F))) & 0xFF) << 8;
+		auto byte2 = (static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(z, -1.0F, 1.0F) * 127.0F))) & 0xFF) << 16;
+		auto byte1 = (static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(w, -1.0F, 1.0F) * 127.0F))) & 0xFF) << 24;
+
+		return byte4 | byte3 | byte2 | byte1;
+	}
+}
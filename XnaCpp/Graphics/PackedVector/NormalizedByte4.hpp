@@ -0,0 +1,39 @@
+#ifndef _NORMALIZEDBYTE4_HPP_
+#define _NORMALIZEDBYTE4_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct NormalizedByte4 {
+		NormalizedByte4();
+		NormalizedByte4(float x, float y, float z, float w);
+		NormalizedByte4(Vector4 const& vector);
+
+		friend bool operator ==(NormalizedByte4 const& a, NormalizedByte4 const& b);
+		friend bool operator !=(NormalizedByte4 const& a, NormalizedByte4 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<NormalizedByte4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<NormalizedByte4>& destinationArray);
+		static void Unpack(std::vector<NormalizedByte4> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<NormalizedByte4> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint32_t PackedValue() const;
+		void PackedValue(uint32_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(NormalizedByte4 const& other) const;
+
+	private:
+		uint32_t _packedValue{ 0 };
+
+		static uint32_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
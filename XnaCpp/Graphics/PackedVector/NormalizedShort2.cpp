@@ -0,0 +1,107 @@
+#include <cmath>
+#include "NormalizedShort2.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector2.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	NormalizedShort2::NormalizedShort2() {}
+
+	NormalizedShort2::NormalizedShort2(float x, float y) :
+		_packedValue(pack(x, y)) {}
+
+	NormalizedShort2::NormalizedShort2(Vector2 const& vector) :
+		_packedValue(pack(vector.X, vector.Y)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(NormalizedShort2 const& a, NormalizedShort2 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(NormalizedShort2 const& a, NormalizedShort2 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void NormalizedShort2::Pack(vector<Vector2> const& sourceArray, size_t sourceIndex,
+		vector<NormalizedShort2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToInt16(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 2, 32767.0F, -32767.0F, 32767.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = NormalizedShort2(sourceArray[sourceIndex + i]);
+	}
+
+	void NormalizedShort2::Pack(vector<Vector2> const& sourceArray, vector<NormalizedShort2>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void NormalizedShort2::Unpack(vector<NormalizedShort2> const& sourceArray, size_t sourceIndex,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromInt16(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 2, 32767.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector2();
+	}
+
+	void NormalizedShort2::Unpack(vector<NormalizedShort2> const& sourceArray, vector<Vector2>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t NormalizedShort2::PackedValue() const {
+		return _packedValue;
+	}
+
+	void NormalizedShort2::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void NormalizedShort2::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y);
+	}
+
+	Vector2 NormalizedShort2::ToVector2() const {
+		constexpr float maxVal = 0x7FFF;
+
+		return Vector2(
+			static_cast<int16_t>(_packedValue & 0xFFFF) / maxVal,
+			static_cast<int16_t>(_packedValue >> 16) / maxVal);
+	}
+
+	Vector4 NormalizedShort2::ToVector4() const {
+		return Vector4(ToVector2(), 0.0F, 1.0F);
+	}
+
+	bool NormalizedShort2::Equals(NormalizedShort2 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t NormalizedShort2::pack(float x, float y) {
+		constexpr float maxPos = 0x7FFF;
+		constexpr float minNeg = -maxPos;
+
+		auto word2 = static_cast<uint32_t>(static_cast<int32_t>(MathHelper::Clamp(std::nearbyint(x * maxPos), minNeg, maxPos)) & 0xFFFF);
+		auto word1 = static_cast<uint32_t>(static_cast<int32_t>(MathHelper::Clamp(std::nearbyint(y * maxPos), minNeg, maxPos)) & 0xFFFF) << 16;
+
+		return word2 | word1;
+	}
+}
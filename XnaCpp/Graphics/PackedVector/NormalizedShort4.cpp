@@ -0,0 +1,106 @@
+#include <cmath>
+#include "NormalizedShort4.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	NormalizedShort4::NormalizedShort4() {}
+
+	NormalizedShort4::NormalizedShort4(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	NormalizedShort4::NormalizedShort4(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(NormalizedShort4 const& a, NormalizedShort4 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(NormalizedShort4 const& a, NormalizedShort4 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void NormalizedShort4::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<NormalizedShort4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToInt16(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 4, 32767.0F, -32767.0F, 32767.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = NormalizedShort4(sourceArray[sourceIndex + i]);
+	}
+
+	void NormalizedShort4::Pack(vector<Vector4> const& sourceArray, vector<NormalizedShort4>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void NormalizedShort4::Unpack(vector<NormalizedShort4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromInt16(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 4, 32767.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void NormalizedShort4::Unpack(vector<NormalizedShort4> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint64_t NormalizedShort4::PackedValue() const {
+		return _packedValue;
+	}
+
+	void NormalizedShort4::PackedValue(uint64_t value) {
+		_packedValue = value;
+	}
+
+	void NormalizedShort4::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 NormalizedShort4::ToVector4() const {
+		constexpr float maxVal = 0x7FFF;
+
+		return Vector4(
+			static_cast<int16_t>(_packedValue & 0xFFFF) / maxVal,
+			static_cast<int16_t>((_packedValue >> 16) & 0xFFFF) / maxVal,
+			static_cast<int16_t>((_packedValue >> 32) & 0xFFFF) / maxVal,
+			static_cast<int16_t>((_packedValue >> 48) & 0xFFFF) / maxVal);
+	}
+
+	bool NormalizedShort4::Equals(NormalizedShort4 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint64_t NormalizedShort4::pack(float x, float y, float z, float w) {
+		constexpr float maxPos = 0x7FFF;
+		constexpr float minNeg = -maxPos;
+
+		auto word4 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x * maxPos, minNeg, maxPos))) & 0xFFFF);
+		auto word3 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y * maxPos, minNeg, maxPos))) & 0xFFFF) << 16;
+		auto word2 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(z * maxPos, minNeg, maxPos))) & 0xFFFF) << 32;
+		auto word1 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(w * maxPos, minNeg, maxPos))) & 0xFFFF) << 48;
+
+		return word4 | word3 | word2 | word1;
+	}
+}
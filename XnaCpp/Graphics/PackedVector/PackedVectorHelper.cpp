@@ -0,0 +1,174 @@
+#include <cstring>
+#include "PackedVectorHelper.hpp"
+#include "../../Simd.hpp"
+#include "../../SimdDispatch.hpp"
+
+//Private
+namespace Xna {
+	namespace {
+#if XNA_SSE2
+		inline __m128i quantize(float const* source, __m128 scale, __m128 minimum, __m128 maximum) {
+			auto value = _mm_mul_ps(_mm_loadu_ps(source), scale);
+			value = _mm_min_ps(_mm_max_ps(value, minimum), maximum);
+			return _mm_cvtps_epi32(value);
+		}
+
+		inline void store32(void* destination, __m128i value) {
+			auto bits = _mm_cvtsi128_si32(value);
+			std::memcpy(destination, &bits, sizeof(bits));
+		}
+
+		inline __m128i load32(void const* source) {
+			int32_t bits;
+			std::memcpy(&bits, source, sizeof(bits));
+			return _mm_cvtsi32_si128(bits);
+		}
+#endif
+	}
+}
+
+//Static
+namespace Xna {
+	size_t PackedVectorHelper::ToHalf(float const* source, void* destination, size_t count) {
+		auto kernel = Simd::Dispatch::Active().ToHalf;
+		return kernel ? kernel(source, destination, count) : 0;
+	}
+
+	size_t PackedVectorHelper::FromHalf(void const* source, float* destination, size_t count) {
+		auto kernel = Simd::Dispatch::Active().FromHalf;
+		return kernel ? kernel(source, destination, count) : 0;
+	}
+
+	size_t PackedVectorHelper::ToInt16(float const* source, void* destination, size_t count, float scale, float minimum, float maximum) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto output = static_cast<uint8_t*>(destination);
+		auto s = _mm_set1_ps(scale);
+		auto min = _mm_set1_ps(minimum);
+		auto max = _mm_set1_ps(maximum);
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = quantize(source + i, s, min, max);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output + i * 2), _mm_packs_epi32(value, value));
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::ToUInt16(float const* source, void* destination, size_t count, float scale, float minimum, float maximum) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto output = static_cast<uint8_t*>(destination);
+		auto s = _mm_set1_ps(scale);
+		auto min = _mm_set1_ps(minimum);
+		auto max = _mm_set1_ps(maximum);
+		auto bias = _mm_set1_epi32(32768);
+		auto flip = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+
+		// SSE2 has no unsigned 32 to 16-bit pack, so values are biased into the signed range and flipped back.
+		for (; i + 4 <= count; i += 4) {
+			auto value = _mm_sub_epi32(quantize(source + i, s, min, max), bias);
+			value = _mm_xor_si128(_mm_packs_epi32(value, value), flip);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output + i * 2), value);
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::ToInt8(float const* source, void* destination, size_t count, float scale, float minimum, float maximum) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto output = static_cast<uint8_t*>(destination);
+		auto s = _mm_set1_ps(scale);
+		auto min = _mm_set1_ps(minimum);
+		auto max = _mm_set1_ps(maximum);
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = quantize(source + i, s, min, max);
+			value = _mm_packs_epi32(value, value);
+			store32(output + i, _mm_packs_epi16(value, value));
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::ToUInt8(float const* source, void* destination, size_t count, float scale, float minimum, float maximum) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto output = static_cast<uint8_t*>(destination);
+		auto s = _mm_set1_ps(scale);
+		auto min = _mm_set1_ps(minimum);
+		auto max = _mm_set1_ps(maximum);
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = quantize(source + i, s, min, max);
+			value = _mm_packs_epi32(value, value);
+			store32(output + i, _mm_packus_epi16(value, value));
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::FromInt16(void const* source, float* destination, size_t count, float divisor) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto input = static_cast<uint8_t const*>(source);
+		auto d = _mm_set1_ps(divisor);
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(input + i * 2));
+			value = _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+			_mm_storeu_ps(destination + i, _mm_div_ps(_mm_cvtepi32_ps(value), d));
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::FromUInt16(void const* source, float* destination, size_t count, float divisor) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto input = static_cast<uint8_t const*>(source);
+		auto d = _mm_set1_ps(divisor);
+		auto zero = _mm_setzero_si128();
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(input + i * 2));
+			value = _mm_unpacklo_epi16(value, zero);
+			_mm_storeu_ps(destination + i, _mm_div_ps(_mm_cvtepi32_ps(value), d));
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::FromInt8(void const* source, float* destination, size_t count, float divisor) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto input = static_cast<uint8_t const*>(source);
+		auto d = _mm_set1_ps(divisor);
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = load32(input + i);
+			value = _mm_unpacklo_epi8(value, value);
+			value = _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 24);
+			_mm_storeu_ps(destination + i, _mm_div_ps(_mm_cvtepi32_ps(value), d));
+		}
+#endif
+		return i;
+	}
+
+	size_t PackedVectorHelper::FromUInt8(void const* source, float* destination, size_t count, float divisor) {
+		size_t i = 0;
+#if XNA_SSE2
+		auto input = static_cast<uint8_t const*>(source);
+		auto d = _mm_set1_ps(divisor);
+		auto zero = _mm_setzero_si128();
+
+		for (; i + 4 <= count; i += 4) {
+			auto value = load32(input + i);
+			value = _mm_unpacklo_epi16(_mm_unpacklo_epi8(value, zero), zero);
+			_mm_storeu_ps(destination + i, _mm_div_ps(_mm_cvtepi32_ps(value), d));
+		}
+#endif
+		return i;
+	}
+}
@@ -0,0 +1,32 @@
+#ifndef _PACKEDVECTORHELPER_HPP_
+#define _PACKEDVECTORHELPER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Xna {
+
+	// Batch kernels shared by the packed vector types.
+	// Each function converts the longest prefix it can vectorize and returns the number of floats it consumed,
+	// leaving the remainder to the caller's scalar path. Without SIMD support they return 0. The half float
+	// conversions use the active Simd::Dispatch table, which has them when the processor has F16C.
+	class PackedVectorHelper {
+	public:
+		static size_t ToHalf(float const* source, void* destination, size_t count);
+		static size_t FromHalf(void const* source, float* destination, size_t count);
+
+		// round(clamp(value * scale, minimum, maximum)) stored as 8 or 16-bit integers.
+		static size_t ToInt16(float const* source, void* destination, size_t count, float scale, float minimum, float maximum);
+		static size_t ToUInt16(float const* source, void* destination, size_t count, float scale, float minimum, float maximum);
+		static size_t ToInt8(float const* source, void* destination, size_t count, float scale, float minimum, float maximum);
+		static size_t ToUInt8(float const* source, void* destination, size_t count, float scale, float minimum, float maximum);
+
+		// value / divisor for 8 or 16-bit integers.
+		static size_t FromInt16(void const* source, float* destination, size_t count, float divisor);
+		static size_t FromUInt16(void const* source, float* destination, size_t count, float divisor);
+		static size_t FromInt8(void const* source, float* destination, size_t count, float divisor);
+		static size_t FromUInt8(void const* source, float* destination, size_t count, float divisor);
+	};
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include <cmath>
+#include "Rg32.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector2.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Rg32::Rg32() {}
+
+	Rg32::Rg32(float x, float y) :
+		_packedValue(pack(x, y)) {}
+
+	Rg32::Rg32(Vector2 const& vector) :
+		_packedValue(pack(vector.X, vector.Y)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Rg32 const& a, Rg32 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Rg32 const& a, Rg32 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Rg32::Pack(vector<Vector2> const& sourceArray, size_t sourceIndex,
+		vector<Rg32>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToUInt16(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 2, 65535.0F, 0.0F, 65535.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = Rg32(sourceArray[sourceIndex + i]);
+	}
+
+	void Rg32::Pack(vector<Vector2> const& sourceArray, vector<Rg32>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Rg32::Unpack(vector<Rg32> const& sourceArray, size_t sourceIndex,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromUInt16(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 2, 65535.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector2();
+	}
+
+	void Rg32::Unpack(vector<Rg32> const& sourceArray, vector<Vector2>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t Rg32::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Rg32::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void Rg32::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y);
+	}
+
+	Vector2 Rg32::ToVector2() const {
+		return Vector2(
+			(_packedValue & 0xFFFF) / 65535.0F,
+			((_packedValue >> 16) & 0xFFFF) / 65535.0F);
+	}
+
+	Vector4 Rg32::ToVector4() const {
+		return Vector4(ToVector2(), 0.0F, 1.0F);
+	}
+
+	bool Rg32::Equals(Rg32 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t Rg32::pack(float x, float y) {
+		return (static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(x, 0.0F, 1.0F) * 65535.0F)) & 0xFFFF)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(y, 0.0F, 1.0F) * 65535.0F)) & 0xFFFF) << 16);
+	}
+}
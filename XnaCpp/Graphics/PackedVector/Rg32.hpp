@@ -0,0 +1,41 @@
+#ifndef _RG32_HPP_
+#define _RG32_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector2;
+	struct Vector4;
+
+	struct Rg32 {
+		Rg32();
+		Rg32(float x, float y);
+		Rg32(Vector2 const& vector);
+
+		friend bool operator ==(Rg32 const& a, Rg32 const& b);
+		friend bool operator !=(Rg32 const& a, Rg32 const& b);
+
+		static void Pack(std::vector<Vector2> const& sourceArray, size_t sourceIndex,
+			std::vector<Rg32>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector2> const& sourceArray, std::vector<Rg32>& destinationArray);
+		static void Unpack(std::vector<Rg32> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Rg32> const& sourceArray, std::vector<Vector2>& destinationArray);
+
+		uint32_t PackedValue() const;
+		void PackedValue(uint32_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector2 ToVector2() const;
+		Vector4 ToVector4() const;
+		bool Equals(Rg32 const& other) const;
+
+	private:
+		uint32_t _packedValue{ 0 };
+
+		static uint32_t pack(float x, float y);
+	};
+}
+
+#endif
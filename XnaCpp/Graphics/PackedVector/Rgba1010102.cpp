@@ -0,0 +1,88 @@
+#include <cmath>
+#include "Rgba1010102.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Rgba1010102::Rgba1010102() {}
+
+	Rgba1010102::Rgba1010102(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	Rgba1010102::Rgba1010102(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Rgba1010102 const& a, Rgba1010102 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Rgba1010102 const& a, Rgba1010102 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Rgba1010102::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Rgba1010102>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = Rgba1010102(sourceArray[sourceIndex + i]);
+	}
+
+	void Rgba1010102::Pack(vector<Vector4> const& sourceArray, vector<Rgba1010102>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Rgba1010102::Unpack(vector<Rgba1010102> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void Rgba1010102::Unpack(vector<Rgba1010102> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t Rgba1010102::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Rgba1010102::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void Rgba1010102::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 Rgba1010102::ToVector4() const {
+		return Vector4(
+			(_packedValue & 0x03FF) / 1023.0F,
+			((_packedValue >> 10) & 0x03FF) / 1023.0F,
+			((_packedValue >> 20) & 0x03FF) / 1023.0F,
+			((_packedValue >> 30) & 0x03) / 3.0F);
+	}
+
+	bool Rgba1010102::Equals(Rgba1010102 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t Rgba1010102::pack(float x, float y, float z, float w) {
+		return (static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(x, 0.0F, 1.0F) * 1023.0F)) & 0x03FF)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(y, 0.0F, 1.0F) * 1023.0F)) & 0x03FF) << 10)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(z, 0.0F, 1.0F) * 1023.0F)) & 0x03FF) << 20)
+			| ((static_cast<uint32_t>(std::nearbyint(MathHelper::Clamp(w, 0.0F, 1.0F) * 3.0F)) & 0x03) << 30);
+	}
+}
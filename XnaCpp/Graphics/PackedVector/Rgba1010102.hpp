@@ -0,0 +1,39 @@
+#ifndef _RGBA1010102_HPP_
+#define _RGBA1010102_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct Rgba1010102 {
+		Rgba1010102();
+		Rgba1010102(float x, float y, float z, float w);
+		Rgba1010102(Vector4 const& vector);
+
+		friend bool operator ==(Rgba1010102 const& a, Rgba1010102 const& b);
+		friend bool operator !=(Rgba1010102 const& a, Rgba1010102 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Rgba1010102>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<Rgba1010102>& destinationArray);
+		static void Unpack(std::vector<Rgba1010102> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Rgba1010102> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint32_t PackedValue() const;
+		void PackedValue(uint32_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(Rgba1010102 const& other) const;
+
+	private:
+		uint32_t _packedValue{ 0 };
+
+		static uint32_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include <cmath>
+#include "Rgba64.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Rgba64::Rgba64() {}
+
+	Rgba64::Rgba64(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	Rgba64::Rgba64(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Rgba64 const& a, Rgba64 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Rgba64 const& a, Rgba64 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Rgba64::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Rgba64>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToUInt16(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 4, 65535.0F, 0.0F, 65535.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = Rgba64(sourceArray[sourceIndex + i]);
+	}
+
+	void Rgba64::Pack(vector<Vector4> const& sourceArray, vector<Rgba64>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Rgba64::Unpack(vector<Rgba64> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromUInt16(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 4, 65535.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void Rgba64::Unpack(vector<Rgba64> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint64_t Rgba64::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Rgba64::PackedValue(uint64_t value) {
+		_packedValue = value;
+	}
+
+	void Rgba64::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 Rgba64::ToVector4() const {
+		return Vector4(
+			(_packedValue & 0xFFFF) / 65535.0F,
+			((_packedValue >> 16) & 0xFFFF) / 65535.0F,
+			((_packedValue >> 32) & 0xFFFF) / 65535.0F,
+			((_packedValue >> 48) & 0xFFFF) / 65535.0F);
+	}
+
+	bool Rgba64::Equals(Rgba64 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint64_t Rgba64::pack(float x, float y, float z, float w) {
+		return static_cast<uint64_t>(std::nearbyint(MathHelper::Clamp(x * 65535.0F, 0.0F, 65535.0F)))
+			| (static_cast<uint64_t>(std::nearbyint(MathHelper::Clamp(y * 65535.0F, 0.0F, 65535.0F))) << 16)
+			| (static_cast<uint64_t>(std::nearbyint(MathHelper::Clamp(z * 65535.0F, 0.0F, 65535.0F))) << 32)
+			| (static_cast<uint64_t>(std::nearbyint(MathHelper::Clamp(w * 65535.0F, 0.0F, 65535.0F))) << 48);
+	}
+}
@@ -0,0 +1,105 @@
+#include <cmath>
+#include "Short2.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector2.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Short2::Short2() {}
+
+	Short2::Short2(float x, float y) :
+		_packedValue(pack(x, y)) {}
+
+	Short2::Short2(Vector2 const& vector) :
+		_packedValue(pack(vector.X, vector.Y)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Short2 const& a, Short2 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Short2 const& a, Short2 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Short2::Pack(vector<Vector2> const& sourceArray, size_t sourceIndex,
+		vector<Short2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToInt16(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 2, 1.0F, -32768.0F, 32767.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = Short2(sourceArray[sourceIndex + i]);
+	}
+
+	void Short2::Pack(vector<Vector2> const& sourceArray, vector<Short2>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Short2::Unpack(vector<Short2> const& sourceArray, size_t sourceIndex,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromInt16(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 2, 1.0F) / 2;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector2();
+	}
+
+	void Short2::Unpack(vector<Short2> const& sourceArray, vector<Vector2>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint32_t Short2::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Short2::PackedValue(uint32_t value) {
+		_packedValue = value;
+	}
+
+	void Short2::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y);
+	}
+
+	Vector2 Short2::ToVector2() const {
+		return Vector2(
+			static_cast<int16_t>(_packedValue & 0xFFFF),
+			static_cast<int16_t>(_packedValue >> 16));
+	}
+
+	Vector4 Short2::ToVector4() const {
+		return Vector4(ToVector2(), 0.0F, 1.0F);
+	}
+
+	bool Short2::Equals(Short2 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint32_t Short2::pack(float x, float y) {
+		constexpr float maxPos = 0x7FFF;
+		constexpr float minNeg = -0x8000;
+
+		auto word2 = static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, minNeg, maxPos)))) & 0xFFFF;
+		auto word1 = (static_cast<uint32_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, minNeg, maxPos)))) & 0xFFFF) << 16;
+
+		return word2 | word1;
+	}
+}
@@ -0,0 +1,104 @@
+#include <cmath>
+#include "Short4.hpp"
+#include "PackedVectorHelper.hpp"
+#include "../../MathHelper.hpp"
+#include "../../Vector4.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Short4::Short4() {}
+
+	Short4::Short4(float x, float y, float z, float w) :
+		_packedValue(pack(x, y, z, w)) {}
+
+	Short4::Short4(Vector4 const& vector) :
+		_packedValue(pack(vector.X, vector.Y, vector.Z, vector.W)) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Short4 const& a, Short4 const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(Short4 const& a, Short4 const& b) {
+		return !a.Equals(b);
+	}
+}
+
+//Static
+namespace Xna {
+	void Short4::Pack(vector<Vector4> const& sourceArray, size_t sourceIndex,
+		vector<Short4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::ToInt16(&sourceArray[sourceIndex].X, &destinationArray[destinationIndex], length * 4, 1.0F, -32768.0F, 32767.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = Short4(sourceArray[sourceIndex + i]);
+	}
+
+	void Short4::Pack(vector<Vector4> const& sourceArray, vector<Short4>& destinationArray) {
+		Pack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+
+	void Short4::Unpack(vector<Short4> const& sourceArray, size_t sourceIndex,
+		vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		size_t i = 0;
+
+		if (length > 0)
+			i = PackedVectorHelper::FromInt16(&sourceArray[sourceIndex], &destinationArray[destinationIndex].X, length * 4, 1.0F) / 4;
+
+		for (; i < length; ++i)
+			destinationArray[destinationIndex + i] = sourceArray[sourceIndex + i].ToVector4();
+	}
+
+	void Short4::Unpack(vector<Short4> const& sourceArray, vector<Vector4>& destinationArray) {
+		Unpack(sourceArray, 0, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Functions
+namespace Xna {
+	uint64_t Short4::PackedValue() const {
+		return _packedValue;
+	}
+
+	void Short4::PackedValue(uint64_t value) {
+		_packedValue = value;
+	}
+
+	void Short4::PackFromVector4(Vector4 const& vector) {
+		_packedValue = pack(vector.X, vector.Y, vector.Z, vector.W);
+	}
+
+	Vector4 Short4::ToVector4() const {
+		return Vector4(
+			static_cast<int16_t>(_packedValue & 0xFFFF),
+			static_cast<int16_t>((_packedValue >> 16) & 0xFFFF),
+			static_cast<int16_t>((_packedValue >> 32) & 0xFFFF),
+			static_cast<int16_t>((_packedValue >> 48) & 0xFFFF));
+	}
+
+	bool Short4::Equals(Short4 const& other) const {
+		return _packedValue == other._packedValue;
+	}
+}
+
+//Private
+namespace Xna {
+	uint64_t Short4::pack(float x, float y, float z, float w) {
+		constexpr float maxPos = 0x7FFF;
+		constexpr float minNeg = -0x8000;
+
+		auto word4 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(x, minNeg, maxPos))) & 0xFFFF);
+		auto word3 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(y, minNeg, maxPos))) & 0xFFFF) << 16;
+		auto word2 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(z, minNeg, maxPos))) & 0xFFFF) << 32;
+		auto word1 = static_cast<uint64_t>(static_cast<int32_t>(std::nearbyint(MathHelper::Clamp(w, minNeg, maxPos))) & 0xFFFF) << 48;
+
+		return word4 | word3 | word2 | word1;
+	}
+}
@@ -0,0 +1,39 @@
+#ifndef _SHORT4_HPP_
+#define _SHORT4_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+	struct Vector4;
+
+	struct Short4 {
+		Short4();
+		Short4(float x, float y, float z, float w);
+		Short4(Vector4 const& vector);
+
+		friend bool operator ==(Short4 const& a, Short4 const& b);
+		friend bool operator !=(Short4 const& a, Short4 const& b);
+
+		static void Pack(std::vector<Vector4> const& sourceArray, size_t sourceIndex,
+			std::vector<Short4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Pack(std::vector<Vector4> const& sourceArray, std::vector<Short4>& destinationArray);
+		static void Unpack(std::vector<Short4> const& sourceArray, size_t sourceIndex,
+			std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length);
+		static void Unpack(std::vector<Short4> const& sourceArray, std::vector<Vector4>& destinationArray);
+
+		uint64_t PackedValue() const;
+		void PackedValue(uint64_t value);
+		void PackFromVector4(Vector4 const& vector);
+		Vector4 ToVector4() const;
+		bool Equals(Short4 const& other) const;
+
+	private:
+		uint64_t _packedValue{ 0 };
+
+		static uint64_t pack(float x, float y, float z, float w);
+	};
+}
+
+#endif
@@ -0,0 +1,31 @@
+#include "RenderTarget2D.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	RenderTarget2D::RenderTarget2D(int32_t width, int32_t height, bool depthBuffer) :
+		Texture2D(width, height) {
+		if (depthBuffer)
+			_depth.resize(data().size(), 1.0f);
+	}
+}
+
+//Functions
+namespace Xna {
+	bool RenderTarget2D::HasDepthBuffer() const {
+		return !_depth.empty();
+	}
+
+	vector<Color>& RenderTarget2D::ColorData() {
+		return data();
+	}
+
+	vector<float>& RenderTarget2D::DepthData() {
+		return _depth;
+	}
+
+	vector<float> const& RenderTarget2D::DepthData() const {
+		return _depth;
+	}
+}
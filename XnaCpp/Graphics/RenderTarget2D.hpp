@@ -0,0 +1,25 @@
+#ifndef _RENDERTARGET2D_HPP_
+#define _RENDERTARGET2D_HPP_
+
+#include <vector>
+#include "Texture2D.hpp"
+
+namespace Xna {
+
+	// A Texture2D that SoftwareRasterizer can draw into, with an optional float depth buffer.
+	class RenderTarget2D : public Texture2D {
+	public:
+		RenderTarget2D(int32_t width, int32_t height, bool depthBuffer = true);
+
+		bool HasDepthBuffer() const;
+
+		std::vector<Color>& ColorData();
+		std::vector<float>& DepthData();
+		std::vector<float> const& DepthData() const;
+
+	private:
+		std::vector<float> _depth;
+	};
+}
+
+#endif
@@ -0,0 +1,654 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include "SoftwareRasterizer.hpp"
+#include "SpriteBatch.hpp"
+#include "../Compositor.hpp"
+#include "../MathHelper.hpp"
+#include "../Parallel.hpp"
+#include "../PixelMath.hpp"
+#include "../Simd.hpp"
+#include "../Vector4.hpp"
+#include "../Profiler.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		constexpr int32_t attributeCount = 6;
+		constexpr size_t clipPlaneCount = 7;
+		constexpr size_t maxClipVertices = 3 + clipPlaneCount;
+
+		// Homogeneous clip planes as (x, y, z, w) weights: near (z >= 0), far (z <= w) and w above a small epsilon.
+		// The guard band planes follow, set per target by addTriangle.
+		constexpr float clipPlanes[3][5] = {
+			{ 0, 0, 1, 0, 0 },
+			{ 0, 0, -1, 1, 0 },
+			{ 0, 0, 0, 1, -1e-5f }
+		};
+
+		using Detail::packed;
+		using Detail::mul255;
+
+		inline uint32_t toByte(float value) {
+			return value <= 0 ? 0 : value >= 255 ? 255 : static_cast<uint32_t>(value + 0.5f);
+		}
+
+		inline bool depthTest(CompareFunction function, float value, float stored) {
+			switch (function) {
+			case CompareFunction::Always:
+				return true;
+			case CompareFunction::Never:
+				return false;
+			case CompareFunction::Less:
+				return value < stored;
+			case CompareFunction::LessEqual:
+				return value <= stored;
+			case CompareFunction::Equal:
+				return value == stored;
+			case CompareFunction::GreaterEqual:
+				return value >= stored;
+			case CompareFunction::Greater:
+				return value > stored;
+			case CompareFunction::NotEqual:
+				return value != stored;
+			}
+
+			return true;
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	SoftwareRasterizer::SoftwareRasterizer(size_t threadCount) :
+		_transform(Matrix::Identity), _threadCount(threadCount) {}
+}
+
+//Functions
+namespace Xna {
+	RenderTarget2D* SoftwareRasterizer::RenderTarget() const {
+		return _renderTarget;
+	}
+
+	void SoftwareRasterizer::RenderTarget(RenderTarget2D* value) {
+		_renderTarget = value;
+	}
+
+	Matrix SoftwareRasterizer::Transform() const {
+		return _transform;
+	}
+
+	void SoftwareRasterizer::Transform(Matrix const& value) {
+		_transform = value;
+	}
+
+	Texture2D const* SoftwareRasterizer::Texture() const {
+		return _texture;
+	}
+
+	void SoftwareRasterizer::Texture(Texture2D const* value) {
+		_texture = value;
+	}
+
+	BlendMode SoftwareRasterizer::Blend() const {
+		return _blend;
+	}
+
+	void SoftwareRasterizer::Blend(BlendMode value) {
+		_blend = value;
+	}
+
+	CompareFunction SoftwareRasterizer::DepthFunction() const {
+		return _depthFunction;
+	}
+
+	void SoftwareRasterizer::DepthFunction(CompareFunction value) {
+		_depthFunction = value;
+	}
+
+	bool SoftwareRasterizer::DepthWrite() const {
+		return _depthWrite;
+	}
+
+	void SoftwareRasterizer::DepthWrite(bool value) {
+		_depthWrite = value;
+	}
+
+	CullMode SoftwareRasterizer::Cull() const {
+		return _cull;
+	}
+
+	void SoftwareRasterizer::Cull(CullMode value) {
+		_cull = value;
+	}
+
+	size_t SoftwareRasterizer::ThreadCount() const {
+		return _threadCount;
+	}
+
+	void SoftwareRasterizer::ThreadCount(size_t value) {
+		_threadCount = value;
+	}
+
+	void SoftwareRasterizer::Clear(Color const& color) {
+		Clear(color, 1.0f);
+	}
+
+	void SoftwareRasterizer::Clear(Color const& color, float depth) {
+		_trianglesDrawn = 0;
+		_pixelsDrawn = 0;
+
+		if (!_renderTarget)
+			return;
+
+		auto& colorData = _renderTarget->ColorData();
+		std::fill(colorData.begin(), colorData.end(), color);
+
+		auto& depthData = _renderTarget->DepthData();
+		std::fill(depthData.begin(), depthData.end(), depth);
+	}
+
+	void SoftwareRasterizer::DrawUserPrimitives(vector<VertexPositionColorTexture> const& vertexData, size_t vertexOffset, size_t primitiveCount) {
+		if (!_renderTarget || vertexOffset + primitiveCount * 3 > vertexData.size())
+			return;
+
+		XNA_PROFILE_ZONE("SoftwareRasterizer::DrawUserPrimitives");
+
+		beginDraw();
+
+		auto vertices = vertexData.data() + vertexOffset;
+
+		for (size_t i = 0; i < primitiveCount; ++i)
+			addTriangle(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], _transform, _texture, _cull);
+
+		endDraw();
+	}
+
+	void SoftwareRasterizer::DrawUserIndexedPrimitives(vector<VertexPositionColorTexture> const& vertexData, size_t vertexOffset,
+		vector<uint16_t> const& indexData, size_t indexOffset, size_t primitiveCount) {
+		if (!_renderTarget || indexOffset + primitiveCount * 3 > indexData.size())
+			return;
+
+		XNA_PROFILE_ZONE("SoftwareRasterizer::DrawUserIndexedPrimitives");
+
+		beginDraw();
+
+		auto indices = indexData.data() + indexOffset;
+		auto count = vertexData.size();
+
+		for (size_t i = 0; i < primitiveCount; ++i) {
+			auto i0 = vertexOffset + indices[i * 3];
+			auto i1 = vertexOffset + indices[i * 3 + 1];
+			auto i2 = vertexOffset + indices[i * 3 + 2];
+
+			if (i0 < count && i1 < count && i2 < count)
+				addTriangle(vertexData[i0], vertexData[i1], vertexData[i2], _transform, _texture, _cull);
+		}
+
+		endDraw();
+	}
+
+	void SoftwareRasterizer::DrawSpriteBatch(SpriteBatch const& spriteBatch) {
+		if (!_renderTarget)
+			return;
+
+		XNA_PROFILE_ZONE("SoftwareRasterizer::DrawSpriteBatch");
+
+		auto projection = Matrix::CreateOrthographicOffCenter(0, static_cast<float>(_renderTarget->Width()),
+			static_cast<float>(_renderTarget->Height()), 0, 0, -1);
+		auto const& vertices = spriteBatch.Vertices();
+		auto const& indices = SpriteBatch::Indices();
+
+		// Every batch goes into one binning pass; triangles carry their own texture.
+		beginDraw();
+
+		for (auto const& batch : spriteBatch.Batches()) {
+			auto base = vertices.data() + batch.VertexStart;
+
+			for (size_t i = 0; i < batch.SpriteCount * 6; i += 3)
+				addTriangle(base[indices[i]], base[indices[i + 1]], base[indices[i + 2]], projection, batch.Texture, CullMode::None);
+		}
+
+		endDraw();
+	}
+
+	size_t SoftwareRasterizer::TrianglesDrawn() const {
+		return _trianglesDrawn;
+	}
+
+	size_t SoftwareRasterizer::PixelsDrawn() const {
+		return _pixelsDrawn;
+	}
+}
+
+//Private
+namespace Xna {
+	void SoftwareRasterizer::beginDraw() {
+		_binColumns = (_renderTarget->Width() + BinSize - 1) / BinSize;
+		_binRows = (_renderTarget->Height() + BinSize - 1) / BinSize;
+		_bins.resize(static_cast<size_t>(_binColumns) * static_cast<size_t>(_binRows));
+
+		for (auto& bin : _bins)
+			bin.clear();
+
+		_triangles.clear();
+	}
+
+	void SoftwareRasterizer::addTriangle(VertexPositionColorTexture const& v0, VertexPositionColorTexture const& v1, VertexPositionColorTexture const& v2,
+		Matrix const& transform, Texture2D const* texture, CullMode cull) {
+		ClipVertex buffers[2][maxClipVertices];
+		VertexPositionColorTexture const* source[3] = { &v0, &v1, &v2 };
+		float planes[clipPlaneCount][5] = {};
+		std::copy(&clipPlanes[0][0], &clipPlanes[0][0] + sizeof(clipPlanes) / sizeof(float), &planes[0][0]);
+
+		// |x| <= guardX * w keeps x within GuardBand pixels of the target once projected, and likewise for y.
+		auto guardX = 1.0f + 2.0f * GuardBand / _renderTarget->Width();
+		auto guardY = 1.0f + 2.0f * GuardBand / _renderTarget->Height();
+		planes[3][0] = 1;
+		planes[3][3] = guardX;
+		planes[4][0] = -1;
+		planes[4][3] = guardX;
+		planes[5][1] = 1;
+		planes[5][3] = guardY;
+		planes[6][1] = -1;
+		planes[6][3] = guardY;
+
+		for (size_t i = 0; i < 3; ++i) {
+			auto const& vertex = *source[i];
+			auto position = Vector4::Transform(vertex.Position, transform);
+			auto& clip = buffers[0][i];
+
+			clip.Position[0] = position.X;
+			clip.Position[1] = position.Y;
+			clip.Position[2] = position.Z;
+			clip.Position[3] = position.W;
+			clip.Attributes[0] = vertex.Color.R();
+			clip.Attributes[1] = vertex.Color.G();
+			clip.Attributes[2] = vertex.Color.B();
+			clip.Attributes[3] = vertex.Color.A();
+			clip.Attributes[4] = vertex.TextureCoordinate.X;
+			clip.Attributes[5] = vertex.TextureCoordinate.Y;
+		}
+
+		// Sutherland-Hodgman against each plane; every plane adds at most one vertex.
+		size_t count = 3;
+		auto input = buffers[0];
+		auto output = buffers[1];
+
+		for (auto const& plane : planes) {
+			float distances[maxClipVertices];
+			bool inside = true;
+			bool outside = true;
+
+			for (size_t i = 0; i < count; ++i) {
+				auto const& p = input[i].Position;
+				distances[i] = plane[0] * p[0] + plane[1] * p[1] + plane[2] * p[2] + plane[3] * p[3] + plane[4];
+				inside &= distances[i] >= 0;
+				outside &= distances[i] < 0;
+			}
+
+			if (outside)
+				return;
+
+			if (inside)
+				continue;
+
+			size_t outputCount = 0;
+
+			for (size_t i = 0; i < count; ++i) {
+				auto j = (i + 1) % count;
+
+				if (distances[i] >= 0)
+					output[outputCount++] = input[i];
+
+				if ((distances[i] >= 0) != (distances[j] >= 0)) {
+					// Always measured from the inside end, so triangles sharing the edge get the same vertex.
+					auto a = distances[i] >= 0 ? i : j;
+					auto b = a == i ? j : i;
+					auto t = distances[a] / (distances[a] - distances[b]);
+					auto& vertex = output[outputCount++];
+
+					for (size_t k = 0; k < 4; ++k)
+						vertex.Position[k] = input[a].Position[k] + (input[b].Position[k] - input[a].Position[k]) * t;
+
+					for (size_t k = 0; k < attributeCount; ++k)
+						vertex.Attributes[k] = input[a].Attributes[k] + (input[b].Attributes[k] - input[a].Attributes[k]) * t;
+				}
+			}
+
+			count = outputCount;
+			std::swap(input, output);
+		}
+
+		for (size_t i = 1; i + 1 < count; ++i)
+			setupTriangle(input[0], input[i], input[i + 1], texture, cull);
+	}
+
+	void SoftwareRasterizer::setupTriangle(ClipVertex const& v0, ClipVertex const& v1, ClipVertex const& v2, Texture2D const* texture, CullMode cull) {
+		auto width = static_cast<float>(_renderTarget->Width());
+		auto height = static_cast<float>(_renderTarget->Height());
+		ClipVertex const* vertices[3] = { &v0, &v1, &v2 };
+		double x[3];
+		double y[3];
+		float z[3];
+		float inverseW[3];
+
+		for (size_t i = 0; i < 3; ++i) {
+			auto const& p = vertices[i]->Position;
+			inverseW[i] = 1.0f / p[3];
+			x[i] = std::nearbyint((p[0] * inverseW[i] * 0.5f + 0.5f) * width * SubpixelSteps) / SubpixelSteps;
+			y[i] = std::nearbyint((0.5f - p[1] * inverseW[i] * 0.5f) * height * SubpixelSteps) / SubpixelSteps;
+			z[i] = p[2] * inverseW[i];
+		}
+
+		// Exact on the snapped grid. Positive area winds clockwise on screen, since y points down.
+		auto area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+
+		if (!(std::abs(area) > 0))
+			return;
+
+		if ((cull == CullMode::CullClockwiseFace && area > 0) || (cull == CullMode::CullCounterClockwiseFace && area < 0))
+			return;
+
+		int32_t order[3] = { 0, 1, 2 };
+
+		if (area < 0)
+			std::swap(order[1], order[2]);
+
+		auto minX = std::clamp(std::floor(std::min({ x[0], x[1], x[2] })), 0.0, width - 1.0);
+		auto maxX = std::clamp(std::ceil(std::max({ x[0], x[1], x[2] })), 0.0, width - 1.0);
+		auto minY = std::clamp(std::floor(std::min({ y[0], y[1], y[2] })), 0.0, height - 1.0);
+		auto maxY = std::clamp(std::ceil(std::max({ y[0], y[1], y[2] })), 0.0, height - 1.0);
+
+		Triangle triangle;
+		triangle.MinX = static_cast<int32_t>(minX);
+		triangle.MaxX = static_cast<int32_t>(maxX);
+		triangle.MinY = static_cast<int32_t>(minY);
+		triangle.MaxY = static_cast<int32_t>(maxY);
+		triangle.Texture = texture;
+		triangle.TopLeft = 0;
+
+		// Edge i runs from vertex i to vertex i + 1 and is positive inside the triangle. Both directions of an edge
+		// give exactly opposite values, and the top-left rule hands pixels on it to exactly one side.
+		for (int32_t i = 0; i < 3; ++i) {
+			auto a = order[i];
+			auto b = order[(i + 1) % 3];
+			auto dx = x[b] - x[a];
+			auto dy = y[b] - y[a];
+			auto& edge = triangle.Edges[i];
+
+			edge.A = -dy;
+			edge.B = dx;
+			edge.C = dy * x[a] - dx * y[a];
+
+			if (dy < 0 || (dy == 0 && dx > 0))
+				triangle.TopLeft |= 1u << i;
+		}
+
+		auto dx1 = x[1] - x[0];
+		auto dy1 = y[1] - y[0];
+		auto dx2 = x[2] - x[0];
+		auto dy2 = y[2] - y[0];
+		auto signedArea = dx1 * dy2 - dx2 * dy1;
+
+		auto plane = [&](float a0, float a1, float a2) {
+			PlaneEquation result;
+			result.A = ((a1 - a0) * dy2 - (a2 - a0) * dy1) / signedArea;
+			result.B = ((a2 - a0) * dx1 - (a1 - a0) * dx2) / signedArea;
+			result.C = a0 - result.A * x[0] - result.B * y[0];
+			return result;
+		};
+
+		triangle.Depth = plane(z[0], z[1], z[2]);
+		triangle.InverseW = plane(inverseW[0], inverseW[1], inverseW[2]);
+
+		for (size_t k = 0; k < attributeCount; ++k) {
+			triangle.Attributes[k] = plane(
+				v0.Attributes[k] * inverseW[0],
+				v1.Attributes[k] * inverseW[1],
+				v2.Attributes[k] * inverseW[2]);
+		}
+
+		auto index = static_cast<uint32_t>(_triangles.size());
+		_triangles.push_back(triangle);
+
+		for (auto row = triangle.MinY / BinSize; row <= triangle.MaxY / BinSize; ++row) {
+			for (auto column = triangle.MinX / BinSize; column <= triangle.MaxX / BinSize; ++column)
+				_bins[static_cast<size_t>(row) * _binColumns + column].push_back(index);
+		}
+	}
+
+	void SoftwareRasterizer::endDraw() {
+		if (_triangles.empty())
+			return;
+
+		vector<size_t> pixels(_bins.size(), 0);
+
+		Parallel::For(0, _bins.size(), _threadCount, [&](size_t bin) {
+			pixels[bin] = drawBin(bin);
+			});
+
+		_trianglesDrawn += _triangles.size();
+
+		for (auto count : pixels)
+			_pixelsDrawn += count;
+	}
+
+	size_t SoftwareRasterizer::drawBin(size_t bin) {
+		auto const& indices = _bins[bin];
+
+		if (indices.empty())
+			return 0;
+
+		auto binX = static_cast<int32_t>(bin % _binColumns) * BinSize;
+		auto binY = static_cast<int32_t>(bin / _binColumns) * BinSize;
+		size_t pixels = 0;
+
+		for (auto index : indices) {
+			auto const& triangle = _triangles[index];
+			auto left = MathHelper::Max(triangle.MinX, binX) & ~(TileSize - 1);
+			auto top = MathHelper::Max(triangle.MinY, binY) & ~(TileSize - 1);
+			auto right = MathHelper::Min(triangle.MaxX, binX + BinSize - 1);
+			auto bottom = MathHelper::Min(triangle.MaxY, binY + BinSize - 1);
+
+			for (auto tileY = top; tileY <= bottom; tileY += TileSize) {
+				for (auto tileX = left; tileX <= right; tileX += TileSize) {
+					// Extremes of each edge function over the pixel centers of the tile.
+					auto centerX = tileX + 0.5;
+					auto centerY = tileY + 0.5;
+					auto rejected = false;
+					auto covered = true;
+
+					for (auto const& edge : triangle.Edges) {
+						auto value = edge.A * centerX + edge.B * centerY + edge.C;
+						auto stepX = edge.A * (TileSize - 1);
+						auto stepY = edge.B * (TileSize - 1);
+						auto maximum = value + std::max(stepX, 0.0) + std::max(stepY, 0.0);
+						auto minimum = value + std::min(stepX, 0.0) + std::min(stepY, 0.0);
+
+						rejected |= maximum < 0;
+						covered &= minimum > 0;
+					}
+
+					if (!rejected)
+						pixels += drawTile(triangle, tileX, tileY, covered);
+				}
+			}
+		}
+
+		return pixels;
+	}
+
+	size_t SoftwareRasterizer::drawTile(Triangle const& triangle, int32_t tileX, int32_t tileY, bool covered) {
+		auto width = _renderTarget->Width();
+		auto colorData = _renderTarget->ColorData().data();
+		auto depthData = _renderTarget->HasDepthBuffer() ? _renderTarget->DepthData().data() : nullptr;
+		auto texture = triangle.Texture;
+		auto testDepth = depthData && _depthFunction != CompareFunction::Always;
+		auto writeDepth = depthData && _depthWrite;
+
+		// Columns of the tile inside both the triangle bounds and the target.
+		auto first = MathHelper::Max(triangle.MinX - tileX, 0);
+		auto last = MathHelper::Min(triangle.MaxX - tileX, TileSize - 1);
+		uint32_t columns = ((2u << last) - 1) & ~((1u << first) - 1);
+		auto span = static_cast<size_t>(MathHelper::Min(TileSize, width - tileX));
+		size_t pixels = 0;
+
+#if XNA_AVX2
+		auto lanesLow = _mm256_setr_pd(0, 1, 2, 3);
+		auto lanesHigh = _mm256_setr_pd(4, 5, 6, 7);
+#elif XNA_SSE2
+		__m128d lanes[TileSize / 2];
+
+		for (int32_t i = 0; i < TileSize / 2; ++i)
+			lanes[i] = _mm_setr_pd(i * 2, i * 2 + 1);
+#endif
+
+		for (auto y = MathHelper::Max(tileY, triangle.MinY); y <= MathHelper::Min(tileY + TileSize - 1, triangle.MaxY); ++y) {
+			auto centerY = y + 0.5f;
+			auto centerX = tileX + 0.5f;
+			uint32_t mask = columns;
+
+			if (!covered) {
+				// Edge values are exact, so the comparisons alone apply the fill rule.
+#if XNA_AVX2
+				auto insideLow = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
+				auto insideHigh = insideLow;
+
+				for (uint32_t i = 0; i < 3; ++i) {
+					auto const& edge = triangle.Edges[i];
+					auto start = _mm256_set1_pd(edge.A * centerX + edge.B * centerY + edge.C);
+					auto stepX = _mm256_set1_pd(edge.A);
+					auto low = _mm256_add_pd(start, _mm256_mul_pd(stepX, lanesLow));
+					auto high = _mm256_add_pd(start, _mm256_mul_pd(stepX, lanesHigh));
+
+					if ((triangle.TopLeft >> i) & 1) {
+						insideLow = _mm256_and_pd(insideLow, _mm256_cmp_pd(low, _mm256_setzero_pd(), _CMP_GE_OQ));
+						insideHigh = _mm256_and_pd(insideHigh, _mm256_cmp_pd(high, _mm256_setzero_pd(), _CMP_GE_OQ));
+					}
+					else {
+						insideLow = _mm256_and_pd(insideLow, _mm256_cmp_pd(low, _mm256_setzero_pd(), _CMP_GT_OQ));
+						insideHigh = _mm256_and_pd(insideHigh, _mm256_cmp_pd(high, _mm256_setzero_pd(), _CMP_GT_OQ));
+					}
+				}
+
+				mask &= static_cast<uint32_t>(_mm256_movemask_pd(insideLow) | (_mm256_movemask_pd(insideHigh) << 4));
+#elif XNA_SSE2
+				__m128d inside[TileSize / 2];
+
+				for (auto& value : inside)
+					value = _mm_castsi128_pd(_mm_set1_epi32(-1));
+
+				for (uint32_t i = 0; i < 3; ++i) {
+					auto const& edge = triangle.Edges[i];
+					auto start = _mm_set1_pd(edge.A * centerX + edge.B * centerY + edge.C);
+					auto stepX = _mm_set1_pd(edge.A);
+					auto topLeft = (triangle.TopLeft >> i) & 1;
+
+					for (int32_t j = 0; j < TileSize / 2; ++j) {
+						auto value = _mm_add_pd(start, _mm_mul_pd(stepX, lanes[j]));
+						inside[j] = _mm_and_pd(inside[j], topLeft
+							? _mm_cmpge_pd(value, _mm_setzero_pd())
+							: _mm_cmpgt_pd(value, _mm_setzero_pd()));
+					}
+				}
+
+				uint32_t bits = 0;
+
+				for (int32_t j = 0; j < TileSize / 2; ++j)
+					bits |= static_cast<uint32_t>(_mm_movemask_pd(inside[j])) << (j * 2);
+
+				mask &= bits;
+#else
+				for (int32_t lane = 0; lane < TileSize; ++lane) {
+					for (uint32_t i = 0; i < 3; ++i) {
+						auto const& edge = triangle.Edges[i];
+						auto value = edge.A * (centerX + lane) + edge.B * centerY + edge.C;
+
+						if (value < 0 || (value == 0 && !((triangle.TopLeft >> i) & 1)))
+							mask &= ~(1u << lane);
+					}
+				}
+#endif
+			}
+
+			if (!mask)
+				continue;
+
+			auto row = static_cast<size_t>(y) * width + tileX;
+			Color source[TileSize];
+			uint32_t written = 0;
+
+			for (int32_t lane = 0; lane < TileSize; ++lane) {
+				if (!((mask >> lane) & 1))
+					continue;
+
+				auto x = centerX + lane;
+				auto depth = triangle.Depth.A * x + triangle.Depth.B * centerY + triangle.Depth.C;
+
+				if (testDepth && !depthTest(_depthFunction, depth, depthData[row + lane]))
+					continue;
+
+				auto w = 1.0f / (triangle.InverseW.A * x + triangle.InverseW.B * centerY + triangle.InverseW.C);
+				float values[attributeCount];
+
+				for (size_t k = 0; k < attributeCount; ++k) {
+					auto const& attribute = triangle.Attributes[k];
+					values[k] = (attribute.A * x + attribute.B * centerY + attribute.C) * w;
+				}
+
+				auto r = toByte(values[0]);
+				auto g = toByte(values[1]);
+				auto b = toByte(values[2]);
+				auto a = toByte(values[3]);
+
+				if (texture) {
+					auto textureWidth = texture->Width();
+					auto textureHeight = texture->Height();
+					auto u = static_cast<size_t>(MathHelper::Clamp(std::floor(values[4] * textureWidth), 0.0f, textureWidth - 1.0f));
+					auto v = static_cast<size_t>(MathHelper::Clamp(std::floor(values[5] * textureHeight), 0.0f, textureHeight - 1.0f));
+					auto texel = packed(texture->Data()[v * textureWidth + u]);
+
+					r = mul255(texel & 0xFF, r);
+					g = mul255((texel >> 8) & 0xFF, g);
+					b = mul255((texel >> 16) & 0xFF, b);
+					a = mul255(texel >> 24, a);
+				}
+
+				source[lane] = Color(r | (g << 8) | (b << 16) | (a << 24));
+				written |= 1u << lane;
+
+				if (writeDepth)
+					depthData[row + lane] = depth;
+			}
+
+			if (!written)
+				continue;
+
+			auto destination = colorData + row;
+
+			if (_blend == BlendMode::Opaque) {
+				for (int32_t lane = 0; lane < TileSize; ++lane) {
+					if ((written >> lane) & 1)
+						destination[lane] = source[lane];
+				}
+			}
+			else {
+				Color blended[TileSize];
+				std::copy_n(destination, span, blended);
+				Compositor::Blend(source, blended, span, _blend);
+
+				for (int32_t lane = 0; lane < TileSize; ++lane) {
+					if ((written >> lane) & 1)
+						destination[lane] = blended[lane];
+				}
+			}
+
+			pixels += static_cast<size_t>(std::popcount(written));
+		}
+
+		return pixels;
+	}
+}
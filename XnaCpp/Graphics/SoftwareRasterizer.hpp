@@ -0,0 +1,128 @@
+#ifndef _SOFTWARERASTERIZER_HPP_
+#define _SOFTWARERASTERIZER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../BlendMode.hpp"
+#include "../Color.hpp"
+#include "../Matrix.hpp"
+#include "CompareFunction.hpp"
+#include "CullMode.hpp"
+#include "RenderTarget2D.hpp"
+#include "VertexPositionColorTexture.hpp"
+
+namespace Xna {
+
+	class SpriteBatch;
+
+	// Draws triangle lists into a RenderTarget2D on the CPU. Vertex positions are transformed to clip space by Transform,
+	// clipped against the near and far planes and a guard band around the target, snapped to 1/SubpixelSteps of a
+	// pixel and rasterized with the top-left fill rule at pixel centers. Edge functions are exact at that precision, so
+	// triangles that share an edge never both draw, or both miss, a pixel along it.
+	// The target is split into bins of BinSize pixels that are drawn on up to ThreadCount threads; inside a bin each
+	// 8x8 tile is rejected, accepted or scanned with SIMD edge functions one 8-pixel row at a time.
+	// Pixels take the vertex color, modulated by a point-sampled, clamped Texture when one is set.
+	class SoftwareRasterizer {
+	public:
+		static constexpr int32_t TileSize = 8;
+		static constexpr int32_t BinSize = 64;
+		static constexpr int32_t SubpixelSteps = 256;
+		// Furthest, in pixels, that vertices may lie outside the target before triangles are clipped to it.
+		static constexpr int32_t GuardBand = 8192;
+
+		SoftwareRasterizer(size_t threadCount = 0);
+
+		RenderTarget2D* RenderTarget() const;
+		void RenderTarget(RenderTarget2D* value);
+
+		Matrix Transform() const;
+		void Transform(Matrix const& value);
+		Texture2D const* Texture() const;
+		void Texture(Texture2D const* value);
+
+		BlendMode Blend() const;
+		void Blend(BlendMode value);
+		CompareFunction DepthFunction() const;
+		void DepthFunction(CompareFunction value);
+		bool DepthWrite() const;
+		void DepthWrite(bool value);
+		CullMode Cull() const;
+		void Cull(CullMode value);
+
+		size_t ThreadCount() const;
+		void ThreadCount(size_t value);
+
+		void Clear(Color const& color);
+		void Clear(Color const& color, float depth);
+
+		void DrawUserPrimitives(std::vector<VertexPositionColorTexture> const& vertexData, size_t vertexOffset, size_t primitiveCount);
+		void DrawUserIndexedPrimitives(std::vector<VertexPositionColorTexture> const& vertexData, size_t vertexOffset,
+			std::vector<uint16_t> const& indexData, size_t indexOffset, size_t primitiveCount);
+
+		// Draws the output of the last SpriteBatch::End() with the orthographic projection SpriteBatch uses in XNA.
+		// Culling is skipped, since flipped sprites reverse their winding. Transform and Texture are left unchanged.
+		void DrawSpriteBatch(SpriteBatch const& spriteBatch);
+
+		// Triangles and pixels written since the last Clear().
+		size_t TrianglesDrawn() const;
+		size_t PixelsDrawn() const;
+
+	private:
+		struct PlaneEquation {
+			float A;
+			float B;
+			float C;
+		};
+
+		// Exact for snapped vertices inside the guard band, in which coordinates need fewer than 53 bits.
+		struct EdgeEquation {
+			double A;
+			double B;
+			double C;
+		};
+
+		struct Triangle {
+			EdgeEquation Edges[3];
+			uint32_t TopLeft;
+			PlaneEquation Depth;
+			PlaneEquation InverseW;
+			PlaneEquation Attributes[6];
+			Texture2D const* Texture;
+			int32_t MinX;
+			int32_t MinY;
+			int32_t MaxX;
+			int32_t MaxY;
+		};
+
+		struct ClipVertex {
+			float Position[4];
+			float Attributes[6];
+		};
+
+		void beginDraw();
+		void addTriangle(VertexPositionColorTexture const& v0, VertexPositionColorTexture const& v1, VertexPositionColorTexture const& v2,
+			Matrix const& transform, Texture2D const* texture, CullMode cull);
+		void setupTriangle(ClipVertex const& v0, ClipVertex const& v1, ClipVertex const& v2, Texture2D const* texture, CullMode cull);
+		void endDraw();
+		size_t drawBin(size_t bin);
+		size_t drawTile(Triangle const& triangle, int32_t tileX, int32_t tileY, bool covered);
+
+		RenderTarget2D* _renderTarget{ nullptr };
+		Texture2D const* _texture{ nullptr };
+		Matrix _transform;
+		BlendMode _blend{ BlendMode::Opaque };
+		CompareFunction _depthFunction{ CompareFunction::LessEqual };
+		bool _depthWrite{ true };
+		CullMode _cull{ CullMode::CullCounterClockwiseFace };
+		size_t _threadCount{ 0 };
+		std::vector<Triangle> _triangles;
+		std::vector<std::vector<uint32_t>> _bins;
+		int32_t _binColumns{ 0 };
+		int32_t _binRows{ 0 };
+		size_t _trianglesDrawn{ 0 };
+		size_t _pixelsDrawn{ 0 };
+	};
+}
+
+#endif
@@ -0,0 +1,381 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+#include "SpriteBatch.hpp"
+#include "../Profiler.hpp"
+
+using CSharp::Nullable;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		// Maps a float to an unsigned integer with the same ordering, so depths radix sort as plain keys.
+		uint32_t orderedBits(float value) {
+			auto bits = std::bit_cast<uint32_t>(value);
+			return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+		}
+
+		bool hasEffect(SpriteEffects effects, SpriteEffects flag) {
+			return (effects & flag) != SpriteEffects::None;
+		}
+
+		void setVertices(VertexPositionColorTexture* vertices, float x, float y, float w, float h,
+			Vector2 const& texCoordTL, Vector2 const& texCoordBR) {
+			vertices[0].Position.X = x;
+			vertices[0].Position.Y = y;
+			vertices[0].TextureCoordinate = texCoordTL;
+
+			vertices[1].Position.X = x + w;
+			vertices[1].Position.Y = y;
+			vertices[1].TextureCoordinate = Vector2(texCoordBR.X, texCoordTL.Y);
+
+			vertices[2].Position.X = x;
+			vertices[2].Position.Y = y + h;
+			vertices[2].TextureCoordinate = Vector2(texCoordTL.X, texCoordBR.Y);
+
+			vertices[3].Position.X = x + w;
+			vertices[3].Position.Y = y + h;
+			vertices[3].TextureCoordinate = texCoordBR;
+		}
+
+		// Corners are offset by (dx, dy) from the rotation point (x, y) before rotating.
+		void setVertices(VertexPositionColorTexture* vertices, float x, float y, float dx, float dy, float w, float h,
+			float sin, float cos, Vector2 const& texCoordTL, Vector2 const& texCoordBR) {
+			vertices[0].Position.X = x + dx * cos - dy * sin;
+			vertices[0].Position.Y = y + dx * sin + dy * cos;
+			vertices[0].TextureCoordinate = texCoordTL;
+
+			vertices[1].Position.X = x + (dx + w) * cos - dy * sin;
+			vertices[1].Position.Y = y + (dx + w) * sin + dy * cos;
+			vertices[1].TextureCoordinate = Vector2(texCoordBR.X, texCoordTL.Y);
+
+			vertices[2].Position.X = x + dx * cos - (dy + h) * sin;
+			vertices[2].Position.Y = y + dx * sin + (dy + h) * cos;
+			vertices[2].TextureCoordinate = Vector2(texCoordTL.X, texCoordBR.Y);
+
+			vertices[3].Position.X = x + (dx + w) * cos - (dy + h) * sin;
+			vertices[3].Position.Y = y + (dx + w) * sin + (dy + h) * cos;
+			vertices[3].TextureCoordinate = texCoordBR;
+		}
+
+		void applyEffects(SpriteEffects effects, Vector2& texCoordTL, Vector2& texCoordBR) {
+			if (hasEffect(effects, SpriteEffects::FlipVertically))
+				std::swap(texCoordTL.Y, texCoordBR.Y);
+
+			if (hasEffect(effects, SpriteEffects::FlipHorizontally))
+				std::swap(texCoordTL.X, texCoordBR.X);
+		}
+
+		vector<uint16_t> createIndices() {
+			vector<uint16_t> indices(SpriteBatch::MaxBatchSize * 6);
+
+			for (size_t i = 0; i < SpriteBatch::MaxBatchSize; ++i) {
+				auto vertex = static_cast<uint16_t>(i * 4);
+				auto index = indices.data() + i * 6;
+
+				index[0] = vertex;
+				index[1] = vertex + 1;
+				index[2] = vertex + 2;
+				index[3] = vertex + 1;
+				index[4] = vertex + 3;
+				index[5] = vertex + 2;
+			}
+
+			return indices;
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	SpriteBatch::SpriteBatch(size_t initialCapacity) {
+		_items.reserve(initialCapacity);
+		_keys.reserve(initialCapacity);
+		_scratch.reserve(initialCapacity);
+		_vertices.reserve(initialCapacity * 4);
+	}
+}
+
+//Functions
+namespace Xna {
+	bool SpriteBatch::Begin(SpriteSortMode sortMode, Matrix const& transformMatrix) {
+		if (_active)
+			return false;
+
+		_sortMode = sortMode;
+		_transform = transformMatrix;
+		_hasTransform = !(transformMatrix == Matrix::Identity);
+		_items.clear();
+		_vertices.clear();
+		_batches.clear();
+		_active = true;
+
+		return true;
+	}
+
+	bool SpriteBatch::End() {
+		if (!_active)
+			return false;
+
+		XNA_PROFILE_ZONE("SpriteBatch::End");
+
+		flush();
+		_active = false;
+
+		return true;
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Vector2 const& position, Nullable<Rectangle> const& sourceRectangle, Color const& color,
+		float rotation, Vector2 const& origin, Vector2 const& scale, SpriteEffects effects, float layerDepth) {
+		if (!_active || !texture)
+			return;
+
+		auto& item = createItem(texture, layerDepth, color);
+		auto scaledOrigin = origin * scale;
+		Vector2 texCoordTL;
+		Vector2 texCoordBR;
+		float w;
+		float h;
+
+		if (sourceRectangle.HasValue()) {
+			auto source = sourceRectangle.Value();
+			w = source.Width * scale.X;
+			h = source.Height * scale.Y;
+			texCoordTL = Vector2(source.X * texture->TexelWidth(), source.Y * texture->TexelHeight());
+			texCoordBR = Vector2((source.X + source.Width) * texture->TexelWidth(), (source.Y + source.Height) * texture->TexelHeight());
+		}
+		else {
+			w = texture->Width() * scale.X;
+			h = texture->Height() * scale.Y;
+			texCoordTL = Vector2(0, 0);
+			texCoordBR = Vector2(1, 1);
+		}
+
+		applyEffects(effects, texCoordTL, texCoordBR);
+
+		if (rotation == 0)
+			setVertices(item.Vertices, position.X - scaledOrigin.X, position.Y - scaledOrigin.Y, w, h, texCoordTL, texCoordBR);
+		else
+			setVertices(item.Vertices, position.X, position.Y, -scaledOrigin.X, -scaledOrigin.Y, w, h,
+				std::sin(rotation), std::cos(rotation), texCoordTL, texCoordBR);
+
+		if (_sortMode == SpriteSortMode::Immediate)
+			flush();
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Vector2 const& position, Nullable<Rectangle> const& sourceRectangle, Color const& color,
+		float rotation, Vector2 const& origin, float scale, SpriteEffects effects, float layerDepth) {
+		Draw(texture, position, sourceRectangle, color, rotation, origin, Vector2(scale, scale), effects, layerDepth);
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Rectangle const& destinationRectangle, Nullable<Rectangle> const& sourceRectangle, Color const& color,
+		float rotation, Vector2 const& origin, SpriteEffects effects, float layerDepth) {
+		if (!_active || !texture)
+			return;
+
+		auto& item = createItem(texture, layerDepth, color);
+		auto scaledOrigin = origin;
+		Vector2 texCoordTL;
+		Vector2 texCoordBR;
+
+		if (sourceRectangle.HasValue()) {
+			auto source = sourceRectangle.Value();
+			texCoordTL = Vector2(source.X * texture->TexelWidth(), source.Y * texture->TexelHeight());
+			texCoordBR = Vector2((source.X + source.Width) * texture->TexelWidth(), (source.Y + source.Height) * texture->TexelHeight());
+
+			// The origin is given in source texels; scale it to destination units.
+			scaledOrigin.X = source.Width != 0
+				? origin.X * destinationRectangle.Width / source.Width
+				: origin.X * destinationRectangle.Width * texture->TexelWidth();
+			scaledOrigin.Y = source.Height != 0
+				? origin.Y * destinationRectangle.Height / source.Height
+				: origin.Y * destinationRectangle.Height * texture->TexelHeight();
+		}
+		else {
+			texCoordTL = Vector2(0, 0);
+			texCoordBR = Vector2(1, 1);
+			scaledOrigin.X = origin.X * destinationRectangle.Width * texture->TexelWidth();
+			scaledOrigin.Y = origin.Y * destinationRectangle.Height * texture->TexelHeight();
+		}
+
+		applyEffects(effects, texCoordTL, texCoordBR);
+
+		auto x = static_cast<float>(destinationRectangle.X);
+		auto y = static_cast<float>(destinationRectangle.Y);
+		auto w = static_cast<float>(destinationRectangle.Width);
+		auto h = static_cast<float>(destinationRectangle.Height);
+
+		if (rotation == 0)
+			setVertices(item.Vertices, x - scaledOrigin.X, y - scaledOrigin.Y, w, h, texCoordTL, texCoordBR);
+		else
+			setVertices(item.Vertices, x, y, -scaledOrigin.X, -scaledOrigin.Y, w, h,
+				std::sin(rotation), std::cos(rotation), texCoordTL, texCoordBR);
+
+		if (_sortMode == SpriteSortMode::Immediate)
+			flush();
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Vector2 const& position, Nullable<Rectangle> const& sourceRectangle, Color const& color) {
+		Draw(texture, position, sourceRectangle, color, 0.0f, Vector2(0, 0), Vector2(1, 1), SpriteEffects::None, 0.0f);
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Rectangle const& destinationRectangle, Nullable<Rectangle> const& sourceRectangle, Color const& color) {
+		Draw(texture, destinationRectangle, sourceRectangle, color, 0.0f, Vector2(0, 0), SpriteEffects::None, 0.0f);
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Vector2 const& position, Color const& color) {
+		Draw(texture, position, CSharp::csnull, color);
+	}
+
+	void SpriteBatch::Draw(Texture2D const* texture, Rectangle const& destinationRectangle, Color const& color) {
+		Draw(texture, destinationRectangle, CSharp::csnull, color);
+	}
+
+	bool SpriteBatch::IsActive() const {
+		return _active;
+	}
+
+	SpriteSortMode SpriteBatch::SortMode() const {
+		return _sortMode;
+	}
+
+	Matrix SpriteBatch::Transform() const {
+		return _transform;
+	}
+
+	size_t SpriteBatch::PendingCount() const {
+		return _items.size();
+	}
+
+	vector<VertexPositionColorTexture> const& SpriteBatch::Vertices() const {
+		return _vertices;
+	}
+
+	vector<SpriteBatchDraw> const& SpriteBatch::Batches() const {
+		return _batches;
+	}
+}
+
+//Static
+namespace Xna {
+	vector<uint16_t> const& SpriteBatch::Indices() {
+		static vector<uint16_t> const indices = createIndices();
+		return indices;
+	}
+}
+
+//Private
+namespace Xna {
+	SpriteBatch::Item& SpriteBatch::createItem(Texture2D const* texture, float layerDepth, Color const& color) {
+		auto& item = _items.emplace_back();
+		item.Texture = texture;
+		item.Depth = layerDepth;
+
+		for (auto& vertex : item.Vertices) {
+			vertex.Position.Z = layerDepth;
+			vertex.Color = color;
+		}
+
+		return item;
+	}
+
+	void SpriteBatch::flush() {
+		if (_items.empty())
+			return;
+
+		_vertices.reserve(_vertices.size() + _items.size() * 4);
+
+		if (_sortMode == SpriteSortMode::Deferred || _sortMode == SpriteSortMode::Immediate) {
+			for (auto const& item : _items)
+				emit(item);
+		}
+		else {
+			sortItems();
+
+			for (auto key : _keys)
+				emit(_items[static_cast<uint32_t>(key)]);
+		}
+
+		_items.clear();
+	}
+
+	// Keys hold the sort key in the high half and the submission index in the low half. An LSD radix sort over
+	// the high half is stable, so equal keys keep submission order; bytes that are the same in every key are skipped.
+	void SpriteBatch::sortItems() {
+		auto count = _items.size();
+		_keys.resize(count);
+		_scratch.resize(count);
+
+		for (size_t i = 0; i < count; ++i) {
+			auto const& item = _items[i];
+			uint32_t key;
+
+			switch (_sortMode) {
+			case SpriteSortMode::Texture:
+				key = item.Texture->SortingKey();
+				break;
+			case SpriteSortMode::FrontToBack:
+				key = orderedBits(item.Depth);
+				break;
+			default:
+				key = ~orderedBits(item.Depth);
+				break;
+			}
+
+			_keys[i] = (static_cast<uint64_t>(key) << 32) | i;
+		}
+
+		if (std::is_sorted(_keys.begin(), _keys.end()))
+			return;
+
+		auto source = _keys.data();
+		auto destination = _scratch.data();
+
+		for (int32_t shift = 32; shift < 64; shift += 8) {
+			size_t counts[256] = {};
+
+			for (size_t i = 0; i < count; ++i)
+				++counts[(source[i] >> shift) & 0xFF];
+
+			if (counts[(source[0] >> shift) & 0xFF] == count)
+				continue;
+
+			size_t offset = 0;
+			for (auto& bucket : counts) {
+				auto size = bucket;
+				bucket = offset;
+				offset += size;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+				destination[counts[(source[i] >> shift) & 0xFF]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != _keys.data())
+			std::copy_n(source, count, _keys.data());
+	}
+
+	void SpriteBatch::emit(Item const& item) {
+		if (_batches.empty() || _batches.back().Texture != item.Texture || _batches.back().SpriteCount == MaxBatchSize
+			|| _sortMode == SpriteSortMode::Immediate) {
+			SpriteBatchDraw batch;
+			batch.Texture = item.Texture;
+			batch.VertexStart = _vertices.size();
+			_batches.push_back(batch);
+		}
+
+		++_batches.back().SpriteCount;
+
+		if (_hasTransform) {
+			for (auto const& vertex : item.Vertices)
+				_vertices.emplace_back(Vector3::Transform(vertex.Position, _transform), vertex.Color, vertex.TextureCoordinate);
+		}
+		else {
+			_vertices.insert(_vertices.end(), item.Vertices, item.Vertices + 4);
+		}
+	}
+}
@@ -0,0 +1,92 @@
+#ifndef _SPRITEBATCH_HPP_
+#define _SPRITEBATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Color.hpp"
+#include "../Matrix.hpp"
+#include "../Rectangle.hpp"
+#include "../Vector2.hpp"
+#include "../CSharp/Nullable.hpp"
+#include "SpriteEffects.hpp"
+#include "SpriteSortMode.hpp"
+#include "Texture2D.hpp"
+#include "VertexPositionColorTexture.hpp"
+
+namespace Xna {
+
+	// A run of sprites sharing one texture. Vertices start at VertexStart in SpriteBatch::Vertices() and are indexed
+	// by the first SpriteCount * 6 entries of SpriteBatch::Indices(), relative to VertexStart.
+	struct SpriteBatchDraw {
+		Texture2D const* Texture{ nullptr };
+		size_t VertexStart{ 0 };
+		size_t SpriteCount{ 0 };
+	};
+
+	// CPU port of SpriteBatch. Draw() expands each sprite into four vertices; End() orders the sprites by the sort mode
+	// and writes them, with the transform applied, into Vertices() and Batches() for a renderer to consume.
+	// Every buffer is reused across Begin/End pairs, so a steady state frame performs no allocation.
+	class SpriteBatch {
+	public:
+		// Largest number of sprites whose vertices fit 16-bit indices.
+		static constexpr size_t MaxBatchSize = 5461;
+
+		SpriteBatch(size_t initialCapacity = 256);
+
+		// Returns false when the batch has already begun. Clears the output of the previous End().
+		bool Begin(SpriteSortMode sortMode = SpriteSortMode::Deferred, Matrix const& transformMatrix = Matrix::Identity);
+
+		// Returns false when Begin() has not been called.
+		bool End();
+
+		// Calls made outside Begin/End or with a null texture are ignored.
+		void Draw(Texture2D const* texture, Vector2 const& position, CSharp::Nullable<Rectangle> const& sourceRectangle, Color const& color,
+			float rotation, Vector2 const& origin, Vector2 const& scale, SpriteEffects effects, float layerDepth);
+		void Draw(Texture2D const* texture, Vector2 const& position, CSharp::Nullable<Rectangle> const& sourceRectangle, Color const& color,
+			float rotation, Vector2 const& origin, float scale, SpriteEffects effects, float layerDepth);
+		void Draw(Texture2D const* texture, Rectangle const& destinationRectangle, CSharp::Nullable<Rectangle> const& sourceRectangle, Color const& color,
+			float rotation, Vector2 const& origin, SpriteEffects effects, float layerDepth);
+		void Draw(Texture2D const* texture, Vector2 const& position, CSharp::Nullable<Rectangle> const& sourceRectangle, Color const& color);
+		void Draw(Texture2D const* texture, Rectangle const& destinationRectangle, CSharp::Nullable<Rectangle> const& sourceRectangle, Color const& color);
+		void Draw(Texture2D const* texture, Vector2 const& position, Color const& color);
+		void Draw(Texture2D const* texture, Rectangle const& destinationRectangle, Color const& color);
+
+		bool IsActive() const;
+		SpriteSortMode SortMode() const;
+		Matrix Transform() const;
+
+		// Sprites submitted since Begin() that have not been written out yet.
+		size_t PendingCount() const;
+
+		std::vector<VertexPositionColorTexture> const& Vertices() const;
+		std::vector<SpriteBatchDraw> const& Batches() const;
+
+		// Quad index pattern 0,1,2, 1,3,2 repeated for MaxBatchSize sprites.
+		static std::vector<uint16_t> const& Indices();
+
+	private:
+		struct Item {
+			Texture2D const* Texture;
+			float Depth;
+			VertexPositionColorTexture Vertices[4];
+		};
+
+		Item& createItem(Texture2D const* texture, float layerDepth, Color const& color);
+		void flush();
+		void sortItems();
+		void emit(Item const& item);
+
+		std::vector<Item> _items;
+		std::vector<uint64_t> _keys;
+		std::vector<uint64_t> _scratch;
+		std::vector<VertexPositionColorTexture> _vertices;
+		std::vector<SpriteBatchDraw> _batches;
+		Matrix _transform;
+		SpriteSortMode _sortMode{ SpriteSortMode::Deferred };
+		bool _hasTransform{ false };
+		bool _active{ false };
+	};
+}
+
+#endif
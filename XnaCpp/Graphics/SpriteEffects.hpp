@@ -0,0 +1,26 @@
+#ifndef _SPRITEEFFECTS_HPP_
+#define _SPRITEEFFECTS_HPP_
+
+namespace Xna {
+	enum class SpriteEffects {
+
+		// No mirroring.
+		None = 0,
+
+		// Mirror the texture coordinates left to right.
+		FlipHorizontally = 1,
+
+		// Mirror the texture coordinates top to bottom.
+		FlipVertically = 2
+	};
+
+	constexpr SpriteEffects operator |(SpriteEffects a, SpriteEffects b) {
+		return static_cast<SpriteEffects>(static_cast<int>(a) | static_cast<int>(b));
+	}
+
+	constexpr SpriteEffects operator &(SpriteEffects a, SpriteEffects b) {
+		return static_cast<SpriteEffects>(static_cast<int>(a) & static_cast<int>(b));
+	}
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef _SPRITESORTMODE_HPP_
+#define _SPRITESORTMODE_HPP_
+
+namespace Xna {
+	enum class SpriteSortMode {
+
+		// Sprites are kept in submission order and emitted at End().
+		Deferred,
+
+		// Each sprite is emitted as its own draw as soon as it is submitted.
+		Immediate,
+
+		// Sprites are grouped by texture, keeping submission order within a texture.
+		Texture,
+
+		// Sprites are sorted by descending layer depth.
+		BackToFront,
+
+		// Sprites are sorted by ascending layer depth.
+		FrontToBack
+	};
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <atomic>
+#include "Texture2D.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		std::atomic<uint32_t> nextSortingKey{ 0 };
+	}
+}
+
+//Constructors
+namespace Xna {
+	Texture2D::Texture2D(int32_t width, int32_t height) :
+		_width(width < 1 ? 1 : width), _height(height < 1 ? 1 : height),
+		_sortingKey(nextSortingKey.fetch_add(1, std::memory_order_relaxed)) {
+		_data.resize(static_cast<size_t>(_width) * static_cast<size_t>(_height));
+	}
+}
+
+//Functions
+namespace Xna {
+	int32_t Texture2D::Width() const {
+		return _width;
+	}
+
+	int32_t Texture2D::Height() const {
+		return _height;
+	}
+
+	Rectangle Texture2D::Bounds() const {
+		return Rectangle(0, 0, _width, _height);
+	}
+
+	float Texture2D::TexelWidth() const {
+		return 1.0f / static_cast<float>(_width);
+	}
+
+	float Texture2D::TexelHeight() const {
+		return 1.0f / static_cast<float>(_height);
+	}
+
+	uint32_t Texture2D::SortingKey() const {
+		return _sortingKey;
+	}
+
+	vector<Color> const& Texture2D::Data() const {
+		return _data;
+	}
+
+	void Texture2D::GetData(vector<Color>& data) const {
+		data = _data;
+	}
+
+	void Texture2D::SetData(vector<Color> const& data) {
+		std::copy_n(data.begin(), std::min(data.size(), _data.size()), _data.begin());
+	}
+}
+
+//Private
+namespace Xna {
+	vector<Color>& Texture2D::data() {
+		return _data;
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef _TEXTURE2D_HPP_
+#define _TEXTURE2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Color.hpp"
+#include "../Rectangle.hpp"
+
+namespace Xna {
+
+	// CPU-side stand-in for Texture2D: a row-major Color surface with the metadata sprite batching needs.
+	class Texture2D {
+	public:
+		Texture2D(int32_t width, int32_t height);
+
+		int32_t Width() const;
+		int32_t Height() const;
+		Rectangle Bounds() const;
+
+		// Size of one texel in normalized texture coordinates.
+		float TexelWidth() const;
+		float TexelHeight() const;
+
+		// Unique per texture; SpriteSortMode::Texture groups sprites by it.
+		uint32_t SortingKey() const;
+
+		std::vector<Color> const& Data() const;
+		void GetData(std::vector<Color>& data) const;
+
+		// Copies min(data.size(), Width * Height) texels.
+		void SetData(std::vector<Color> const& data);
+
+	protected:
+		std::vector<Color>& data();
+
+	private:
+		std::vector<Color> _data;
+		int32_t _width{ 0 };
+		int32_t _height{ 0 };
+		uint32_t _sortingKey{ 0 };
+	};
+}
+
+#endif
@@ -0,0 +1,20 @@
+#include "VertexPositionColorTexture.hpp"
+
+//Constructors
+namespace Xna {
+	VertexPositionColorTexture::VertexPositionColorTexture() {}
+
+	VertexPositionColorTexture::VertexPositionColorTexture(Vector3 const& position, Xna::Color const& color, Vector2 const& textureCoordinate) :
+		Position(position), Color(color), TextureCoordinate(textureCoordinate) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(VertexPositionColorTexture const& a, VertexPositionColorTexture const& b) {
+		return a.Position == b.Position && a.Color == b.Color && a.TextureCoordinate == b.TextureCoordinate;
+	}
+
+	bool operator !=(VertexPositionColorTexture const& a, VertexPositionColorTexture const& b) {
+		return !(a == b);
+	}
+}
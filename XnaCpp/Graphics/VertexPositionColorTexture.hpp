@@ -0,0 +1,22 @@
+#ifndef _VERTEXPOSITIONCOLORTEXTURE_HPP_
+#define _VERTEXPOSITIONCOLORTEXTURE_HPP_
+
+#include "../Color.hpp"
+#include "../Vector2.hpp"
+#include "../Vector3.hpp"
+
+namespace Xna {
+	struct VertexPositionColorTexture {
+		Vector3 Position;
+		Xna::Color Color;
+		Vector2 TextureCoordinate;
+
+		VertexPositionColorTexture();
+		VertexPositionColorTexture(Vector3 const& position, Xna::Color const& color, Vector2 const& textureCoordinate);
+
+		friend bool operator ==(VertexPositionColorTexture const& a, VertexPositionColorTexture const& b);
+		friend bool operator !=(VertexPositionColorTexture const& a, VertexPositionColorTexture const& b);
+	};
+}
+
+#endif
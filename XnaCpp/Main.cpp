@@ -5,6 +5,7 @@
 #include "Vector3.hpp"
 #include "Matrix.hpp"
 #include "CSharp/Nullable.hpp"
+#include "SimdDispatch.hpp"
 #include <vector>
 #include <memory>
 
@@ -18,6 +19,8 @@ int Teste(Nullable<Vector3> const& vector3) {
 
 int main()
 {
+	cout << Simd::Dispatch::Report() << endl;
+
 	Nullable<Vector3> _nullable;
 	cout << Teste(csnull);
 
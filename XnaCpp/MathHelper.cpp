@@ -1,8 +1,197 @@
 #include "MathHelper.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cmath>
 #include <limits>
+#include "SimdLanes.hpp"
 
 using std::numeric_limits;
+using std::vector;
+using Xna::Simd::BatchLanes;
+using Xna::Simd::ScalarLanes;
+
+//Private
+namespace Xna {
+	namespace {
+		std::atomic<bool> useFastMath{ false };
+
+		// Beyond this the three-part reduction loses too many bits, so SinCos hands larger, infinite and NaN angles
+		// to the standard library.
+		constexpr float sinCosRange = 65536.0f;
+
+		bool inSinCosRange(float angle) {
+			return std::abs(angle) <= sinCosRange;
+		}
+
+		// Cody-Waite reduction by Pi/2 in three parts, then Cephes minimax polynomials on [-Pi/4, Pi/4].
+		template <typename L>
+		void sinCos(typename L::Float x, typename L::Float& sin, typename L::Float& cos) {
+			auto quadrant = L::Round(L::Mul(x, L::Set(0.636619772f)));
+			auto q = L::ToFloat(quadrant);
+			auto r = L::Sub(x, L::Mul(q, L::Set(1.5703125f)));
+			r = L::Sub(r, L::Mul(q, L::Set(4.837512969970703125e-4f)));
+			r = L::Sub(r, L::Mul(q, L::Set(7.54978995489188216e-8f)));
+			auto z = L::Mul(r, r);
+
+			auto s = L::Add(L::Mul(L::Set(-1.9515295891e-4f), z), L::Set(8.3321608736e-3f));
+			s = L::Add(L::Mul(s, z), L::Set(-1.6666654611e-1f));
+			s = L::Add(r, L::Mul(L::Mul(s, z), r));
+
+			auto c = L::Add(L::Mul(L::Set(2.443315711809948e-5f), z), L::Set(-1.388731625493765e-3f));
+			c = L::Add(L::Mul(c, z), L::Set(4.166664568298827e-2f));
+			c = L::Add(L::Sub(L::Set(1.0f), L::Mul(z, L::Set(0.5f))), L::Mul(L::Mul(c, z), z));
+
+			auto swap = L::TestBit(quadrant, 1);
+			auto negative = L::Set(-0.0f);
+
+			sin = L::Xor(L::Select(swap, c, s), L::And(L::TestBit(quadrant, 2), negative));
+			cos = L::Xor(L::Select(swap, s, c), L::And(L::TestBit(L::AddInt(quadrant, 1), 2), negative));
+		}
+
+		// Cephes asinf polynomial; above 0.5 the argument is reduced with asin(x) = Pi/2 - 2 asin(sqrt((1 - x) / 2)).
+		template <typename L>
+		typename L::Float acos(typename L::Float x) {
+			auto negative = L::Set(-0.0f);
+			auto sign = L::And(x, negative);
+			auto a = L::Xor(x, sign);
+			auto large = L::Greater(a, L::Set(0.5f));
+			auto z = L::Select(large, L::Mul(L::Sub(L::Set(1.0f), a), L::Set(0.5f)), L::Mul(a, a));
+			auto s = L::Select(large, L::Sqrt(z), a);
+
+			auto p = L::Add(L::Mul(L::Set(4.2163199048e-2f), z), L::Set(2.4181311049e-2f));
+			p = L::Add(L::Mul(p, z), L::Set(4.5470025998e-2f));
+			p = L::Add(L::Mul(p, z), L::Set(7.4953002686e-2f));
+			p = L::Add(L::Mul(p, z), L::Set(1.6666752422e-1f));
+			auto asin = L::Add(s, L::Mul(L::Mul(s, z), p));
+
+			auto twice = L::Add(asin, asin);
+			auto largeResult = L::Select(L::SignMask(x), L::Sub(L::Set(MathHelper::PI), twice), twice);
+			auto smallResult = L::Sub(L::Set(MathHelper::PIOVER2), L::Xor(asin, sign));
+
+			return L::Select(large, largeResult, smallResult);
+		}
+
+		// atan of min/max on [0, 1], reduced once around tan(Pi/8), then unfolded into the octant of (x, y).
+		template <typename L>
+		typename L::Float atan2(typename L::Float y, typename L::Float x) {
+			auto negative = L::Set(-0.0f);
+			auto ax = L::Xor(x, L::And(x, negative));
+			auto ay = L::Xor(y, L::And(y, negative));
+			auto high = L::Max(ax, ay);
+			auto t = L::And(L::Greater(high, L::Set(0.0f)), L::Div(L::Min(ax, ay), high));
+
+			auto reduce = L::Greater(t, L::Set(0.4142135623730950f));
+			t = L::Select(reduce, L::Div(L::Sub(t, L::Set(1.0f)), L::Add(t, L::Set(1.0f))), t);
+			auto z = L::Mul(t, t);
+
+			auto p = L::Add(L::Mul(L::Set(8.05374449538e-2f), z), L::Set(-1.38776856032e-1f));
+			p = L::Add(L::Mul(p, z), L::Set(1.99777106478e-1f));
+			p = L::Add(L::Mul(p, z), L::Set(-3.33329491539e-1f));
+			auto a = L::Add(L::And(reduce, L::Set(MathHelper::PiOVER4)), L::Add(L::Mul(L::Mul(p, z), t), t));
+
+			a = L::Select(L::Greater(ay, ax), L::Sub(L::Set(MathHelper::PIOVER2), a), a);
+			a = L::Select(L::SignMask(x), L::Sub(L::Set(MathHelper::PI), a), a);
+			a = L::Xor(a, L::And(y, negative));
+
+			// Infinity over infinity is NaN above; two infinite operands give the diagonal of their quadrant.
+			auto infinity = L::Set(numeric_limits<float>::infinity());
+			auto diagonal = L::Select(L::SignMask(x), L::Set(3 * MathHelper::PiOVER4), L::Set(MathHelper::PiOVER4));
+			a = L::Select(L::And(L::Equal(ax, infinity), L::Equal(ay, infinity)), L::Xor(diagonal, L::And(y, negative)), a);
+
+			// Max and Min drop a NaN operand, so NaN is put back from the inputs.
+			return L::Select(L::And(L::Equal(x, x), L::Equal(y, y)), a, L::Add(x, y));
+		}
+
+		template <typename L>
+		typename L::Float reciprocalSqrt(typename L::Float x) {
+			auto estimate = L::ReciprocalSqrtEstimate(x);
+			auto refined = L::Mul(estimate, L::Sub(L::Set(1.5f), L::Mul(L::Mul(L::Mul(x, L::Set(0.5f)), estimate), estimate)));
+
+			// The Newton step turns the infinite estimate for 0, and the zero estimate for infinity, into NaN.
+			refined = L::Select(L::Equal(x, L::Set(numeric_limits<float>::infinity())), L::Set(0.0f), refined);
+			return L::Select(L::Equal(x, L::Set(0.0f)), estimate, refined);
+		}
+
+		// exp(x) = 2^n exp(r) with r = x - n ln 2 in two parts; 2^n is applied in halves so n = 128 stays finite.
+		template <typename L>
+		typename L::Float exp(typename L::Float x) {
+			auto clamped = L::Min(L::Max(x, L::Set(-87.33654f)), L::Set(88.72283f));
+			auto n = L::Round(L::Mul(clamped, L::Set(1.44269504088896341f)));
+			auto nf = L::ToFloat(n);
+			auto r = L::Sub(clamped, L::Mul(nf, L::Set(0.693359375f)));
+			r = L::Sub(r, L::Mul(nf, L::Set(-2.12194440e-4f)));
+
+			auto p = L::Add(L::Mul(L::Set(1.9875691500e-4f), r), L::Set(1.3981999507e-3f));
+			p = L::Add(L::Mul(p, r), L::Set(8.3334519073e-3f));
+			p = L::Add(L::Mul(p, r), L::Set(4.1665795894e-2f));
+			p = L::Add(L::Mul(p, r), L::Set(1.6666665459e-1f));
+			p = L::Add(L::Mul(p, r), L::Set(5.0000001201e-1f));
+			auto e = L::Add(L::Add(L::Mul(L::Mul(r, r), p), r), L::Set(1.0f));
+
+			auto half = L::HalfInt(n);
+			auto result = L::Mul(L::Mul(e, L::Pow2(half)), L::Pow2(L::SubInt(n, half)));
+
+			result = L::Select(L::Greater(x, L::Set(88.72283f)), L::Set(numeric_limits<float>::infinity()), result);
+			result = L::Select(L::Less(x, L::Set(-87.33654f)), L::Set(0.0f), result);
+
+			// The clamp drops NaN, so it is put back.
+			return L::Select(L::Equal(x, x), result, x);
+		}
+
+		// Runs kernel over count elements; the tail is padded to a full register so every element sees the same code.
+		template <typename Kernel>
+		void forEachBlock(size_t count, Kernel const& kernel) {
+			constexpr auto width = BatchLanes::Width;
+			size_t i = 0;
+
+			for (; i + width <= count; i += width)
+				kernel(i, width);
+
+			if (i < count)
+				kernel(i, count - i);
+		}
+
+		template <typename Function>
+		void unary(float const* source, float* destination, size_t count, Function const& function) {
+			forEachBlock(count, [&](size_t offset, size_t length) {
+				float input[BatchLanes::Width] = {};
+				float output[BatchLanes::Width];
+				auto full = length == BatchLanes::Width;
+				auto in = full ? source + offset : input;
+				auto out = full ? destination + offset : output;
+
+				if (!full)
+					std::copy_n(source + offset, length, input);
+
+				BatchLanes::Store(out, function(BatchLanes::Load(in)));
+
+				if (!full)
+					std::copy_n(output, length, destination + offset);
+				});
+		}
+
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+
+		int32_t ulpDistance(float value, double exact) {
+			auto expected = static_cast<float>(exact);
+
+			if (std::isnan(value) || std::isnan(expected))
+				return std::isnan(value) == std::isnan(expected) ? 0 : numeric_limits<int32_t>::max();
+
+			auto ordered = [](float f) {
+				auto bits = std::bit_cast<int32_t>(f);
+				return static_cast<int64_t>(bits < 0 ? numeric_limits<int32_t>::min() - bits : bits);
+			};
+
+			auto distance = std::abs(ordered(value) - ordered(expected));
+			return static_cast<int32_t>(distance > numeric_limits<int32_t>::max() ? numeric_limits<int32_t>::max() : distance);
+		}
+	}
+}
 
 namespace Xna {
 
@@ -95,7 +284,9 @@ namespace Xna {
 		if ((angle > -PI) && (angle <= PI))
 			return angle;
 
-		angle = fmod(angle, TWOPI);
+		angle = UseFastMath()
+			? angle - TWOPI * std::nearbyint(angle * (1.0f / TWOPI))
+			: fmod(angle, TWOPI);
 		
 		if (angle <= -PI)
 			return angle + TWOPI;
@@ -122,4 +313,178 @@ namespace Xna {
 		else
 			return 0;
 	}
-}
\ No newline at end of file
+
+	void MathHelper::SinCos(float angle, float& sin, float& cos) {
+		if (!inSinCosRange(angle)) {
+			sin = std::sin(angle);
+			cos = std::cos(angle);
+			return;
+		}
+
+		sinCos<ScalarLanes>(angle, sin, cos);
+	}
+
+	float MathHelper::Acos(float value) {
+		return acos<ScalarLanes>(value);
+	}
+
+	float MathHelper::Atan2(float y, float x) {
+		return atan2<ScalarLanes>(y, x);
+	}
+
+	float MathHelper::ReciprocalSqrt(float value) {
+		return reciprocalSqrt<ScalarLanes>(value);
+	}
+
+	float MathHelper::Exp(float value) {
+		return exp<ScalarLanes>(value);
+	}
+
+	void MathHelper::SinCos(vector<float> const& angles, size_t sourceIndex,
+		vector<float>& sines, vector<float>& cosines, size_t destinationIndex, size_t length) {
+		if (!validRange(angles.size(), sourceIndex, std::min(sines.size(), cosines.size()), destinationIndex, length))
+			return;
+
+		auto source = angles.data() + sourceIndex;
+		auto sin = sines.data() + destinationIndex;
+		auto cos = cosines.data() + destinationIndex;
+
+		forEachBlock(length, [&](size_t offset, size_t count) {
+			float input[BatchLanes::Width] = {};
+			float sinOutput[BatchLanes::Width];
+			float cosOutput[BatchLanes::Width];
+			BatchLanes::Float s;
+			BatchLanes::Float c;
+
+			std::copy_n(source + offset, count, input);
+			sinCos<BatchLanes>(BatchLanes::Load(input), s, c);
+			BatchLanes::Store(sinOutput, s);
+			BatchLanes::Store(cosOutput, c);
+			std::copy_n(sinOutput, count, sin + offset);
+			std::copy_n(cosOutput, count, cos + offset);
+
+			for (size_t i = 0; i < count; ++i) {
+				if (!inSinCosRange(input[i])) {
+					sin[offset + i] = std::sin(input[i]);
+					cos[offset + i] = std::cos(input[i]);
+				}
+			}
+			});
+	}
+
+	void MathHelper::SinCos(vector<float> const& angles, vector<float>& sines, vector<float>& cosines) {
+		SinCos(angles, 0, sines, cosines, 0, angles.size());
+	}
+
+	void MathHelper::Acos(vector<float> const& sourceArray, size_t sourceIndex,
+		vector<float>& destinationArray, size_t destinationIndex, size_t length) {
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		unary(sourceArray.data() + sourceIndex, destinationArray.data() + destinationIndex, length,
+			[](BatchLanes::Float value) { return acos<BatchLanes>(value); });
+	}
+
+	void MathHelper::Acos(vector<float> const& sourceArray, vector<float>& destinationArray) {
+		Acos(sourceArray, 0, destinationArray, 0, sourceArray.size());
+	}
+
+	void MathHelper::Atan2(vector<float> const& y, vector<float> const& x, size_t sourceIndex,
+		vector<float>& destinationArray, size_t destinationIndex, size_t length) {
+		if (!validRange(std::min(y.size(), x.size()), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		auto sourceY = y.data() + sourceIndex;
+		auto sourceX = x.data() + sourceIndex;
+		auto destination = destinationArray.data() + destinationIndex;
+
+		forEachBlock(length, [&](size_t offset, size_t count) {
+			float inputY[BatchLanes::Width] = {};
+			float inputX[BatchLanes::Width] = {};
+			float output[BatchLanes::Width];
+
+			std::copy_n(sourceY + offset, count, inputY);
+			std::copy_n(sourceX + offset, count, inputX);
+			BatchLanes::Store(output, atan2<BatchLanes>(BatchLanes::Load(inputY), BatchLanes::Load(inputX)));
+			std::copy_n(output, count, destination + offset);
+			});
+	}
+
+	void MathHelper::Atan2(vector<float> const& y, vector<float> const& x, vector<float>& destinationArray) {
+		Atan2(y, x, 0, destinationArray, 0, y.size());
+	}
+
+	void MathHelper::ReciprocalSqrt(vector<float> const& sourceArray, size_t sourceIndex,
+		vector<float>& destinationArray, size_t destinationIndex, size_t length) {
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		unary(sourceArray.data() + sourceIndex, destinationArray.data() + destinationIndex, length,
+			[](BatchLanes::Float value) { return reciprocalSqrt<BatchLanes>(value); });
+	}
+
+	void MathHelper::ReciprocalSqrt(vector<float> const& sourceArray, vector<float>& destinationArray) {
+		ReciprocalSqrt(sourceArray, 0, destinationArray, 0, sourceArray.size());
+	}
+
+	void MathHelper::Exp(vector<float> const& sourceArray, size_t sourceIndex,
+		vector<float>& destinationArray, size_t destinationIndex, size_t length) {
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		unary(sourceArray.data() + sourceIndex, destinationArray.data() + destinationIndex, length,
+			[](BatchLanes::Float value) { return exp<BatchLanes>(value); });
+	}
+
+	void MathHelper::Exp(vector<float> const& sourceArray, vector<float>& destinationArray) {
+		Exp(sourceArray, 0, destinationArray, 0, sourceArray.size());
+	}
+
+	bool MathHelper::UseFastMath() {
+		return useFastMath.load(std::memory_order_relaxed);
+	}
+
+	void MathHelper::UseFastMath(bool value) {
+		useFastMath.store(value, std::memory_order_relaxed);
+	}
+
+	FastMathErrorReport MathHelper::MaxError(size_t samples) {
+		FastMathErrorReport report;
+
+		if (samples == 0)
+			return report;
+
+		auto worst = [](int32_t& current, int32_t value) {
+			current = Max(current, value);
+		};
+
+		for (size_t i = 0; i <= samples; ++i) {
+			auto t = static_cast<float>(i) / static_cast<float>(samples);
+
+			float sin;
+			float cos;
+			auto angle = -TWOPI + 2 * TWOPI * t;
+			SinCos(angle, sin, cos);
+			worst(report.SinCosUlp, ulpDistance(sin, std::sin(static_cast<double>(angle))));
+			worst(report.SinCosUlp, ulpDistance(cos, std::cos(static_cast<double>(angle))));
+
+			auto value = -1.0f + 2.0f * t;
+			worst(report.AcosUlp, ulpDistance(Acos(value), std::acos(static_cast<double>(value))));
+
+			// Points on circles of several radii cover every octant and the reduction boundaries.
+			auto theta = -PI + TWOPI * t;
+			auto radius = std::ldexp(1.0f, static_cast<int32_t>(i % 16) - 8);
+			auto y = radius * std::sin(theta);
+			auto x = radius * std::cos(theta);
+			worst(report.Atan2Ulp, ulpDistance(Atan2(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x))));
+
+			auto square = std::ldexp(1.0f + 3.0f * t, static_cast<int32_t>(i % 64) - 32);
+			worst(report.ReciprocalSqrtUlp, ulpDistance(ReciprocalSqrt(square), 1.0 / std::sqrt(static_cast<double>(square))));
+
+			auto power = -87.0f + 175.5f * t;
+			worst(report.ExpUlp, ulpDistance(Exp(power), std::exp(static_cast<double>(power))));
+		}
+
+		return report;
+	}
+}
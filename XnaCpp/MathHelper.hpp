@@ -1,10 +1,22 @@
 #ifndef _MATHHELPER_HPP_
 #define _MATHHELPER_HPP_
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <vector>
 
 namespace Xna {
+
+	// Largest distance, in units in the last place, of the fast approximations from the correctly rounded result.
+	struct FastMathErrorReport {
+		int32_t SinCosUlp{ 0 };
+		int32_t AcosUlp{ 0 };
+		int32_t Atan2Ulp{ 0 };
+		int32_t ReciprocalSqrtUlp{ 0 };
+		int32_t ExpUlp{ 0 };
+	};
+
 	class MathHelper {
 	public:
 		static constexpr float Epsilon = std::numeric_limits<float>::epsilon();
@@ -37,6 +49,48 @@ namespace Xna {
 		static bool IsPowerOfTwo(int32_t value);
 		static float IsPositiveInfinity(float value);				
 		static int32_t Sign(float value);
+
+		// Polynomial approximations evaluated with the same operations by the scalar and batch forms; the batch forms
+		// run 4 (SSE2) or 8 (AVX2) lanes at a time. Maximum errors below were measured by MaxError():
+		// SinCos: 14 ULP for |angle| <= 2Pi, reached next to the zeros where the result is tiny; the absolute error is
+		// below 1e-7 there and below 1e-6 for |angle| <= 65536.
+		// Acos: 1 ULP over [-1, 1]; NaN outside.
+		// Atan2: 3 ULP; Atan2(0, 0) is 0.
+		// ReciprocalSqrt: 4 ULP with SSE (hardware estimate plus one Newton step); without SSE a bit-level guess gets
+		// three Newton steps. 0 gives infinity.
+		// Exp: 1 ULP over [-87.3, 88.7]; below that range the result is 0, above it infinity.
+		// Outside those ranges: SinCos calls std::sin and std::cos for |angle| > 65536, infinities and NaN.
+		// NaN in gives NaN out for all five. Atan2 of two infinities gives the odd multiple of Pi/4 of their quadrant,
+		// ReciprocalSqrt(infinity) is 0 and Exp(-infinity) is 0.
+		static void SinCos(float angle, float& sin, float& cos);
+		static float Acos(float value);
+		static float Atan2(float y, float x);
+		static float ReciprocalSqrt(float value);
+		static float Exp(float value);
+
+		static void SinCos(std::vector<float> const& angles, size_t sourceIndex,
+			std::vector<float>& sines, std::vector<float>& cosines, size_t destinationIndex, size_t length);
+		static void SinCos(std::vector<float> const& angles, std::vector<float>& sines, std::vector<float>& cosines);
+		static void Acos(std::vector<float> const& sourceArray, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length);
+		static void Acos(std::vector<float> const& sourceArray, std::vector<float>& destinationArray);
+		static void Atan2(std::vector<float> const& y, std::vector<float> const& x, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length);
+		static void Atan2(std::vector<float> const& y, std::vector<float> const& x, std::vector<float>& destinationArray);
+		static void ReciprocalSqrt(std::vector<float> const& sourceArray, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length);
+		static void ReciprocalSqrt(std::vector<float> const& sourceArray, std::vector<float>& destinationArray);
+		static void Exp(std::vector<float> const& sourceArray, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length);
+		static void Exp(std::vector<float> const& sourceArray, std::vector<float>& destinationArray);
+
+		// When set, WrapAngle and the rotation factories of Matrix and Quaternion (CreateRotationX/Y/Z, CreateFromAxisAngle,
+		// CreateFromYawPitchRoll, CreatePerspectiveFieldOfView and Slerp) use the approximations above instead of libm.
+		// Off by default.
+		static bool UseFastMath();
+		static void UseFastMath(bool value);
+
+		static FastMathErrorReport MaxError(size_t samples = 65536);
 	};
 }
 
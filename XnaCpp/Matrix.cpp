@@ -1,17 +1,217 @@
 #include "Matrix.hpp"
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include "MathHelper.hpp"
 #include "Quaternion.hpp"
+#include "QuaternionSoA.hpp"
 #include "Vector4.hpp"
 #include "Vector3.hpp"
 #include "CSharp/Nullable.hpp"
 #include "Rectangle.hpp"
+#include "Parallel.hpp"
 #include "Plane.hpp"
+#include "Profiler.hpp"
+#include "Simd.hpp"
+#include "SimdDispatch.hpp"
+#include "SimdKernels.hpp"
+#include "SimdLanes.hpp"
 
 using CSharp::Nullable;
 using std::numeric_limits;
 
+//Private
+namespace Xna {
+	namespace {
+		// Routes through the MathHelper approximations when MathHelper::UseFastMath() is set. Otherwise this is the
+		// double precision sin and cos the rotation factories have always called, so their results are unchanged.
+		void sinCos(double angle, double& sine, double& cosine) {
+			if (MathHelper::UseFastMath()) {
+				float fastSine;
+				float fastCosine;
+				MathHelper::SinCos(static_cast<float>(angle), fastSine, fastCosine);
+				sine = fastSine;
+				cosine = fastCosine;
+				return;
+			}
+
+			sine = std::sin(angle);
+			cosine = std::cos(angle);
+		}
+
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+
+		// Runs body(begin, end) over chunks of [0, length), spread over threadCount threads.
+		template <typename TBody>
+		void forChunks(size_t length, size_t threadCount, TBody const& body) {
+			constexpr size_t chunkSize = 1024;
+			auto chunks = (length + chunkSize - 1) / chunkSize;
+
+			if (threadCount == 1 || chunks <= 1) {
+				body(size_t(0), length);
+				return;
+			}
+
+			Parallel::For(0, chunks, threadCount, [&](size_t chunk) {
+				auto begin = chunk * chunkSize;
+				body(begin, std::min(length, begin + chunkSize));
+				});
+		}
+
+		// Writes the first rowCount rows of the transpose, 4 floats each.
+		void transpose(Matrix const& matrix, float* destination, size_t rowCount) {
+#if XNA_SSE2
+			auto source = &matrix.M11;
+			auto row1 = _mm_load_ps(source);
+			auto row2 = _mm_load_ps(source + 4);
+			auto row3 = _mm_load_ps(source + 8);
+			auto row4 = _mm_load_ps(source + 12);
+			_MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+
+			_mm_storeu_ps(destination, row1);
+			_mm_storeu_ps(destination + 4, row2);
+			_mm_storeu_ps(destination + 8, row3);
+
+			if (rowCount == 4)
+				_mm_storeu_ps(destination + 12, row4);
+#else
+			auto source = &matrix.M11;
+			float values[16];
+
+			for (size_t row = 0; row < 4; ++row)
+				for (size_t column = 0; column < 4; ++column)
+					values[column * 4 + row] = source[row * 4 + column];
+
+			for (size_t i = 0; i < rowCount * 4; ++i)
+				destination[i] = values[i];
+#endif
+		}
+
+		template <typename TLanes>
+		typename TLanes::Float dot(typename TLanes::Float ax, typename TLanes::Float ay, typename TLanes::Float az,
+			typename TLanes::Float bx, typename TLanes::Float by, typename TLanes::Float bz) {
+			return TLanes::Add(TLanes::Add(TLanes::Mul(ax, bx), TLanes::Mul(ay, by)), TLanes::Mul(az, bz));
+		}
+
+		// Gram-Schmidt on the rows of the upper 3x3 part m (row-major), giving Scale * Shear * Rotation with the shear
+		// lower unitriangular. A reflection is folded into scale X so the rotation stays proper. Lanes whose rows are
+		// dependent get the plain row lengths as scale, no shear and an identity rotation; the returned mask marks
+		// the others.
+		template <typename TLanes>
+		typename TLanes::Float decompose(typename TLanes::Float const (&m)[9], typename TLanes::Float(&scale)[3],
+			typename TLanes::Float(&shear)[3], typename TLanes::Float(&rotation)[4]) {
+			using L = TLanes;
+
+			auto zero = L::Set(0.0F);
+			auto one = L::Set(1.0F);
+			auto half = L::Set(0.5F);
+
+			auto sx = L::Sqrt(dot<L>(m[0], m[1], m[2], m[0], m[1], m[2]));
+			auto inverse = L::Div(one, sx);
+			auto x0 = L::Mul(m[0], inverse);
+			auto y0 = L::Mul(m[1], inverse);
+			auto z0 = L::Mul(m[2], inverse);
+
+			auto xy = dot<L>(x0, y0, z0, m[3], m[4], m[5]);
+			auto x1 = L::Sub(m[3], L::Mul(xy, x0));
+			auto y1 = L::Sub(m[4], L::Mul(xy, y0));
+			auto z1 = L::Sub(m[5], L::Mul(xy, z0));
+			auto sy = L::Sqrt(dot<L>(x1, y1, z1, x1, y1, z1));
+			inverse = L::Div(one, sy);
+			x1 = L::Mul(x1, inverse);
+			y1 = L::Mul(y1, inverse);
+			z1 = L::Mul(z1, inverse);
+			xy = L::Mul(xy, inverse);
+
+			auto xz = dot<L>(x0, y0, z0, m[6], m[7], m[8]);
+			auto x2 = L::Sub(m[6], L::Mul(xz, x0));
+			auto y2 = L::Sub(m[7], L::Mul(xz, y0));
+			auto z2 = L::Sub(m[8], L::Mul(xz, z0));
+			auto yz = dot<L>(x1, y1, z1, x2, y2, z2);
+			x2 = L::Sub(x2, L::Mul(yz, x1));
+			y2 = L::Sub(y2, L::Mul(yz, y1));
+			z2 = L::Sub(z2, L::Mul(yz, z1));
+			auto sz = L::Sqrt(dot<L>(x2, y2, z2, x2, y2, z2));
+			inverse = L::Div(one, sz);
+			x2 = L::Mul(x2, inverse);
+			y2 = L::Mul(y2, inverse);
+			z2 = L::Mul(z2, inverse);
+			xz = L::Mul(xz, inverse);
+			yz = L::Mul(yz, inverse);
+
+			auto valid = L::And(L::And(L::Greater(sx, zero), L::Greater(sy, zero)), L::Greater(sz, zero));
+
+			// Negating the first row also negates the shears measured against it.
+			auto determinant = dot<L>(x0, y0, z0,
+				L::Sub(L::Mul(y1, z2), L::Mul(z1, y2)), L::Sub(L::Mul(z1, x2), L::Mul(x1, z2)), L::Sub(L::Mul(x1, y2), L::Mul(y1, x2)));
+			auto flip = L::And(L::Less(determinant, zero), L::Set(-0.0F));
+			sx = L::Xor(sx, flip);
+			x0 = L::Xor(x0, flip);
+			y0 = L::Xor(y0, flip);
+			z0 = L::Xor(z0, flip);
+			xy = L::Xor(xy, flip);
+			xz = L::Xor(xz, flip);
+
+			// Quaternion::CreateFromRotationMatrix with its branches turned into selects.
+			auto trace = L::Add(L::Add(x0, y1), z2);
+			auto useW = L::Greater(trace, zero);
+			auto notX = L::Select(L::Less(x0, y1), L::Equal(zero, zero), L::Less(x0, z2));
+			auto useY = L::Greater(y1, z2);
+			auto tx = L::Sub(L::Sub(L::Add(one, x0), y1), z2);
+			auto ty = L::Sub(L::Sub(L::Add(one, y1), x0), z2);
+			auto tz = L::Sub(L::Sub(L::Add(one, z2), x0), y1);
+			auto root = L::Sqrt(L::Select(useW, L::Add(trace, one), L::Select(notX, L::Select(useY, ty, tz), tx)));
+			auto major = L::Mul(half, root);
+			auto factor = L::Div(half, root);
+
+			auto d23 = L::Mul(L::Sub(z1, y2), factor);
+			auto d31 = L::Mul(L::Sub(x2, z0), factor);
+			auto d12 = L::Mul(L::Sub(y0, x1), factor);
+			auto s12 = L::Mul(L::Add(y0, x1), factor);
+			auto s13 = L::Mul(L::Add(z0, x2), factor);
+			auto s23 = L::Mul(L::Add(z1, y2), factor);
+
+			auto rx = L::Select(useW, d23, L::Select(notX, L::Select(useY, s12, s13), major));
+			auto ry = L::Select(useW, d31, L::Select(notX, L::Select(useY, major, s23), s12));
+			auto rz = L::Select(useW, d12, L::Select(notX, L::Select(useY, s23, major), s13));
+			auto rw = L::Select(useW, major, L::Select(notX, L::Select(useY, d31, d12), d23));
+
+			scale[0] = L::Select(valid, sx, L::Sqrt(dot<L>(m[0], m[1], m[2], m[0], m[1], m[2])));
+			scale[1] = L::Select(valid, sy, L::Sqrt(dot<L>(m[3], m[4], m[5], m[3], m[4], m[5])));
+			scale[2] = L::Select(valid, sz, L::Sqrt(dot<L>(m[6], m[7], m[8], m[6], m[7], m[8])));
+			shear[0] = L::Select(valid, xy, zero);
+			shear[1] = L::Select(valid, xz, zero);
+			shear[2] = L::Select(valid, yz, zero);
+			rotation[0] = L::Select(valid, rx, zero);
+			rotation[1] = L::Select(valid, ry, zero);
+			rotation[2] = L::Select(valid, rz, zero);
+			rotation[3] = L::Select(valid, rw, one);
+
+			return valid;
+		}
+
+		bool singular(float determinant) {
+			return determinant == 0 || !std::isfinite(determinant);
+		}
+
+		// The reciprocal of a subnormal determinant overflows. Scaling the matrix by 2^32 scales its determinant by
+		// 2^128 and its inverse by 2^-32, both exactly, so such matrices are inverted scaled and the scale undone.
+		void invertSubnormal(Matrix const& matrix, Matrix& result) {
+			constexpr float scale = 4294967296.0F;
+			invert(matrix * scale, result);
+			result = result * scale;
+		}
+
+		void setNaN(Matrix& matrix) {
+			auto nan = numeric_limits<float>::quiet_NaN();
+			matrix = Matrix(nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan);
+		}
+	}
+}
+
 //Constructors
 namespace Xna {
 
@@ -219,8 +419,9 @@ namespace Xna {
 		auto x = axis.X;
 		auto y = axis.Y;
 		auto z = axis.Z;
-		auto num2 = sin(angle);
-		auto num = cos(angle);
+		double num2;
+		double num;
+		sinCos(angle, num2, num);
 		auto num11 = x * x;
 		auto num10 = y * y;
 		auto num9 = z * z;
@@ -373,7 +574,18 @@ namespace Xna {
 
 		//TODO: Conferir excees
 
-		auto yScale = 1.0f / tan(fieldOfView * 0.5f);
+		double yScale;
+
+		if (MathHelper::UseFastMath()) {
+			float sine;
+			float cosine;
+			MathHelper::SinCos(fieldOfView * 0.5f, sine, cosine);
+			yScale = cosine / sine;
+		}
+		else {
+			yScale = 1.0f / tan(fieldOfView * 0.5f);
+		}
+
 		auto xScale = yScale / aspectRatio;
 		auto negFarRange = MathHelper::IsPositiveInfinity(farPlaneDistance) ? -1.0f : farPlaneDistance / (nearPlaneDistance - farPlaneDistance);
 
@@ -423,8 +635,9 @@ namespace Xna {
 	Matrix Matrix::CreateRotationX(float radians) {
 		Matrix result = Matrix::Identity;
 
-		auto val1 = cos(radians);
-		auto val2 = sin(radians);
+		double val1;
+		double val2;
+		sinCos(radians, val2, val1);
 
 		result.M22 = val1;
 		result.M23 = val2;
@@ -437,8 +650,9 @@ namespace Xna {
 	Matrix Matrix::CreateRotationY(float radians) {
 		Matrix result = Matrix::Identity;
 
-		auto val1 = cos(radians);
-		auto val2 = sin(radians);
+		double val1;
+		double val2;
+		sinCos(radians, val2, val1);
 
 		result.M11 = val1;
 		result.M13 = -val2;
@@ -451,8 +665,9 @@ namespace Xna {
 	Matrix Matrix::CreateRotationZ(float radians) {
 		Matrix result = Matrix::Identity;
 
-		auto val1 = cos(radians);
-		auto val2 = sin(radians);
+		double val1;
+		double val2;
+		sinCos(radians, val2, val1);
 
 		result.M11 = val1;
 		result.M12 = val2;
@@ -539,6 +754,75 @@ namespace Xna {
 		return result;
 	}
 
+	size_t Matrix::Decompose(std::vector<Matrix> const& sourceArray, size_t sourceIndex, std::vector<Vector3>& scales,
+		QuaternionSoA& rotations, std::vector<Vector3>& translations, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Matrix::Decompose");
+
+		auto destinationSize = std::min(std::min(scales.size(), translations.size()), rotations.Size());
+
+		if (!validRange(sourceArray.size(), sourceIndex, destinationSize, destinationIndex, length))
+			return 0;
+
+		using Lanes = Simd::BatchLanes;
+		constexpr auto width = Lanes::Width;
+		size_t failed = 0;
+
+		for (size_t i = 0; i < length; i += width) {
+			auto count = std::min(width, length - i);
+			float gathered[9][width] = {};
+
+			// Transposed into one register per element; a partial tail leaves zero rows, which are never stored.
+			for (size_t j = 0; j < count; ++j) {
+				auto const& matrix = sourceArray[sourceIndex + i + j];
+				float const m[9] = { matrix.M11, matrix.M12, matrix.M13, matrix.M21, matrix.M22, matrix.M23, matrix.M31, matrix.M32, matrix.M33 };
+
+				for (size_t k = 0; k < 9; ++k)
+					gathered[k][j] = m[k];
+
+				translations[destinationIndex + i + j] = Vector3(matrix.M41, matrix.M42, matrix.M43);
+			}
+
+			Lanes::Float m[9];
+			for (size_t k = 0; k < 9; ++k)
+				m[k] = Lanes::Load(gathered[k]);
+
+			Lanes::Float scale[3];
+			Lanes::Float shear[3];
+			Lanes::Float rotation[4];
+			auto valid = decompose<Lanes>(m, scale, shear, rotation);
+
+			float values[8][width];
+			for (size_t k = 0; k < 3; ++k)
+				Lanes::Store(values[k], scale[k]);
+			for (size_t k = 0; k < 4; ++k)
+				Lanes::Store(values[3 + k], rotation[k]);
+			Lanes::Store(values[7], valid);
+
+			for (size_t j = 0; j < count; ++j) {
+				auto index = destinationIndex + i + j;
+				scales[index] = Vector3(values[0][j], values[1][j], values[2][j]);
+				rotations.X[index] = values[3][j];
+				rotations.Y[index] = values[4][j];
+				rotations.Z[index] = values[5][j];
+				rotations.W[index] = values[6][j];
+
+				if (Simd::ScalarLanes::Bits(values[7][j]) == 0)
+					++failed;
+			}
+		}
+
+		return failed;
+	}
+
+	size_t Matrix::Decompose(std::vector<Matrix> const& sourceArray, std::vector<Vector3>& scales, QuaternionSoA& rotations,
+		std::vector<Vector3>& translations) {
+		scales.resize(sourceArray.size());
+		rotations.Resize(sourceArray.size());
+		translations.resize(sourceArray.size());
+
+		return Decompose(sourceArray, 0, scales, rotations, translations, 0, sourceArray.size());
+	}
+
 	Matrix Matrix::Divide(Matrix const& matrix1, Matrix const& matrix2) {
 		Matrix result;
 
@@ -587,69 +871,111 @@ namespace Xna {
 	}
 
 	Matrix Matrix::Invert(Matrix const& matrix) {
+		Matrix result;
+		invert(matrix, result);
+		return result;
+	}
+
+	bool Matrix::Invert(Matrix const& matrix, Matrix& result) {
+		auto determinant = invert(matrix, result);
 
-		//TODO: observar converso para double
-
-		auto num1 = matrix.M11;
-		auto num2 = matrix.M12;
-		auto num3 = matrix.M13;
-		auto num4 = matrix.M14;
-		auto num5 = matrix.M21;
-		auto num6 = matrix.M22;
-		auto num7 = matrix.M23;
-		auto num8 = matrix.M24;
-		auto num9 = matrix.M31;
-		auto num10 = matrix.M32;
-		auto num11 = matrix.M33;
-		auto num12 = matrix.M34;
-		auto num13 = matrix.M41;
-		auto num14 = matrix.M42;
-		auto num15 = matrix.M43;
-		auto num16 = matrix.M44;
-
-		auto num17 = (num11 * num16 - num12 * num15);
-		auto num18 = (num10 * num16 - num12 * num14);
-		auto num19 = (num10 * num15 - num11 * num14);
-		auto num20 = (num9 * num16 - num12 * num13);
-		auto num21 = (num9 * num15 - num11 * num13);
-		auto num22 = (num9 * num14 - num10 * num13);
-		auto num23 = (num6 * num17 - num7 * num18 + num8 * num19);
-		auto num24 = -(num5 * num17 - num7 * num20 + num8 * num21);
-		auto num25 = (num5 * num18 - num6 * num20 + num8 * num22);
-		auto num26 = -(num5 * num19 - num6 * num21 + num7 * num22);
-		auto num27 = (1.0F / (num1 * num23 + num2 * num24 + num3 * num25 + num4 * num26));
+		if (singular(determinant)) {
+			setNaN(result);
+			return false;
+		}
+
+		if (std::fpclassify(determinant) == FP_SUBNORMAL)
+			invertSubnormal(matrix, result);
+
+		return true;
+	}
+
+	size_t Matrix::Invert(std::vector<Matrix> const& sourceArray, size_t sourceIndex, std::vector<Matrix>& destinationArray,
+		size_t destinationIndex, size_t length, std::vector<bool>& singularFlags) {
+		XNA_PROFILE_ZONE("Matrix::Invert");
+
+		// Cleared first so that an invalid range leaves no flags from an earlier call behind.
+		singularFlags.clear();
+
+		if (sourceIndex > sourceArray.size() || length > sourceArray.size() - sourceIndex
+			|| destinationIndex > destinationArray.size() || length > destinationArray.size() - destinationIndex)
+			return 0;
+
+		singularFlags.assign(length, false);
+		auto const& kernels = Simd::Dispatch::Active();
+		size_t count = 0;
+
+		for (size_t begin = 0; begin < length; begin += 256) {
+			auto blockLength = std::min(length - begin, size_t(256));
+			float determinants[256];
+			kernels.InvertMatrices(sourceArray.data() + sourceIndex + begin, destinationArray.data() + destinationIndex + begin,
+				determinants, blockLength);
+
+			for (size_t i = 0; i < blockLength; ++i) {
+				if (singular(determinants[i])) {
+					setNaN(destinationArray[destinationIndex + begin + i]);
+					singularFlags[begin + i] = true;
+					++count;
+				}
+				else if (std::fpclassify(determinants[i]) == FP_SUBNORMAL) {
+					invertSubnormal(sourceArray[sourceIndex + begin + i], destinationArray[destinationIndex + begin + i]);
+				}
+			}
+		}
+
+		return count;
+	}
+
+	size_t Matrix::Invert(std::vector<Matrix> const& sourceArray, std::vector<Matrix>& destinationArray, std::vector<bool>& singularFlags) {
+		return Invert(sourceArray, 0, destinationArray, 0, destinationArray.size(), singularFlags);
+	}
+
+	Matrix Matrix::InvertAffine(Matrix const& matrix) {
+		// Columns of the inverse 3x3 block are cross products of its rows.
+		auto c11 = matrix.M22 * matrix.M33 - matrix.M23 * matrix.M32;
+		auto c12 = matrix.M23 * matrix.M31 - matrix.M21 * matrix.M33;
+		auto c13 = matrix.M21 * matrix.M32 - matrix.M22 * matrix.M31;
+		auto c21 = matrix.M32 * matrix.M13 - matrix.M33 * matrix.M12;
+		auto c22 = matrix.M33 * matrix.M11 - matrix.M31 * matrix.M13;
+		auto c23 = matrix.M31 * matrix.M12 - matrix.M32 * matrix.M11;
+		auto c31 = matrix.M12 * matrix.M23 - matrix.M13 * matrix.M22;
+		auto c32 = matrix.M13 * matrix.M21 - matrix.M11 * matrix.M23;
+		auto c33 = matrix.M11 * matrix.M22 - matrix.M12 * matrix.M21;
+		auto inverse = 1.0F / (matrix.M11 * c11 + matrix.M12 * c12 + matrix.M13 * c13);
 
 		Matrix result;
-		result.M11 = num23 * num27;
-		result.M21 = num24 * num27;
-		result.M31 = num25 * num27;
-		result.M41 = num26 * num27;
-		result.M12 = -(num2 * num17 - num3 * num18 + num4 * num19) * num27;
-		result.M22 = (num1 * num17 - num3 * num20 + num4 * num21) * num27;
-		result.M32 = -(num1 * num18 - num2 * num20 + num4 * num22) * num27;
-		result.M42 = (num1 * num19 - num2 * num21 + num3 * num22) * num27;
-
-		auto num28 = (num7 * num16 - num8 * num15);
-		auto num29 = (num6 * num16 - num8 * num14);
-		auto num30 = (num6 * num15 - num7 * num14);
-		auto num31 = (num5 * num16 - num8 * num13);
-		auto num32 = (num5 * num15 - num7 * num13);
-		auto num33 = (num5 * num14 - num6 * num13);
-		result.M13 = (num2 * num28 - num3 * num29 + num4 * num30) * num27;
-		result.M23 = -(num1 * num28 - num3 * num31 + num4 * num32) * num27;
-		result.M33 = (num1 * num29 - num2 * num31 + num4 * num33) * num27;
-		result.M43 = -(num1 * num30 - num2 * num32 + num3 * num33) * num27;
-
-		auto num34 = (num7 * num12 - num8 * num11);
-		auto num35 = (num6 * num12 - num8 * num10);
-		auto num36 = (num6 * num11 - num7 * num10);
-		auto num37 = (num5 * num12 - num8 * num9);
-		auto num38 = (num5 * num11 - num7 * num9);
-		auto num39 = (num5 * num10 - num6 * num9);
-		result.M14 = -(num2 * num34 - num3 * num35 + num4 * num36) * num27;
-		result.M24 = (num1 * num34 - num3 * num37 + num4 * num38) * num27;
-		result.M34 = -(num1 * num35 - num2 * num37 + num4 * num39) * num27;
-		result.M44 = (num1 * num36 - num2 * num38 + num3 * num39) * num27;
+		result.M11 = c11 * inverse;
+		result.M12 = c21 * inverse;
+		result.M13 = c31 * inverse;
+		result.M21 = c12 * inverse;
+		result.M22 = c22 * inverse;
+		result.M23 = c32 * inverse;
+		result.M31 = c13 * inverse;
+		result.M32 = c23 * inverse;
+		result.M33 = c33 * inverse;
+		result.M41 = -(matrix.M41 * result.M11 + matrix.M42 * result.M21 + matrix.M43 * result.M31);
+		result.M42 = -(matrix.M41 * result.M12 + matrix.M42 * result.M22 + matrix.M43 * result.M32);
+		result.M43 = -(matrix.M41 * result.M13 + matrix.M42 * result.M23 + matrix.M43 * result.M33);
+		result.M44 = 1;
+
+		return result;
+	}
+
+	Matrix Matrix::InvertOrthonormal(Matrix const& matrix) {
+		Matrix result;
+		result.M11 = matrix.M11;
+		result.M12 = matrix.M21;
+		result.M13 = matrix.M31;
+		result.M21 = matrix.M12;
+		result.M22 = matrix.M22;
+		result.M23 = matrix.M32;
+		result.M31 = matrix.M13;
+		result.M32 = matrix.M23;
+		result.M33 = matrix.M33;
+		result.M41 = -(matrix.M41 * matrix.M11 + matrix.M42 * matrix.M12 + matrix.M43 * matrix.M13);
+		result.M42 = -(matrix.M41 * matrix.M21 + matrix.M42 * matrix.M22 + matrix.M43 * matrix.M23);
+		result.M43 = -(matrix.M41 * matrix.M31 + matrix.M42 * matrix.M32 + matrix.M43 * matrix.M33);
+		result.M44 = 1;
 
 		return result;
 	}
@@ -716,6 +1042,77 @@ namespace Xna {
 		return result;
 	}
 
+	void Matrix::Multiply(std::vector<Matrix> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
+		std::vector<Matrix>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount) {
+		XNA_PROFILE_ZONE("Matrix::Multiply");
+
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		auto source = sourceArray.data() + sourceIndex;
+		auto destination = destinationArray.data() + destinationIndex;
+
+		auto const& kernels = Simd::Dispatch::Active();
+
+		forChunks(length, threadCount, [&](size_t begin, size_t end) {
+			kernels.MultiplyMatrix(source + begin, matrix, destination + begin, end - begin);
+			});
+	}
+
+	void Matrix::Multiply(std::vector<Matrix> const& sourceArray, Matrix const& matrix, std::vector<Matrix>& destinationArray, size_t threadCount) {
+		Multiply(sourceArray, 0, matrix, destinationArray, 0, destinationArray.size(), threadCount);
+	}
+
+	void Matrix::Multiply(std::vector<Matrix> const& sourceArray1, std::vector<Matrix> const& sourceArray2, size_t sourceIndex,
+		std::vector<Matrix>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount) {
+		XNA_PROFILE_ZONE("Matrix::Multiply");
+
+		if (!validRange(std::min(sourceArray1.size(), sourceArray2.size()), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		auto source1 = sourceArray1.data() + sourceIndex;
+		auto source2 = sourceArray2.data() + sourceIndex;
+		auto destination = destinationArray.data() + destinationIndex;
+
+		auto const& kernels = Simd::Dispatch::Active();
+
+		forChunks(length, threadCount, [&](size_t begin, size_t end) {
+			kernels.MultiplyMatrices(source1 + begin, source2 + begin, destination + begin, end - begin);
+			});
+	}
+
+	void Matrix::Multiply(std::vector<Matrix> const& sourceArray1, std::vector<Matrix> const& sourceArray2,
+		std::vector<Matrix>& destinationArray, size_t threadCount) {
+		Multiply(sourceArray1, sourceArray2, 0, destinationArray, 0, destinationArray.size(), threadCount);
+	}
+
+	bool Matrix::Concatenate(std::vector<Matrix> const& localArray, std::vector<int32_t> const& parentIndices,
+		std::vector<Matrix>& destinationArray) {
+		XNA_PROFILE_ZONE("Matrix::Concatenate");
+
+		auto length = localArray.size();
+
+		if (parentIndices.size() < length || destinationArray.size() < length)
+			return false;
+
+		for (size_t i = 0; i < length; ++i) {
+			if (parentIndices[i] >= 0 && static_cast<size_t>(parentIndices[i]) >= i)
+				return false;
+		}
+
+		// Each parent is final before its children read it, so this stays sequential.
+		for (size_t i = 0; i < length; ++i) {
+			auto parent = parentIndices[i];
+
+			if (parent < 0)
+				destinationArray[i] = localArray[i];
+			else
+				multiply(localArray[i], destinationArray[parent], destinationArray[i]);
+		}
+
+		return true;
+	}
+
 	Matrix Matrix::Multiply(Matrix const& matrix1, float scaleFactor) {
 		Matrix result;
 
@@ -810,6 +1207,47 @@ namespace Xna {
 		return result;
 	}
 
+	void Matrix::Transpose(std::vector<Matrix> const& sourceArray, size_t sourceIndex,
+		std::vector<Matrix>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount) {
+		XNA_PROFILE_ZONE("Matrix::Transpose");
+
+		if (!validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		auto source = sourceArray.data() + sourceIndex;
+		auto destination = destinationArray.data() + destinationIndex;
+
+		forChunks(length, threadCount, [&](size_t begin, size_t end) {
+			for (auto i = begin; i < end; ++i)
+				transpose(source[i], &destination[i].M11, 4);
+			});
+	}
+
+	void Matrix::Transpose(std::vector<Matrix> const& sourceArray, std::vector<Matrix>& destinationArray, size_t threadCount) {
+		Transpose(sourceArray, 0, destinationArray, 0, destinationArray.size(), threadCount);
+	}
+
+	void Matrix::TransposePack3x4(std::vector<Matrix> const& sourceArray, size_t sourceIndex,
+		std::vector<float>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount) {
+		XNA_PROFILE_ZONE("Matrix::TransposePack3x4");
+
+		if (destinationIndex > destinationArray.size()
+			|| !validRange(sourceArray.size(), sourceIndex, (destinationArray.size() - destinationIndex) / 12, 0, length))
+			return;
+
+		auto source = sourceArray.data() + sourceIndex;
+		auto destination = destinationArray.data() + destinationIndex;
+
+		forChunks(length, threadCount, [&](size_t begin, size_t end) {
+			for (auto i = begin; i < end; ++i)
+				transpose(source[i], destination + i * 12, 3);
+			});
+	}
+
+	void Matrix::TransposePack3x4(std::vector<Matrix> const& sourceArray, std::vector<float>& destinationArray, size_t threadCount) {
+		TransposePack3x4(sourceArray, 0, destinationArray, 0, destinationArray.size() / 12, threadCount);
+	}
+
 	void Matrix::FindDeterminants(Matrix const& matrix, float& major,
 		float& minor1, float& minor2, float& minor3, float& minor4, float& minor5, float& minor6,
 		float& minor7, float& minor8, float& minor9, float& minor10, float& minor11, float& minor12) {
@@ -1040,31 +1478,23 @@ namespace Xna {
 	}
 
 	bool Matrix::Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const {
-		translation.X = M41;
-		translation.Y = M42;
-		translation.Z = M43;
-
-		float xs = (MathHelper::Sign(M11 * M12 * M13 * M14) < 0) ? -1.F : 1.F;
-		float ys = (MathHelper::Sign(M21 * M22 * M23 * M24) < 0) ? -1.F : 1.F;
-		float zs = (MathHelper::Sign(M31 * M32 * M33 * M34) < 0) ? -1.F : 1.F;
-
-		scale.X = xs * sqrt(M11 * M11 + M12 * M12 + M13 * M13);
-		scale.Y = ys * sqrt(M21 * M21 + M22 * M22 + M23 * M23);
-		scale.Z = zs * sqrt(M31 * M31 + M32 * M32 + M33 * M33);
+		Vector3 shear;
+		return Decompose(scale, shear, rotation, translation);
+	}
 
-		if (scale.X == 0.0 || scale.Y == 0.0 || scale.Z == 0.0) {
-			rotation = Quaternion::Identity;
-			return false;
-		}
+	bool Matrix::Decompose(Vector3& scale, Vector3& shear, Quaternion& rotation, Vector3& translation) const {
+		float const m[9] = { M11, M12, M13, M21, M22, M23, M31, M32, M33 };
+		float scales[3];
+		float shears[3];
+		float components[4];
+		auto valid = decompose<Simd::ScalarLanes>(m, scales, shears, components);
 
-		Matrix m1 = Matrix(
-			M11 / scale.X, M12 / scale.X, M13 / scale.X, 0,
-			M21 / scale.Y, M22 / scale.Y, M23 / scale.Y, 0,
-			M31 / scale.Z, M32 / scale.Z, M33 / scale.Z, 0,
-			0, 0, 0, 1);
+		scale = Vector3(scales[0], scales[1], scales[2]);
+		shear = Vector3(shears[0], shears[1], shears[2]);
+		rotation = Quaternion(components[0], components[1], components[2], components[3]);
+		translation = Vector3(M41, M42, M43);
 
-		rotation = Quaternion::CreateFromRotationMatrix(m1);
-		return true;
+		return Simd::ScalarLanes::Bits(valid) != 0;
 	}
 
 	float Matrix::Determinant() const {
@@ -1,6 +1,7 @@
 #ifndef _MATRIX_HPP_
 #define _MATRIX_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include "CSharp/Nullable.hpp"
@@ -8,12 +9,14 @@
 namespace Xna {
 
 	struct Quaternion;
+	struct QuaternionSoA;
 	struct Rectangle;
 	struct Vector4;
 	struct Vector3;
 	struct Plane;
 
-	struct Matrix {
+	// 16-byte aligned so each row is one aligned SIMD load.
+	struct alignas(16) Matrix {
 		float M11{ 0 };
 		float M12{ 0 };
 		float M13{ 0 };
@@ -74,16 +77,56 @@ namespace Xna {
 		static Matrix CreateTranslation(float xPosition, float yPosition, float zPosition);
 		static Matrix CreateTranslation(Vector3 const& position);
 		static Matrix CreateWorld(Vector3 const& position, Vector3 const& forward, Vector3 const& up);
+		// Decompose over an array into separate scale, rotation and translation streams, on SIMD lanes.
+		// Returns the number of matrices that failed to decompose; the whole-array form resizes the destinations.
+		static size_t Decompose(std::vector<Matrix> const& sourceArray, size_t sourceIndex, std::vector<Vector3>& scales,
+			QuaternionSoA& rotations, std::vector<Vector3>& translations, size_t destinationIndex, size_t length);
+		static size_t Decompose(std::vector<Matrix> const& sourceArray, std::vector<Vector3>& scales, QuaternionSoA& rotations,
+			std::vector<Vector3>& translations);
 		static Matrix Divide(Matrix const& matrix1, Matrix const& matrix2);
 		static Matrix Divide(Matrix const& matrix1, float divider);
 		static Matrix Invert(Matrix const& matrix);
+		// Returns false and sets result to NaN when the determinant is zero or not finite.
+		static bool Invert(Matrix const& matrix, Matrix& result);
+		// Inverts length matrices; singularFlags receives one flag per element and the singular count is returned.
+		// An invalid range inverts nothing, returns 0 and leaves singularFlags empty.
+		static size_t Invert(std::vector<Matrix> const& sourceArray, size_t sourceIndex, std::vector<Matrix>& destinationArray,
+			size_t destinationIndex, size_t length, std::vector<bool>& singularFlags);
+		static size_t Invert(std::vector<Matrix> const& sourceArray, std::vector<Matrix>& destinationArray, std::vector<bool>& singularFlags);
+		// For matrices whose last column is (0, 0, 0, 1).
+		static Matrix InvertAffine(Matrix const& matrix);
+		// For rotation and translation only: transposes the rotation instead of inverting it.
+		static Matrix InvertOrthonormal(Matrix const& matrix);
 		static Matrix Lerp(Matrix const& matrix1, Matrix const& matrix2, float amount);
 		static Matrix Multiply(Matrix const& matrix1, Matrix const& matrix2);
 		static Matrix Multiply(Matrix const& matrix1, float scaleFactor);
+		// Batch forms split the work into chunks over threadCount threads (0 uses every processor) and give the same
+		// results as the single-matrix functions.
+		// destinationArray[i] = sourceArray[i] * matrix.
+		static void Multiply(std::vector<Matrix> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
+			std::vector<Matrix>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount = 1);
+		static void Multiply(std::vector<Matrix> const& sourceArray, Matrix const& matrix, std::vector<Matrix>& destinationArray, size_t threadCount = 1);
+		// destinationArray[i] = sourceArray1[i] * sourceArray2[i].
+		static void Multiply(std::vector<Matrix> const& sourceArray1, std::vector<Matrix> const& sourceArray2, size_t sourceIndex,
+			std::vector<Matrix>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount = 1);
+		static void Multiply(std::vector<Matrix> const& sourceArray1, std::vector<Matrix> const& sourceArray2,
+			std::vector<Matrix>& destinationArray, size_t threadCount = 1);
+		// destinationArray[i] = localArray[i] * destinationArray[parentIndices[i]], or localArray[i] for a negative parent.
+		// Parents must come before their children; otherwise nothing is written and false is returned.
+		static bool Concatenate(std::vector<Matrix> const& localArray, std::vector<int32_t> const& parentIndices,
+			std::vector<Matrix>& destinationArray);
 		static std::vector<float> ToFloatArray(Matrix const& matrix);
 		static Matrix Negate(Matrix const& matrix);
 		static Matrix Subtract(Matrix const& matrix1, Matrix const& matrix2);
 		static Matrix Transpose(Matrix const& matrix);
+		static void Transpose(std::vector<Matrix> const& sourceArray, size_t sourceIndex,
+			std::vector<Matrix>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount = 1);
+		static void Transpose(std::vector<Matrix> const& sourceArray, std::vector<Matrix>& destinationArray, size_t threadCount = 1);
+		// Writes the first three rows of each transposed matrix, 12 floats per matrix, as float3x4 constant
+		// buffers expect. destinationIndex counts floats; the whole-array form packs destinationArray.size() / 12 matrices.
+		static void TransposePack3x4(std::vector<Matrix> const& sourceArray, size_t sourceIndex,
+			std::vector<float>& destinationArray, size_t destinationIndex, size_t length, size_t threadCount = 1);
+		static void TransposePack3x4(std::vector<Matrix> const& sourceArray, std::vector<float>& destinationArray, size_t threadCount = 1);
 		static void FindDeterminants(Matrix const& matrix, float& major,
 			float& minor1, float& minor2, float& minor3, float& minor4, float& minor5, float& minor6,
 			float& minor7, float& minor8, float& minor9, float& minor10, float& minor11, float& minor12);
@@ -106,7 +149,12 @@ namespace Xna {
 		void Translation(Vector3 const& value);
 		Vector3 Up() const;
 		void Up(Vector3 const& value);
+		// Gram-Schmidt on the rows, so sheared and mirrored matrices decompose consistently: the upper 3x3 part equals
+		// CreateScale(scale) * H * CreateFromQuaternion(rotation), where H is lower unitriangular with H21 = shear.X,
+		// H31 = shear.Y and H32 = shear.Z. A reflection is carried by a negative scale.X.
+		// Returns false, with an identity rotation and the row lengths as scale, when the rows are linearly dependent.
 		bool Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const;
+		bool Decompose(Vector3& scale, Vector3& shear, Quaternion& rotation, Vector3& translation) const;
 		float Determinant() const;
 		bool Equals(Matrix const& other) const;
 	};
@@ -0,0 +1,211 @@
+#include <cmath>
+#include <limits>
+#include "Matrix3x2.hpp"
+#include "Matrix.hpp"
+#include "MathHelper.hpp"
+
+//Private
+namespace Xna {
+	namespace {
+		// Routes through the MathHelper approximations when MathHelper::UseFastMath() is set, as Matrix does.
+		void sinCos(float angle, float& sine, float& cosine) {
+			if (MathHelper::UseFastMath()) {
+				MathHelper::SinCos(angle, sine, cosine);
+				return;
+			}
+
+			sine = std::sin(angle);
+			cosine = std::cos(angle);
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	const Matrix3x2 Matrix3x2::Identity = Matrix3x2(1.f, 0.f, 0.f, 1.f, 0.f, 0.f);
+
+	Matrix3x2::Matrix3x2() {}
+
+	Matrix3x2::Matrix3x2(float m11, float m12, float m21, float m22, float m31, float m32) :
+		M11(m11), M12(m12), M21(m21), M22(m22), M31(m31), M32(m32) {}
+
+	Matrix3x2::Matrix3x2(Matrix const& matrix) :
+		M11(matrix.M11), M12(matrix.M12), M21(matrix.M21), M22(matrix.M22), M31(matrix.M41), M32(matrix.M42) {}
+}
+
+//Operators
+namespace Xna {
+	Matrix3x2 Matrix3x2::operator -() const {
+		return Matrix3x2(-M11, -M12, -M21, -M22, -M31, -M32);
+	}
+
+	Matrix3x2 operator +(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2) {
+		return Matrix3x2(
+			matrix1.M11 + matrix2.M11, matrix1.M12 + matrix2.M12,
+			matrix1.M21 + matrix2.M21, matrix1.M22 + matrix2.M22,
+			matrix1.M31 + matrix2.M31, matrix1.M32 + matrix2.M32);
+	}
+
+	Matrix3x2 operator -(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2) {
+		return Matrix3x2(
+			matrix1.M11 - matrix2.M11, matrix1.M12 - matrix2.M12,
+			matrix1.M21 - matrix2.M21, matrix1.M22 - matrix2.M22,
+			matrix1.M31 - matrix2.M31, matrix1.M32 - matrix2.M32);
+	}
+
+	Matrix3x2 operator *(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2) {
+		return Matrix3x2::Multiply(matrix1, matrix2);
+	}
+
+	Matrix3x2 operator *(Matrix3x2 const& matrix, float scaleFactor) {
+		return Matrix3x2(
+			matrix.M11 * scaleFactor, matrix.M12 * scaleFactor,
+			matrix.M21 * scaleFactor, matrix.M22 * scaleFactor,
+			matrix.M31 * scaleFactor, matrix.M32 * scaleFactor);
+	}
+
+	bool operator ==(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2) {
+		return matrix1.M11 == matrix2.M11 && matrix1.M12 == matrix2.M12
+			&& matrix1.M21 == matrix2.M21 && matrix1.M22 == matrix2.M22
+			&& matrix1.M31 == matrix2.M31 && matrix1.M32 == matrix2.M32;
+	}
+
+	bool operator !=(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2) {
+		return !(matrix1 == matrix2);
+	}
+}
+
+//Functions
+namespace Xna {
+	float Matrix3x2::Determinant() const {
+		return M11 * M22 - M21 * M12;
+	}
+
+	bool Matrix3x2::IsIdentity() const {
+		return *this == Identity;
+	}
+
+	Vector2 Matrix3x2::Translation() const {
+		return Vector2(M31, M32);
+	}
+
+	void Matrix3x2::Translation(Vector2 const& value) {
+		M31 = value.X;
+		M32 = value.Y;
+	}
+
+	Matrix Matrix3x2::ToMatrix() const {
+		return Matrix(
+			M11, M12, 0.f, 0.f,
+			M21, M22, 0.f, 0.f,
+			0.f, 0.f, 1.f, 0.f,
+			M31, M32, 0.f, 1.f);
+	}
+
+	bool Matrix3x2::Equals(Matrix3x2 const& other) const {
+		return *this == other;
+	}
+}
+
+//Static
+namespace Xna {
+	Matrix3x2 Matrix3x2::CreateRotation(float radians) {
+		float sine;
+		float cosine;
+		sinCos(radians, sine, cosine);
+
+		return Matrix3x2(cosine, sine, -sine, cosine, 0.f, 0.f);
+	}
+
+	Matrix3x2 Matrix3x2::CreateRotation(float radians, Vector2 const& centerPoint) {
+		auto result = CreateRotation(radians);
+		result.M31 = centerPoint.X * (1.f - result.M11) + centerPoint.Y * result.M12;
+		result.M32 = centerPoint.Y * (1.f - result.M11) - centerPoint.X * result.M12;
+
+		return result;
+	}
+
+	Matrix3x2 Matrix3x2::CreateScale(float scale) {
+		return CreateScale(scale, scale);
+	}
+
+	Matrix3x2 Matrix3x2::CreateScale(float xScale, float yScale) {
+		return Matrix3x2(xScale, 0.f, 0.f, yScale, 0.f, 0.f);
+	}
+
+	Matrix3x2 Matrix3x2::CreateScale(Vector2 const& scales) {
+		return CreateScale(scales.X, scales.Y);
+	}
+
+	Matrix3x2 Matrix3x2::CreateScale(Vector2 const& scales, Vector2 const& centerPoint) {
+		return Matrix3x2(scales.X, 0.f, 0.f, scales.Y, centerPoint.X * (1.f - scales.X), centerPoint.Y * (1.f - scales.Y));
+	}
+
+	Matrix3x2 Matrix3x2::CreateSkew(float radiansX, float radiansY) {
+		return Matrix3x2(1.f, std::tan(radiansY), std::tan(radiansX), 1.f, 0.f, 0.f);
+	}
+
+	Matrix3x2 Matrix3x2::CreateSkew(float radiansX, float radiansY, Vector2 const& centerPoint) {
+		auto result = CreateSkew(radiansX, radiansY);
+		result.M31 = -centerPoint.Y * result.M21;
+		result.M32 = -centerPoint.X * result.M12;
+
+		return result;
+	}
+
+	Matrix3x2 Matrix3x2::CreateTranslation(float xPosition, float yPosition) {
+		return Matrix3x2(1.f, 0.f, 0.f, 1.f, xPosition, yPosition);
+	}
+
+	Matrix3x2 Matrix3x2::CreateTranslation(Vector2 const& position) {
+		return CreateTranslation(position.X, position.Y);
+	}
+
+	Matrix3x2 Matrix3x2::Invert(Matrix3x2 const& matrix) {
+		Matrix3x2 result;
+		Invert(matrix, result);
+		return result;
+	}
+
+	bool Matrix3x2::Invert(Matrix3x2 const& matrix, Matrix3x2& result) {
+		auto determinant = matrix.Determinant();
+
+		if (!std::isnormal(determinant)) {
+			auto nan = std::numeric_limits<float>::quiet_NaN();
+			result = Matrix3x2(nan, nan, nan, nan, nan, nan);
+			return false;
+		}
+
+		auto inverse = 1.f / determinant;
+
+		result = Matrix3x2(
+			matrix.M22 * inverse,
+			-matrix.M12 * inverse,
+			-matrix.M21 * inverse,
+			matrix.M11 * inverse,
+			(matrix.M21 * matrix.M32 - matrix.M31 * matrix.M22) * inverse,
+			(matrix.M31 * matrix.M12 - matrix.M11 * matrix.M32) * inverse);
+
+		return true;
+	}
+
+	Matrix3x2 Matrix3x2::Lerp(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2, float amount) {
+		return Matrix3x2(
+			matrix1.M11 + ((matrix2.M11 - matrix1.M11) * amount),
+			matrix1.M12 + ((matrix2.M12 - matrix1.M12) * amount),
+			matrix1.M21 + ((matrix2.M21 - matrix1.M21) * amount),
+			matrix1.M22 + ((matrix2.M22 - matrix1.M22) * amount),
+			matrix1.M31 + ((matrix2.M31 - matrix1.M31) * amount),
+			matrix1.M32 + ((matrix2.M32 - matrix1.M32) * amount));
+	}
+
+	Matrix3x2 Matrix3x2::Multiply(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2) {
+		return Matrix3x2(
+			matrix1.M11 * matrix2.M11 + matrix1.M12 * matrix2.M21,
+			matrix1.M11 * matrix2.M12 + matrix1.M12 * matrix2.M22,
+			matrix1.M21 * matrix2.M11 + matrix1.M22 * matrix2.M21,
+			matrix1.M21 * matrix2.M12 + matrix1.M22 * matrix2.M22,
+			matrix1.M31 * matrix2.M11 + matrix1.M32 * matrix2.M21 + matrix2.M31,
+			matrix1.M31 * matrix2.M12 + matrix1.M32 * matrix2.M22 + matrix2.M32);
+	}
+}
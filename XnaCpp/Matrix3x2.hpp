@@ -0,0 +1,62 @@
+#ifndef _MATRIX3X2_HPP_
+#define _MATRIX3X2_HPP_
+
+#include "Vector2.hpp"
+
+namespace Xna {
+
+	struct Matrix;
+
+	// 2D affine transform: the first two columns of a 3x3 matrix whose last column is (0, 0, 1). Vectors are rows, as
+	// with Matrix, so M31 and M32 hold the translation and matrix1 * matrix2 applies matrix1 first.
+	struct Matrix3x2 {
+		float M11{ 0 };
+		float M12{ 0 };
+		float M21{ 0 };
+		float M22{ 0 };
+		float M31{ 0 };
+		float M32{ 0 };
+
+		static const Matrix3x2 Identity;
+
+		Matrix3x2();
+		Matrix3x2(float m11, float m12, float m21, float m22, float m31, float m32);
+		// Takes the XY rotation, scale and skew and the XY translation, dropping everything else.
+		explicit Matrix3x2(Matrix const& matrix);
+
+		Matrix3x2 operator -() const;
+		friend Matrix3x2 operator +(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2);
+		friend Matrix3x2 operator -(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2);
+		friend Matrix3x2 operator *(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2);
+		friend Matrix3x2 operator *(Matrix3x2 const& matrix, float scaleFactor);
+		friend bool operator ==(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2);
+		friend bool operator !=(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2);
+
+		static Matrix3x2 CreateRotation(float radians);
+		static Matrix3x2 CreateRotation(float radians, Vector2 const& centerPoint);
+		static Matrix3x2 CreateScale(float scale);
+		static Matrix3x2 CreateScale(float xScale, float yScale);
+		static Matrix3x2 CreateScale(Vector2 const& scales);
+		static Matrix3x2 CreateScale(Vector2 const& scales, Vector2 const& centerPoint);
+		// Shears by tan(radiansX) along X per unit of Y, and by tan(radiansY) along Y per unit of X.
+		static Matrix3x2 CreateSkew(float radiansX, float radiansY);
+		static Matrix3x2 CreateSkew(float radiansX, float radiansY, Vector2 const& centerPoint);
+		static Matrix3x2 CreateTranslation(float xPosition, float yPosition);
+		static Matrix3x2 CreateTranslation(Vector2 const& position);
+		static Matrix3x2 Invert(Matrix3x2 const& matrix);
+		// Returns false and sets result to NaN when the determinant is zero, denormal or not finite.
+		static bool Invert(Matrix3x2 const& matrix, Matrix3x2& result);
+		static Matrix3x2 Lerp(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2, float amount);
+		static Matrix3x2 Multiply(Matrix3x2 const& matrix1, Matrix3x2 const& matrix2);
+
+		float Determinant() const;
+		bool IsIdentity() const;
+		Vector2 Translation() const;
+		void Translation(Vector2 const& value);
+		// The equivalent 4x4 transform; Vector2::Transform gives the same bits with either matrix.
+		Matrix ToMatrix() const;
+		bool Equals(Matrix3x2 const& other) const;
+	};
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "Parallel.hpp"
+#include "TaskGraph.hpp"
+#include "WorkStealingExecutor.hpp"
+
+using std::atomic;
+using std::thread;
+
+//Private
+namespace Xna {
+	namespace {
+		// The executor's threads, shared by every For. The graph is built once with a task per thread; each call
+		// publishes its range here and the first Workers tasks hand the indices out.
+		struct Pool {
+			std::mutex Mutex;
+			WorkStealingExecutor Executor;
+			TaskGraph Graph;
+			atomic<size_t> Next{ 0 };
+			size_t End{ 0 };
+			size_t Workers{ 0 };
+			std::function<void(size_t)> const* Body{ nullptr };
+
+			Pool() {
+				for (size_t i = 0; i < Executor.ThreadCount(); ++i) {
+					Graph.Add([this, i]() {
+						if (i < Workers)
+							work();
+						});
+				}
+			}
+
+			void work();
+		};
+
+		// Set while a thread runs For bodies, so that nested calls do not wait for the pool they are running on.
+		thread_local bool running = false;
+
+		void Pool::work() {
+			running = true;
+
+			for (auto i = Next.fetch_add(1); i < End; i = Next.fetch_add(1))
+				(*Body)(i);
+
+			running = false;
+		}
+
+		Pool& pool() {
+			static Pool instance;
+			return instance;
+		}
+	}
+}
+
+//Static
+namespace Xna {
+	size_t Parallel::ProcessorCount() {
+		auto count = thread::hardware_concurrency();
+		return count == 0 ? 1 : static_cast<size_t>(count);
+	}
+
+	void Parallel::For(size_t begin, size_t end, size_t threadCount, std::function<void(size_t)> const& body) {
+		if (end <= begin)
+			return;
+
+		if (threadCount == 0)
+			threadCount = ProcessorCount();
+
+		auto count = end - begin;
+
+		if (threadCount > count)
+			threadCount = count;
+
+		if (threadCount <= 1 || running) {
+			for (size_t i = begin; i < end; ++i)
+				body(i);
+
+			return;
+		}
+
+		auto& instance = pool();
+		std::lock_guard<std::mutex> lock(instance.Mutex);
+
+		instance.Next.store(begin, std::memory_order_relaxed);
+		instance.End = end;
+		instance.Workers = threadCount;
+		instance.Body = &body;
+
+		instance.Executor.Run(instance.Graph);
+
+		instance.Body = nullptr;
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef _PARALLEL_HPP_
+#define _PARALLEL_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace Xna {
+	class Parallel {
+	public:
+		static size_t ProcessorCount();
+
+		// Runs body(index) for every index in [begin, end), handing indices out to up to threadCount threads.
+		// A threadCount of 0 uses ProcessorCount(). The calling thread takes part in the work; the others come from a
+		// pool of ProcessorCount() threads started on first use. Calls made from a body run serially, and calls from
+		// other threads wait until the pool is free.
+		static void For(size_t begin, size_t end, size_t threadCount, std::function<void(size_t)> const& body);
+	};
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef _PIXELMATH_HPP_
+#define _PIXELMATH_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include "Color.hpp"
+
+// 8-bit channel arithmetic shared by Compositor and SoftwareRasterizer.
+namespace Xna::Detail {
+
+	// The packed value of a const Color, since Color::PackedValue() is not const.
+	inline uint32_t packed(Color const& color) {
+		uint32_t value;
+		std::memcpy(&value, &color, sizeof(value));
+		return value;
+	}
+
+	// Exact round(a * b / 255) for 8-bit operands.
+	inline uint32_t mul255(uint32_t a, uint32_t b) {
+		auto t = a * b + 128;
+		return (t + (t >> 8)) >> 8;
+	}
+}
+
+#endif
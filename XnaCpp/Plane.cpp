@@ -6,6 +6,9 @@
 #include "BoundingBox.hpp"
 #include "BoundingSphere.hpp"
 #include "BoundingFrustum.hpp"
+#include "Profiler.hpp"
+#include "Simd.hpp"
+#include "Vector3A.hpp"
 
 namespace Xna {
 	float PlaneHelper::ClassifyPoint(Vector3 const& point, Plane const& plane) {
@@ -139,6 +142,54 @@ namespace Xna {
 		return PlaneIntersectionType::Intersecting;
 	}
 
+	void Plane::Intersects(AlignedVector<Vector3A> const& spheres, size_t sourceIndex, std::vector<PlaneIntersectionType>& results,
+		size_t destinationIndex, size_t length) const {
+		XNA_PROFILE_ZONE("Plane::Intersects");
+
+		if (sourceIndex > spheres.size() || length > spheres.size() - sourceIndex
+			|| destinationIndex > results.size() || length > results.size() - destinationIndex)
+			return;
+
+		auto source = spheres.data() + sourceIndex;
+		auto destination = results.data() + destinationIndex;
+		size_t i = 0;
+
+#if XNA_SSE2
+		auto normalX = _mm_set1_ps(Normal.X);
+		auto normalY = _mm_set1_ps(Normal.Y);
+		auto normalZ = _mm_set1_ps(Normal.Z);
+		auto d = _mm_set1_ps(D);
+		auto sign = _mm_set1_ps(-0.0f);
+
+		for (; i + 4 <= length; i += 4) {
+			auto x = _mm_load_ps(&source[i].X);
+			auto y = _mm_load_ps(&source[i + 1].X);
+			auto z = _mm_load_ps(&source[i + 2].X);
+			auto radius = _mm_load_ps(&source[i + 3].X);
+			_MM_TRANSPOSE4_PS(x, y, z, radius);
+
+			auto distance = _mm_add_ps(_mm_mul_ps(normalX, x), _mm_mul_ps(normalY, y));
+			distance = _mm_add_ps(_mm_add_ps(distance, _mm_mul_ps(normalZ, z)), d);
+			auto frontBits = _mm_movemask_ps(_mm_cmpgt_ps(distance, radius));
+			auto backBits = _mm_movemask_ps(_mm_cmplt_ps(distance, _mm_xor_ps(radius, sign)));
+
+			for (size_t j = 0; j < 4; ++j) {
+				if (frontBits & (1 << j))
+					destination[i + j] = PlaneIntersectionType::Front;
+				else
+					destination[i + j] = backBits & (1 << j) ? PlaneIntersectionType::Back : PlaneIntersectionType::Intersecting;
+			}
+		}
+#endif
+
+		for (; i < length; ++i)
+			destination[i] = Intersects(BoundingSphere(source[i].ToVector3(), source[i].W));
+	}
+
+	void Plane::Intersects(AlignedVector<Vector3A> const& spheres, std::vector<PlaneIntersectionType>& results) const {
+		Intersects(spheres, 0, results, 0, results.size());
+	}
+
 	void Plane::Deconstruct(Vector3& normal, float& d) const {
 		normal = Normal;
 		d = D;
@@ -3,6 +3,7 @@
 
 #include "Vector3.hpp"
 #include "PlaneIntersectionType.hpp"
+#include "Aligned.hpp"
 
 namespace Xna {
 
@@ -12,8 +13,10 @@ namespace Xna {
 	struct BoundingBox;
 	struct BoundingSphere;
 	class BoundingFrustum;
+	struct Vector3A;
 
-	struct Plane {
+	// 16-byte aligned so a plane is one aligned SIMD load.
+	struct alignas(16) Plane {
 		float D{ 0 };
 		Vector3 Normal{ Vector3::Zero };
 
@@ -40,6 +43,10 @@ namespace Xna {
 		PlaneIntersectionType Intersects(BoundingFrustum const& frustum) const;
 		PlaneIntersectionType Intersects(BoundingSphere const& sphere) const;
 		PlaneIntersectionType Intersects(Vector3 const& point) const;
+		// Intersects(BoundingSphere) for spheres packed as Vector3A centers with the radius in W, four per SIMD step.
+		void Intersects(AlignedVector<Vector3A> const& spheres, size_t sourceIndex, std::vector<PlaneIntersectionType>& results,
+			size_t destinationIndex, size_t length) const;
+		void Intersects(AlignedVector<Vector3A> const& spheres, std::vector<PlaneIntersectionType>& results) const;
 		void Deconstruct(Vector3& normal, float& d) const;
 	};
 
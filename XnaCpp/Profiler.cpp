@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include "Profiler.hpp"
+
+using CSharp::TimeSpan;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		using Clock = std::chrono::steady_clock;
+		using Ticks = std::chrono::duration<int64_t, std::ratio<1, TimeSpan::TicksPerSecond>>;
+
+		// Single producer ring: only the owning thread writes, Collect() reads under the registry lock.
+		struct ThreadBuffer {
+			vector<ProfileEvent> Events;
+			std::atomic<uint64_t> Head{ 0 };
+			uint64_t Tail{ 0 };
+			uint32_t ThreadId{ 0 };
+			int64_t LastFrame{ -1 };
+			// Set when the owning thread exits; the buffer is recycled once its last events are drained.
+			std::atomic<bool> Exited{ false };
+		};
+
+		struct Registry {
+			std::mutex Mutex;
+			vector<std::shared_ptr<ThreadBuffer>> Buffers;
+			// Drained buffers of exited threads, reused with their ThreadId by the next threads to record.
+			vector<std::shared_ptr<ThreadBuffer>> Free;
+			uint32_t NextThreadId{ 1 };
+		};
+
+		Clock::time_point const epoch = Clock::now();
+		std::atomic<bool> enabled{ true };
+		std::atomic<size_t> capacity{ Profiler::DefaultCapacity };
+
+		Registry& registry() {
+			static Registry instance;
+			return instance;
+		}
+
+		std::shared_ptr<ThreadBuffer> createBuffer() {
+			auto& instance = registry();
+			std::unique_lock<std::mutex> lock(instance.Mutex);
+			std::shared_ptr<ThreadBuffer> buffer;
+
+			if (!instance.Free.empty()) {
+				buffer = std::move(instance.Free.back());
+				instance.Free.pop_back();
+			}
+			else {
+				buffer = std::make_shared<ThreadBuffer>();
+				buffer->ThreadId = instance.NextThreadId++;
+			}
+
+			// Set up outside the lock, since the buffer is in neither list.
+			lock.unlock();
+
+			auto size = capacity.load(std::memory_order_relaxed);
+
+			if (buffer->Events.size() != size)
+				vector<ProfileEvent>(size).swap(buffer->Events);
+
+			buffer->LastFrame = -1;
+			buffer->Exited.store(false, std::memory_order_relaxed);
+
+			lock.lock();
+			instance.Buffers.push_back(buffer);
+
+			return buffer;
+		}
+
+		// The registry keeps buffers alive so events survive the threads that recorded them.
+		struct ThreadHandle {
+			std::shared_ptr<ThreadBuffer> Buffer = createBuffer();
+
+			~ThreadHandle() {
+				Buffer->Exited.store(true, std::memory_order_release);
+			}
+		};
+
+		ThreadBuffer& threadBuffer() {
+			thread_local ThreadHandle handle;
+			return *handle.Buffer;
+		}
+
+		void drain(vector<ProfileEvent>* destination) {
+			auto& instance = registry();
+			std::lock_guard<std::mutex> lock(instance.Mutex);
+
+			for (auto& buffer : instance.Buffers) {
+				// Read first, so that an exited thread's head is final.
+				auto exited = buffer->Exited.load(std::memory_order_acquire);
+				uint64_t size = buffer->Events.size();
+				auto head = buffer->Head.load(std::memory_order_acquire);
+				auto first = head - buffer->Tail > size ? head - size : buffer->Tail;
+
+				if (destination) {
+					auto count = destination->size();
+
+					for (auto i = first; i < head; ++i)
+						destination->push_back(buffer->Events[i & (size - 1)]);
+
+					// Slots the owner reused while we were copying hold newer events; drop them. The owner may also be
+					// writing event after, into the slot of event after + 1 - size.
+					auto after = buffer->Head.load(std::memory_order_acquire);
+					auto overwritten = after + 1 > size ? after + 1 - size : 0;
+
+					if (overwritten > first) {
+						auto lost = static_cast<size_t>(std::min(overwritten, head) - first);
+						destination->erase(destination->begin() + count, destination->begin() + count + lost);
+					}
+				}
+
+				buffer->Tail = head;
+
+				if (exited)
+					instance.Free.push_back(std::move(buffer));
+			}
+
+			std::erase(instance.Buffers, nullptr);
+		}
+
+		void writeEscaped(std::ostream& stream, char const* text) {
+			for (auto c = text; *c; ++c) {
+				if (*c == '"' || *c == '\\')
+					stream << '\\';
+
+				stream << *c;
+			}
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	ProfileZone::ProfileZone(char const* name) :
+		_name(name) {
+		if (Profiler::Enabled())
+			_start = Profiler::Timestamp();
+	}
+
+	ProfileZone::~ProfileZone() {
+		if (_start >= 0)
+			Profiler::Record(_name, _start, Profiler::Timestamp());
+	}
+}
+
+//Functions
+namespace Xna {
+	TimeSpan ProfileEvent::StartTime() const {
+		return TimeSpan(Start);
+	}
+
+	TimeSpan ProfileEvent::Duration() const {
+		return TimeSpan(End - Start);
+	}
+}
+
+//Static
+namespace Xna {
+	bool Profiler::Enabled() {
+		return enabled.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::Enabled(bool value) {
+		enabled.store(value, std::memory_order_relaxed);
+	}
+
+	size_t Profiler::Capacity() {
+		return capacity.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::Capacity(size_t value) {
+		size_t size = 1;
+
+		while (size < value)
+			size <<= 1;
+
+		capacity.store(size, std::memory_order_relaxed);
+	}
+
+	int64_t Profiler::Timestamp() {
+		return std::chrono::duration_cast<Ticks>(Clock::now() - epoch).count();
+	}
+
+	void Profiler::Record(char const* name, int64_t start, int64_t end) {
+		auto& buffer = threadBuffer();
+		auto head = buffer.Head.load(std::memory_order_relaxed);
+		auto& event = buffer.Events[head & (buffer.Events.size() - 1)];
+
+		event.Name = name;
+		event.Start = start;
+		event.End = end;
+		event.ThreadId = buffer.ThreadId;
+
+		buffer.Head.store(head + 1, std::memory_order_release);
+	}
+
+	void Profiler::MarkFrame() {
+		if (!Enabled())
+			return;
+
+		auto& buffer = threadBuffer();
+		auto now = Timestamp();
+
+		if (buffer.LastFrame >= 0)
+			Record("Frame", buffer.LastFrame, now);
+
+		buffer.LastFrame = now;
+	}
+
+	vector<ProfileEvent> Profiler::Collect() {
+		vector<ProfileEvent> events;
+		drain(&events);
+
+		std::sort(events.begin(), events.end(), [](ProfileEvent const& a, ProfileEvent const& b) {
+			return a.Start < b.Start;
+			});
+
+		return events;
+	}
+
+	void Profiler::Clear() {
+		drain(nullptr);
+	}
+
+	vector<ProfileZoneStats> Profiler::Aggregate(vector<ProfileEvent> const& events) {
+		// Grouped by text since the same literal may have several addresses across translation units.
+		std::unordered_map<std::string_view, vector<int64_t>> durations;
+
+		for (auto const& event : events)
+			durations[event.Name].push_back(event.End - event.Start);
+
+		vector<ProfileZoneStats> result;
+		result.reserve(durations.size());
+
+		for (auto& entry : durations) {
+			auto& values = entry.second;
+			std::sort(values.begin(), values.end());
+
+			int64_t total = 0;
+			for (auto value : values)
+				total += value;
+
+			auto count = values.size();
+			auto p99 = (count * 99 + 99) / 100 - 1;
+
+			ProfileZoneStats stats;
+			stats.Name = entry.first.data();
+			stats.Count = count;
+			stats.Total = TimeSpan(total);
+			stats.Min = TimeSpan(values.front());
+			stats.Average = TimeSpan(total / static_cast<int64_t>(count));
+			stats.P99 = TimeSpan(values[p99]);
+			stats.Max = TimeSpan(values.back());
+
+			result.push_back(stats);
+		}
+
+		std::sort(result.begin(), result.end(), [](ProfileZoneStats const& a, ProfileZoneStats const& b) {
+			return a.Total > b.Total;
+			});
+
+		return result;
+	}
+
+	void Profiler::WriteChromeTrace(std::ostream& stream, vector<ProfileEvent> const& events) {
+		// Trace Event Format "complete" events; timestamps are in microseconds.
+		constexpr double ticksPerMicrosecond = TimeSpan::TicksPerMillisecond / 1000.0;
+
+		auto flags = stream.flags();
+		auto precision = stream.precision();
+		stream.setf(std::ios::fixed, std::ios::floatfield);
+		stream.precision(1);
+
+		stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		for (size_t i = 0; i < events.size(); ++i) {
+			auto const& event = events[i];
+
+			stream << (i == 0 ? "\n" : ",\n") << "{\"name\":\"";
+			writeEscaped(stream, event.Name ? event.Name : "");
+			stream << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.ThreadId
+				<< ",\"ts\":" << event.Start / ticksPerMicrosecond
+				<< ",\"dur\":" << (event.End - event.Start) / ticksPerMicrosecond << "}";
+		}
+
+		stream << "\n]}\n";
+
+		stream.flags(flags);
+		stream.precision(precision);
+	}
+}
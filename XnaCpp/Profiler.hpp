@@ -0,0 +1,88 @@
+#ifndef _PROFILER_HPP_
+#define _PROFILER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "CSharp/TimeSpan.hpp"
+
+// Zones are only compiled in when XNA_PROFILE is defined to a non-zero value (CMake option XNA_PROFILE).
+// Otherwise the macros expand to nothing and the library carries no instrumentation cost.
+#if defined(XNA_PROFILE) && XNA_PROFILE
+#define XNA_PROFILE_CONCAT_(a, b) a##b
+#define XNA_PROFILE_CONCAT(a, b) XNA_PROFILE_CONCAT_(a, b)
+#define XNA_PROFILE_ZONE(name) ::Xna::ProfileZone XNA_PROFILE_CONCAT(xnaProfileZone, __LINE__)(name)
+#define XNA_PROFILE_FRAME() ::Xna::Profiler::MarkFrame()
+#else
+#define XNA_PROFILE_ZONE(name) ((void)0)
+#define XNA_PROFILE_FRAME() ((void)0)
+#endif
+
+namespace Xna {
+
+	// A completed zone. Start and End are TimeSpan ticks since the profiler epoch.
+	struct ProfileEvent {
+		char const* Name{ nullptr };
+		int64_t Start{ 0 };
+		int64_t End{ 0 };
+		uint32_t ThreadId{ 0 };
+
+		CSharp::TimeSpan StartTime() const;
+		CSharp::TimeSpan Duration() const;
+	};
+
+	struct ProfileZoneStats {
+		char const* Name{ nullptr };
+		size_t Count{ 0 };
+		CSharp::TimeSpan Total;
+		CSharp::TimeSpan Min;
+		CSharp::TimeSpan Average;
+		CSharp::TimeSpan P99;
+		CSharp::TimeSpan Max;
+	};
+
+	// Collects zones into one ring buffer per thread. Recording never locks; a thread takes the registry
+	// lock once, the first time it records. When a buffer wraps the oldest events are lost. Once a thread has exited
+	// and its events have been collected or cleared, its buffer and ThreadId pass to the next new thread.
+	// Zone names must have static storage duration, such as string literals.
+	class Profiler {
+	public:
+		static constexpr size_t DefaultCapacity = 1 << 16;
+
+		static bool Enabled();
+		static void Enabled(bool value);
+
+		// Ring size, rounded up to a power of two, for threads that have not recorded yet.
+		static size_t Capacity();
+		static void Capacity(size_t value);
+
+		static int64_t Timestamp();
+		static void Record(char const* name, int64_t start, int64_t end);
+
+		// Records a "Frame" zone spanning the time since the previous call on this thread.
+		static void MarkFrame();
+
+		// Removes and returns the events recorded so far by every thread, ordered by start time.
+		static std::vector<ProfileEvent> Collect();
+		static void Clear();
+
+		static std::vector<ProfileZoneStats> Aggregate(std::vector<ProfileEvent> const& events);
+		static void WriteChromeTrace(std::ostream& stream, std::vector<ProfileEvent> const& events);
+	};
+
+	class ProfileZone {
+	public:
+		ProfileZone(char const* name);
+		~ProfileZone();
+
+		ProfileZone(ProfileZone const&) = delete;
+		ProfileZone& operator =(ProfileZone const&) = delete;
+
+	private:
+		char const* _name{ nullptr };
+		int64_t _start{ -1 };
+	};
+}
+
+#endif
@@ -1,8 +1,268 @@
+#include <algorithm>
 #include <cmath>
 #include "Quaternion.hpp"
 #include "Vector3.hpp"
 #include "Vector4.hpp"
 #include "Matrix.hpp"
+#include "MathHelper.hpp"
+#include "Profiler.hpp"
+#include "QuaternionSoA.hpp"
+#include "SimdLanes.hpp"
+
+using std::vector;
+using Xna::Simd::BatchLanes;
+using Xna::Simd::ScalarLanes;
+
+//Private
+namespace Xna {
+	namespace {
+		// Routes through the MathHelper approximations when MathHelper::UseFastMath() is set. Otherwise this is the
+		// double precision sin and cos the rotation factories have always called, so their results are unchanged.
+		void sinCos(double angle, double& sine, double& cosine) {
+			if (MathHelper::UseFastMath()) {
+				float fastSine;
+				float fastCosine;
+				MathHelper::SinCos(static_cast<float>(angle), fastSine, fastCosine);
+				sine = fastSine;
+				cosine = fastCosine;
+				return;
+			}
+
+			sine = std::sin(angle);
+			cosine = std::cos(angle);
+		}
+
+		double sine(double angle) {
+			if (MathHelper::UseFastMath()) {
+				float fastSine;
+				float fastCosine;
+				MathHelper::SinCos(static_cast<float>(angle), fastSine, fastCosine);
+				return fastSine;
+			}
+
+			return std::sin(angle);
+		}
+
+		// Strided views let one kernel read both Quaternion arrays (stride 4) and QuaternionSoA (stride 1).
+		struct QuaternionSource {
+			float const* X;
+			float const* Y;
+			float const* Z;
+			float const* W;
+			size_t Stride;
+		};
+
+		struct QuaternionDestination {
+			float* X;
+			float* Y;
+			float* Z;
+			float* W;
+			size_t Stride;
+		};
+
+		QuaternionSource source(vector<Quaternion> const& values, size_t index) {
+			auto first = values.data() + index;
+			return { &first->X, &first->Y, &first->Z, &first->W, 4 };
+		}
+
+		QuaternionSource source(QuaternionSoA const& values) {
+			return { values.X.data(), values.Y.data(), values.Z.data(), values.W.data(), 1 };
+		}
+
+		QuaternionDestination destination(vector<Quaternion>& values, size_t index) {
+			auto first = values.data() + index;
+			return { &first->X, &first->Y, &first->Z, &first->W, 4 };
+		}
+
+		QuaternionDestination destination(QuaternionSoA& values) {
+			return { values.X.data(), values.Y.data(), values.Z.data(), values.W.data(), 1 };
+		}
+
+		template <typename L>
+		struct Lanes {
+			typename L::Float X;
+			typename L::Float Y;
+			typename L::Float Z;
+			typename L::Float W;
+		};
+
+		// Partial blocks are padded with Identity so unused lanes stay finite.
+		template <typename L>
+		Lanes<L> load(QuaternionSource const& values, size_t offset, size_t count) {
+			if (values.Stride == 1 && count == L::Width)
+				return { L::Load(values.X + offset), L::Load(values.Y + offset), L::Load(values.Z + offset), L::Load(values.W + offset) };
+
+			float x[L::Width] = {};
+			float y[L::Width] = {};
+			float z[L::Width] = {};
+			float w[L::Width];
+			std::fill_n(w, L::Width, 1.0F);
+
+			for (size_t i = 0; i < count; ++i) {
+				auto index = (offset + i) * values.Stride;
+				x[i] = values.X[index];
+				y[i] = values.Y[index];
+				z[i] = values.Z[index];
+				w[i] = values.W[index];
+			}
+
+			return { L::Load(x), L::Load(y), L::Load(z), L::Load(w) };
+		}
+
+		template <typename L>
+		void store(QuaternionDestination const& values, size_t offset, size_t count, Lanes<L> const& value) {
+			if (values.Stride == 1 && count == L::Width) {
+				L::Store(values.X + offset, value.X);
+				L::Store(values.Y + offset, value.Y);
+				L::Store(values.Z + offset, value.Z);
+				L::Store(values.W + offset, value.W);
+				return;
+			}
+
+			float x[L::Width];
+			float y[L::Width];
+			float z[L::Width];
+			float w[L::Width];
+			L::Store(x, value.X);
+			L::Store(y, value.Y);
+			L::Store(z, value.Z);
+			L::Store(w, value.W);
+
+			for (size_t i = 0; i < count; ++i) {
+				auto index = (offset + i) * values.Stride;
+				values.X[index] = x[i];
+				values.Y[index] = y[i];
+				values.Z[index] = z[i];
+				values.W[index] = w[i];
+			}
+		}
+
+		template <typename L>
+		typename L::Float dot(Lanes<L> const& a, Lanes<L> const& b) {
+			return L::Add(L::Add(L::Mul(a.X, b.X), L::Mul(a.Y, b.Y)), L::Add(L::Mul(a.Z, b.Z), L::Mul(a.W, b.W)));
+		}
+
+		template <typename L>
+		Lanes<L> combine(Lanes<L> const& a, typename L::Float weightA, Lanes<L> const& b, typename L::Float weightB) {
+			return {
+				L::Add(L::Mul(a.X, weightA), L::Mul(b.X, weightB)),
+				L::Add(L::Mul(a.Y, weightA), L::Mul(b.Y, weightB)),
+				L::Add(L::Mul(a.Z, weightA), L::Mul(b.Z, weightB)),
+				L::Add(L::Mul(a.W, weightA), L::Mul(b.W, weightB)) };
+		}
+
+		// A zero quaternion normalizes to Identity.
+		template <typename L>
+		Lanes<L> normalize(Lanes<L> const& value) {
+			auto lengthSquared = dot(value, value);
+			auto scale = L::Div(L::Set(1.0F), L::Sqrt(lengthSquared));
+			auto zero = L::Equal(lengthSquared, L::Set(0.0F));
+
+			return {
+				L::Select(zero, L::Set(0.0F), L::Mul(value.X, scale)),
+				L::Select(zero, L::Set(0.0F), L::Mul(value.Y, scale)),
+				L::Select(zero, L::Set(0.0F), L::Mul(value.Z, scale)),
+				L::Select(zero, L::Set(1.0F), L::Mul(value.W, scale)) };
+		}
+
+		// sin(t a) / sin(a) = t (1 + b1 (1 + b2 (... (1 + b8)))) with bi = (ui t^2 - vi)(cos(a) - 1);
+		// the last term is scaled by mu to absorb the truncated tail.
+		constexpr float slerpMu = 1.85298109240830F;
+
+		constexpr float slerpU[8] = {
+			1.0F / (1 * 3), 1.0F / (2 * 5), 1.0F / (3 * 7), 1.0F / (4 * 9),
+			1.0F / (5 * 11), 1.0F / (6 * 13), 1.0F / (7 * 15), slerpMu / (8 * 17) };
+
+		constexpr float slerpV[8] = {
+			1.0F / 3, 2.0F / 5, 3.0F / 7, 4.0F / 9,
+			5.0F / 11, 6.0F / 13, 7.0F / 15, slerpMu * 8 / 17 };
+
+		template <typename L>
+		typename L::Float sineRatio(typename L::Float t, typename L::Float cosineMinusOne) {
+			auto t2 = L::Mul(t, t);
+			auto result = L::Set(1.0F);
+
+			for (auto i = 7; i >= 0; --i) {
+				auto b = L::Mul(L::Sub(L::Mul(L::Set(slerpU[i]), t2), L::Set(slerpV[i])), cosineMinusOne);
+				result = L::Add(L::Set(1.0F), L::Mul(b, result));
+			}
+
+			return L::Mul(t, result);
+		}
+
+		template <typename L>
+		Lanes<L> fastSlerp(Lanes<L> const& a, Lanes<L> const& b, typename L::Float amount) {
+			auto cosine = dot(a, b);
+			auto sign = L::And(cosine, L::Set(-0.0F));
+			auto cosineMinusOne = L::Sub(L::Xor(cosine, sign), L::Set(1.0F));
+
+			auto weightA = sineRatio<L>(L::Sub(L::Set(1.0F), amount), cosineMinusOne);
+			auto weightB = L::Xor(sineRatio<L>(amount, cosineMinusOne), sign);
+
+			return combine(a, weightA, b, weightB);
+		}
+
+		// Correction of the lerp parameter from Kapoulkine, "Approximating slerp": a cubic in t whose
+		// coefficients are fitted as polynomials in the cosine of the angle.
+		template <typename L>
+		Lanes<L> nlerp(Lanes<L> const& a, Lanes<L> const& b, typename L::Float amount) {
+			auto cosine = dot(a, b);
+			auto sign = L::And(cosine, L::Set(-0.0F));
+			auto d = L::Xor(cosine, sign);
+
+			auto ca = L::Add(L::Mul(L::Set(-1.43519F), d), L::Set(3.55645F));
+			ca = L::Add(L::Mul(ca, d), L::Set(-3.2452F));
+			ca = L::Add(L::Mul(ca, d), L::Set(1.0904F));
+			auto cb = L::Add(L::Mul(L::Set(0.215638F), d), L::Set(-1.06021F));
+			cb = L::Add(L::Mul(cb, d), L::Set(0.848013F));
+
+			auto centered = L::Sub(amount, L::Set(0.5F));
+			auto k = L::Add(L::Mul(L::Mul(ca, centered), centered), cb);
+			auto t = L::Add(amount, L::Mul(L::Mul(L::Mul(amount, centered), L::Sub(amount, L::Set(1.0F))), k));
+
+			return normalize(combine(a, L::Sub(L::Set(1.0F), t), b, L::Xor(t, sign)));
+		}
+
+		template <typename Kernel>
+		void pairwise(QuaternionSource const& source1, QuaternionSource const& source2, QuaternionDestination const& target,
+			size_t length, Kernel const& kernel) {
+			constexpr auto width = BatchLanes::Width;
+
+			for (size_t i = 0; i < length; i += width) {
+				auto count = std::min(width, length - i);
+				auto a = load<BatchLanes>(source1, i, count);
+				auto b = load<BatchLanes>(source2, i, count);
+				store<BatchLanes>(target, i, count, kernel(a, b));
+			}
+		}
+
+		void blend(vector<QuaternionSource> const& poses, vector<float> const& weights, QuaternionDestination const& target, size_t length) {
+			constexpr auto width = BatchLanes::Width;
+
+			for (size_t i = 0; i < length; i += width) {
+				auto count = std::min(width, length - i);
+				auto first = load<BatchLanes>(poses[0], i, count);
+				auto zero = BatchLanes::Set(0.0F);
+				auto sum = combine(first, BatchLanes::Set(weights[0]), first, zero);
+
+				for (size_t p = 1; p < poses.size(); ++p) {
+					auto pose = load<BatchLanes>(poses[p], i, count);
+					auto sign = BatchLanes::And(dot(first, pose), BatchLanes::Set(-0.0F));
+					sum = combine(sum, BatchLanes::Set(1.0F), pose, BatchLanes::Xor(BatchLanes::Set(weights[p]), sign));
+				}
+
+				store<BatchLanes>(target, i, count, normalize(sum));
+			}
+		}
+
+		bool validRange(size_t size1, size_t size2, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			auto sourceSize = std::min(size1, size2);
+
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+	}
+}
 
 //Constructors
 namespace Xna {
@@ -89,8 +349,9 @@ namespace Xna {
 
 	Quaternion Quaternion::CreateFromAxisAngle(Vector3 const& axis, float angle) {
 		auto half = angle * 0.5f;
-		auto _sin = sin(half);
-		auto _cos = cos(half);
+		double _sin;
+		double _cos;
+		sinCos(half, _sin, _cos);
 
 		return Quaternion(
 			axis.X * _sin,
@@ -104,12 +365,12 @@ namespace Xna {
 		auto halfPitch = pitch * 0.5f;
 		auto halfYaw = yaw * 0.5f;
 
-		auto sinRoll = sin(halfRoll);
-		auto cosRoll = cos(halfRoll);
-		auto sinPitch = sin(halfPitch);
-		auto cosPitch = cos(halfPitch);
-		auto sinYaw = sin(halfYaw);
-		auto cosYaw = cos(halfYaw);
+		double sinRoll, cosRoll;
+		double sinPitch, cosPitch;
+		double sinYaw, cosYaw;
+		sinCos(halfRoll, sinRoll, cosRoll);
+		sinCos(halfPitch, sinPitch, cosPitch);
+		sinCos(halfYaw, sinYaw, cosYaw);
 
 		return Quaternion(
 			(cosYaw * sinPitch * cosRoll) + (sinYaw * cosPitch * sinRoll),
@@ -254,11 +515,12 @@ namespace Xna {
 			num2 = flag ? -num : num;
 		}
 		else {
-			auto num5 = acos(num4);
+			auto fast = MathHelper::UseFastMath();
+			auto num5 = fast ? MathHelper::Acos(num4) : acos(num4);
 			//TODO: verificar uso de double
-			auto num6 = 1.0F / sin(num5);
-			num3 = sin((1.0F - num) * num5) * num6;
-			num2 = flag ? (-sin(num * num5) * num6) : (sin(num * num5) * num6);
+			auto num6 = 1.0F / sine(num5);
+			num3 = sine((1.0F - num) * num5) * num6;
+			num2 = flag ? (-sine(num * num5) * num6) : (sine(num * num5) * num6);
 		}
 
 		Quaternion quaternion;
@@ -323,6 +585,128 @@ namespace Xna {
 			quaternion.Z * num,
 			quaternion.W * num);
 	}
+
+	Quaternion Quaternion::FastSlerp(Quaternion const& quaternion1, Quaternion const& quaternion2, float amount) {
+		Lanes<ScalarLanes> a{ quaternion1.X, quaternion1.Y, quaternion1.Z, quaternion1.W };
+		Lanes<ScalarLanes> b{ quaternion2.X, quaternion2.Y, quaternion2.Z, quaternion2.W };
+		auto result = fastSlerp<ScalarLanes>(a, b, amount);
+
+		return Quaternion(result.X, result.Y, result.Z, result.W);
+	}
+
+	Quaternion Quaternion::Nlerp(Quaternion const& quaternion1, Quaternion const& quaternion2, float amount) {
+		Lanes<ScalarLanes> a{ quaternion1.X, quaternion1.Y, quaternion1.Z, quaternion1.W };
+		Lanes<ScalarLanes> b{ quaternion2.X, quaternion2.Y, quaternion2.Z, quaternion2.W };
+		auto result = nlerp<ScalarLanes>(a, b, amount);
+
+		return Quaternion(result.X, result.Y, result.Z, result.W);
+	}
+
+	void Quaternion::FastSlerp(vector<Quaternion> const& sourceArray1, vector<Quaternion> const& sourceArray2, size_t sourceIndex,
+		float amount, vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Quaternion::FastSlerp");
+
+		if (!validRange(sourceArray1.size(), sourceArray2.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		auto t = BatchLanes::Set(amount);
+		pairwise(source(sourceArray1, sourceIndex), source(sourceArray2, sourceIndex), destination(destinationArray, destinationIndex), length,
+			[t](Lanes<BatchLanes> const& a, Lanes<BatchLanes> const& b) { return fastSlerp<BatchLanes>(a, b, t); });
+	}
+
+	void Quaternion::FastSlerp(vector<Quaternion> const& sourceArray1, vector<Quaternion> const& sourceArray2,
+		float amount, vector<Quaternion>& destinationArray) {
+		FastSlerp(sourceArray1, sourceArray2, 0, amount, destinationArray, 0, sourceArray1.size());
+	}
+
+	void Quaternion::FastSlerp(QuaternionSoA const& source1, QuaternionSoA const& source2, float amount, QuaternionSoA& destination) {
+		XNA_PROFILE_ZONE("Quaternion::FastSlerp");
+
+		auto length = source1.Size();
+
+		if (!validRange(length, source2.Size(), 0, destination.Size(), 0, length))
+			return;
+
+		auto t = BatchLanes::Set(amount);
+		pairwise(source(source1), source(source2), Xna::destination(destination), length,
+			[t](Lanes<BatchLanes> const& a, Lanes<BatchLanes> const& b) { return fastSlerp<BatchLanes>(a, b, t); });
+	}
+
+	void Quaternion::Nlerp(vector<Quaternion> const& sourceArray1, vector<Quaternion> const& sourceArray2, size_t sourceIndex,
+		float amount, vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Quaternion::Nlerp");
+
+		if (!validRange(sourceArray1.size(), sourceArray2.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			return;
+
+		auto t = BatchLanes::Set(amount);
+		pairwise(source(sourceArray1, sourceIndex), source(sourceArray2, sourceIndex), destination(destinationArray, destinationIndex), length,
+			[t](Lanes<BatchLanes> const& a, Lanes<BatchLanes> const& b) { return nlerp<BatchLanes>(a, b, t); });
+	}
+
+	void Quaternion::Nlerp(vector<Quaternion> const& sourceArray1, vector<Quaternion> const& sourceArray2,
+		float amount, vector<Quaternion>& destinationArray) {
+		Nlerp(sourceArray1, sourceArray2, 0, amount, destinationArray, 0, sourceArray1.size());
+	}
+
+	void Quaternion::Nlerp(QuaternionSoA const& source1, QuaternionSoA const& source2, float amount, QuaternionSoA& destination) {
+		XNA_PROFILE_ZONE("Quaternion::Nlerp");
+
+		auto length = source1.Size();
+
+		if (!validRange(length, source2.Size(), 0, destination.Size(), 0, length))
+			return;
+
+		auto t = BatchLanes::Set(amount);
+		pairwise(source(source1), source(source2), Xna::destination(destination), length,
+			[t](Lanes<BatchLanes> const& a, Lanes<BatchLanes> const& b) { return nlerp<BatchLanes>(a, b, t); });
+	}
+
+	void Quaternion::Blend(vector<vector<Quaternion>> const& poses, vector<float> const& weights, vector<Quaternion>& destinationArray) {
+		XNA_PROFILE_ZONE("Quaternion::Blend");
+
+		if (poses.empty() || weights.size() != poses.size())
+			return;
+
+		auto length = poses[0].size();
+		vector<QuaternionSource> sources;
+		sources.reserve(poses.size());
+
+		for (auto const& pose : poses) {
+			if (pose.size() < length)
+				return;
+
+			sources.push_back(source(pose, 0));
+		}
+
+		if (destinationArray.size() < length)
+			return;
+
+		blend(sources, weights, destination(destinationArray, 0), length);
+	}
+
+	void Quaternion::Blend(vector<QuaternionSoA> const& poses, vector<float> const& weights, QuaternionSoA& destination) {
+		XNA_PROFILE_ZONE("Quaternion::Blend");
+
+		if (poses.empty() || weights.size() != poses.size())
+			return;
+
+		auto length = poses[0].Size();
+		vector<QuaternionSource> sources;
+		sources.reserve(poses.size());
+
+		for (auto const& pose : poses) {
+			if (pose.Size() < length)
+				return;
+
+			sources.push_back(source(pose));
+		}
+
+		if (destination.Size() < length)
+			return;
+
+		blend(sources, weights, Xna::destination(destination), length);
+	}
 }
 
 //Functions
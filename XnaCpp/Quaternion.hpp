@@ -1,13 +1,18 @@
 #ifndef _QUATERNION_HPP_
 #define _QUATERNION_HPP_
 
+#include <cstddef>
+#include <vector>
+
 namespace Xna {
 
 	struct Vector3;
 	struct Vector4;
 	struct Matrix;
+	struct QuaternionSoA;
 
-	struct Quaternion {
+	// 16-byte aligned so a quaternion is one aligned SIMD load.
+	struct alignas(16) Quaternion {
 		float X{ 0 };
 		float Y{ 0 };
 		float Z{ 0 };
@@ -46,6 +51,35 @@ namespace Xna {
 		static Quaternion Negate(Quaternion const& quaternion);
 		static Quaternion Normalize(Quaternion const& quaternion);
 
+		// Slerp along the shorter arc without trigonometric calls: the sine ratios are evaluated as a polynomial in
+		// the dot product (Eberly, "A Fast and Accurate Algorithm for Computing SLERP"). For unit inputs the result
+		// is within 3e-5 of the exact slerp per component and stays unit length to the same accuracy.
+		static Quaternion FastSlerp(Quaternion const& quaternion1, Quaternion const& quaternion2, float amount);
+
+		// Normalized lerp along the shorter arc with amount corrected by a cubic fitted to the slerp angle, so the
+		// rotation speed stays close to constant. Within 4e-4 of the exact slerp per component, against 7e-2 for Lerp.
+		static Quaternion Nlerp(Quaternion const& quaternion1, Quaternion const& quaternion2, float amount);
+
+		// Batch forms of FastSlerp and Nlerp, 4 (SSE2) or 8 (AVX2) quaternions at a time with the same results as the
+		// scalar functions. The QuaternionSoA forms load the components without shuffling.
+		static void FastSlerp(std::vector<Quaternion> const& sourceArray1, std::vector<Quaternion> const& sourceArray2, size_t sourceIndex,
+			float amount, std::vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length);
+		static void FastSlerp(std::vector<Quaternion> const& sourceArray1, std::vector<Quaternion> const& sourceArray2,
+			float amount, std::vector<Quaternion>& destinationArray);
+		static void FastSlerp(QuaternionSoA const& source1, QuaternionSoA const& source2, float amount, QuaternionSoA& destination);
+		static void Nlerp(std::vector<Quaternion> const& sourceArray1, std::vector<Quaternion> const& sourceArray2, size_t sourceIndex,
+			float amount, std::vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length);
+		static void Nlerp(std::vector<Quaternion> const& sourceArray1, std::vector<Quaternion> const& sourceArray2,
+			float amount, std::vector<Quaternion>& destinationArray);
+		static void Nlerp(QuaternionSoA const& source1, QuaternionSoA const& source2, float amount, QuaternionSoA& destination);
+
+		// Weighted blend of poses.size() poses: each quaternion is flipped into the hemisphere of the first pose,
+		// scaled by its pose weight and summed, and the sum is normalized. Weights need not add up to 1; a zero sum
+		// gives Identity. Every pose and the destination must hold at least as many quaternions as the first pose.
+		static void Blend(std::vector<std::vector<Quaternion>> const& poses, std::vector<float> const& weights,
+			std::vector<Quaternion>& destinationArray);
+		static void Blend(std::vector<QuaternionSoA> const& poses, std::vector<float> const& weights, QuaternionSoA& destination);
+
 		void Conjugate();
 		bool Equals(Quaternion const& other) const;
 		float Length() const;
@@ -0,0 +1,273 @@
+#include <cmath>
+#include "QuaternionQuantizer.hpp"
+#include "BitReader.hpp"
+#include "BitWriter.hpp"
+#include "MathHelper.hpp"
+#include "Quaternion.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		// The three smallest components of a unit quaternion lie within +-1/sqrt(2).
+		constexpr float componentRange = 0.707106781F;
+	}
+}
+
+//Constructors
+namespace Xna {
+	QuaternionQuantizer::QuaternionQuantizer() {}
+
+	QuaternionQuantizer::QuaternionQuantizer(int32_t bitsPerComponent) :
+		_bitsPerComponent(MathHelper::Clamp(bitsPerComponent, MinBitsPerComponent, MaxBitsPerComponent)) {}
+}
+
+//Static
+namespace Xna {
+	QuaternionQuantizer QuaternionQuantizer::FromMaxError(float maxError) {
+		for (int32_t bits = MinBitsPerComponent; bits < MaxBitsPerComponent; ++bits) {
+			QuaternionQuantizer quantizer(bits);
+
+			if (quantizer.MaxError() <= maxError)
+				return quantizer;
+		}
+
+		return QuaternionQuantizer(MaxBitsPerComponent);
+	}
+}
+
+//Functions
+namespace Xna {
+	int32_t QuaternionQuantizer::BitsPerComponent() const {
+		return _bitsPerComponent;
+	}
+
+	int32_t QuaternionQuantizer::BitsPerValue() const {
+		return 2 + 3 * _bitsPerComponent;
+	}
+
+	float QuaternionQuantizer::MaxError() const {
+		// Stored components are off by at most half a step. The rebuilt component is the largest, so each
+		// partial derivative is bounded by 1 and it accumulates at most the three stored errors.
+		auto step = 2.0F * componentRange / static_cast<float>((1u << _bitsPerComponent) - 1);
+		return step * 1.5F;
+	}
+
+	int32_t QuaternionQuantizer::DeltaBits() const {
+		return _deltaBits;
+	}
+
+	void QuaternionQuantizer::DeltaBits(int32_t value) {
+		_deltaBits = MathHelper::Clamp(value, 1, MaxBitsPerComponent);
+	}
+
+	uint64_t QuaternionQuantizer::Encode(Quaternion const& value) const {
+		float components[4] = { value.X, value.Y, value.Z, value.W };
+
+		auto length = std::sqrt(components[0] * components[0] + components[1] * components[1]
+			+ components[2] * components[2] + components[3] * components[3]);
+
+		// Also catches NaN and infinite components, which would otherwise reach the integer conversion below.
+		if (!(length >= 1e-12F) || std::isinf(length)) {
+			components[0] = components[1] = components[2] = 0.0F;
+			components[3] = 1.0F;
+			length = 1.0F;
+		}
+
+		int32_t largest = 0;
+
+		for (int32_t i = 1; i < 4; ++i) {
+			if (std::fabs(components[i]) > std::fabs(components[largest]))
+				largest = i;
+		}
+
+		// q and -q are the same rotation; flip so the dropped component is positive.
+		auto scale = (components[largest] < 0 ? -1.0F : 1.0F) / length;
+		auto maximum = static_cast<float>((1u << _bitsPerComponent) - 1);
+		auto factor = maximum / (2.0F * componentRange);
+
+		uint64_t result = static_cast<uint64_t>(largest);
+		int32_t shift = 2;
+
+		for (int32_t i = 0; i < 4; ++i) {
+			if (i == largest)
+				continue;
+
+			auto normalized = MathHelper::Clamp(components[i] * scale + componentRange, 0.0F, 2.0F * componentRange);
+			auto quantized = static_cast<uint64_t>(normalized * factor + 0.5F);
+
+			result |= quantized << shift;
+			shift += _bitsPerComponent;
+		}
+
+		return result;
+	}
+
+	Quaternion QuaternionQuantizer::Decode(uint64_t value) const {
+		auto largest = static_cast<int32_t>(value & 0x03);
+		auto mask = (uint64_t{ 1 } << _bitsPerComponent) - 1;
+		auto step = 2.0F * componentRange / static_cast<float>(mask);
+
+		float components[4];
+		float sum = 0.0F;
+		int32_t shift = 2;
+
+		for (int32_t i = 0; i < 4; ++i) {
+			if (i == largest)
+				continue;
+
+			auto component = static_cast<float>((value >> shift) & mask) * step - componentRange;
+			components[i] = component;
+			sum += component * component;
+			shift += _bitsPerComponent;
+		}
+
+		components[largest] = std::sqrt(MathHelper::Max(0.0F, 1.0F - sum));
+
+		return Quaternion(components[0], components[1], components[2], components[3]);
+	}
+
+	void QuaternionQuantizer::Write(BitWriter& writer, Quaternion const& value) const {
+		write(writer, Encode(value));
+	}
+
+	Quaternion QuaternionQuantizer::Read(BitReader& reader) const {
+		return Decode(read(reader));
+	}
+
+	void QuaternionQuantizer::Encode(vector<Quaternion> const& sourceArray, size_t sourceIndex, size_t length, BitWriter& writer) const {
+		for (size_t i = 0; i < length; ++i)
+			write(writer, Encode(sourceArray[sourceIndex + i]));
+	}
+
+	void QuaternionQuantizer::Encode(vector<Quaternion> const& sourceArray, BitWriter& writer) const {
+		Encode(sourceArray, 0, sourceArray.size(), writer);
+	}
+
+	void QuaternionQuantizer::Decode(BitReader& reader, vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length) const {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = Decode(read(reader));
+	}
+
+	void QuaternionQuantizer::Decode(BitReader& reader, vector<Quaternion>& destinationArray) const {
+		Decode(reader, destinationArray, 0, destinationArray.size());
+	}
+
+	void QuaternionQuantizer::EncodeDelta(vector<Quaternion> const& sourceArray, vector<Quaternion> const& baselineArray,
+		size_t sourceIndex, size_t length, BitWriter& writer) const {
+
+		auto mask = (uint64_t{ 1 } << _bitsPerComponent) - 1;
+
+		for (size_t i = 0; i < length; ++i) {
+			auto value = Encode(sourceArray[sourceIndex + i]);
+			auto baseline = Encode(baselineArray[sourceIndex + i]);
+			auto changed = value != baseline;
+
+			writer.Write(changed);
+
+			if (!changed)
+				continue;
+
+			// Stored components only line up when the same component was dropped.
+			auto sameLargest = (value & 0x03) == (baseline & 0x03);
+			writer.Write(sameLargest);
+
+			if (!sameLargest) {
+				write(writer, value);
+				continue;
+			}
+
+			for (int32_t shift = 2; shift < BitsPerValue(); shift += _bitsPerComponent) {
+				auto component = static_cast<uint32_t>((value >> shift) & mask);
+				auto difference = static_cast<int32_t>(component - static_cast<uint32_t>((baseline >> shift) & mask));
+				writer.Write(difference != 0);
+
+				if (difference == 0)
+					continue;
+
+				auto zigzag = (static_cast<uint32_t>(difference) << 1) ^ static_cast<uint32_t>(difference >> 31);
+				auto small = _deltaBits < _bitsPerComponent && zigzag < (1u << _deltaBits);
+
+				writer.Write(small);
+
+				if (small)
+					writer.Write(zigzag, _deltaBits);
+				else
+					writer.Write(component, _bitsPerComponent);
+			}
+		}
+	}
+
+	void QuaternionQuantizer::EncodeDelta(vector<Quaternion> const& sourceArray, vector<Quaternion> const& baselineArray, BitWriter& writer) const {
+		EncodeDelta(sourceArray, baselineArray, 0, sourceArray.size(), writer);
+	}
+
+	void QuaternionQuantizer::DecodeDelta(BitReader& reader, vector<Quaternion> const& baselineArray,
+		vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length) const {
+
+		auto mask = (uint64_t{ 1 } << _bitsPerComponent) - 1;
+
+		for (size_t i = 0; i < length; ++i) {
+			auto index = destinationIndex + i;
+			auto value = Encode(baselineArray[index]);
+
+			if (reader.ReadBoolean()) {
+				if (!reader.ReadBoolean()) {
+					destinationArray[index] = Decode(read(reader));
+					continue;
+				}
+
+				for (int32_t shift = 2; shift < BitsPerValue(); shift += _bitsPerComponent) {
+					if (!reader.ReadBoolean())
+						continue;
+
+					uint64_t component;
+
+					if (reader.ReadBoolean()) {
+						auto zigzag = reader.Read(_deltaBits);
+						auto difference = static_cast<int32_t>(zigzag >> 1) ^ -static_cast<int32_t>(zigzag & 1);
+						component = (((value >> shift) & mask) + static_cast<uint64_t>(static_cast<int64_t>(difference))) & mask;
+					}
+					else {
+						component = reader.Read(_bitsPerComponent);
+					}
+
+					value = (value & ~(mask << shift)) | (component << shift);
+				}
+			}
+
+			destinationArray[index] = Decode(value);
+		}
+	}
+
+	void QuaternionQuantizer::DecodeDelta(BitReader& reader, vector<Quaternion> const& baselineArray, vector<Quaternion>& destinationArray) const {
+		DecodeDelta(reader, baselineArray, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Private
+namespace Xna {
+	void QuaternionQuantizer::write(BitWriter& writer, uint64_t value) const {
+		auto bits = BitsPerValue();
+
+		if (bits > 32) {
+			writer.Write(static_cast<uint32_t>(value), 32);
+			writer.Write(static_cast<uint32_t>(value >> 32), bits - 32);
+		}
+		else {
+			writer.Write(static_cast<uint32_t>(value), bits);
+		}
+	}
+
+	uint64_t QuaternionQuantizer::read(BitReader& reader) const {
+		auto bits = BitsPerValue();
+
+		if (bits > 32) {
+			uint64_t low = reader.Read(32);
+			return low | (static_cast<uint64_t>(reader.Read(bits - 32)) << 32);
+		}
+
+		return reader.Read(bits);
+	}
+}
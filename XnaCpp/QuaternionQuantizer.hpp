@@ -0,0 +1,71 @@
+#ifndef _QUATERNIONQUANTIZER_HPP_
+#define _QUATERNIONQUANTIZER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Xna {
+
+	class BitReader;
+	class BitWriter;
+	struct Quaternion;
+
+	// Smallest-three compression of unit quaternions: 2 bits select the largest component, which is
+	// rebuilt from the unit length, and the other three are stored in BitsPerComponent() bits each.
+	// Zero, infinite and NaN quaternions are stored as the identity.
+	class QuaternionQuantizer {
+	public:
+		// With fewer bits the rebuilt component is often clamped to 0 and MaxError() no longer holds.
+		static constexpr int32_t MinBitsPerComponent = 3;
+		static constexpr int32_t MaxBitsPerComponent = 20;
+		static constexpr int32_t DefaultDeltaBits = 6;
+
+		QuaternionQuantizer();
+		QuaternionQuantizer(int32_t bitsPerComponent);
+
+		// Uses the fewest bits whose MaxError() does not exceed maxError.
+		static QuaternionQuantizer FromMaxError(float maxError);
+
+		int32_t BitsPerComponent() const;
+		int32_t BitsPerValue() const;
+
+		// Largest per-component difference between a normalized input and its decoded value, up to sign.
+		float MaxError() const;
+
+		// Zigzag-encoded differences below 2^DeltaBits() are sent in DeltaBits() bits by the delta encoder.
+		int32_t DeltaBits() const;
+		void DeltaBits(int32_t value);
+
+		uint64_t Encode(Quaternion const& value) const;
+		Quaternion Decode(uint64_t value) const;
+
+		void Write(BitWriter& writer, Quaternion const& value) const;
+		Quaternion Read(BitReader& reader) const;
+
+		void Encode(std::vector<Quaternion> const& sourceArray, size_t sourceIndex, size_t length, BitWriter& writer) const;
+		void Encode(std::vector<Quaternion> const& sourceArray, BitWriter& writer) const;
+		void Decode(BitReader& reader, std::vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length) const;
+		void Decode(BitReader& reader, std::vector<Quaternion>& destinationArray) const;
+
+		// Encodes each value against the baseline at the same index: one bit when unchanged, otherwise a bit for
+		// whether the dropped component is the same. If it is, each stored component follows as in Vector3Quantizer,
+		// with a bit for whether it changed and then a short difference or the full component; if not, the full value.
+		// Decoding requires the same baseline.
+		void EncodeDelta(std::vector<Quaternion> const& sourceArray, std::vector<Quaternion> const& baselineArray,
+			size_t sourceIndex, size_t length, BitWriter& writer) const;
+		void EncodeDelta(std::vector<Quaternion> const& sourceArray, std::vector<Quaternion> const& baselineArray, BitWriter& writer) const;
+		void DecodeDelta(BitReader& reader, std::vector<Quaternion> const& baselineArray,
+			std::vector<Quaternion>& destinationArray, size_t destinationIndex, size_t length) const;
+		void DecodeDelta(BitReader& reader, std::vector<Quaternion> const& baselineArray, std::vector<Quaternion>& destinationArray) const;
+
+	private:
+		int32_t _bitsPerComponent{ 10 };
+		int32_t _deltaBits{ DefaultDeltaBits };
+
+		void write(BitWriter& writer, uint64_t value) const;
+		uint64_t read(BitReader& reader) const;
+	};
+}
+
+#endif
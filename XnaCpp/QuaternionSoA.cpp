@@ -0,0 +1,53 @@
+#include "QuaternionSoA.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	QuaternionSoA::QuaternionSoA() {}
+
+	QuaternionSoA::QuaternionSoA(size_t size) {
+		Resize(size);
+	}
+
+	QuaternionSoA::QuaternionSoA(vector<Quaternion> const& values) {
+		Resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			Set(i, values[i]);
+	}
+}
+
+//Functions
+namespace Xna {
+	size_t QuaternionSoA::Size() const {
+		return W.size();
+	}
+
+	void QuaternionSoA::Resize(size_t size) {
+		X.resize(size);
+		Y.resize(size);
+		Z.resize(size);
+		W.resize(size);
+	}
+
+	Quaternion QuaternionSoA::Get(size_t index) const {
+		return Quaternion(X[index], Y[index], Z[index], W[index]);
+	}
+
+	void QuaternionSoA::Set(size_t index, Quaternion const& value) {
+		X[index] = value.X;
+		Y[index] = value.Y;
+		Z[index] = value.Z;
+		W[index] = value.W;
+	}
+
+	vector<Quaternion> QuaternionSoA::ToArray() const {
+		vector<Quaternion> values(Size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			values[i] = Get(i);
+
+		return values;
+	}
+}
@@ -0,0 +1,30 @@
+#ifndef _QUATERNIONSOA_HPP_
+#define _QUATERNIONSOA_HPP_
+
+#include <cstddef>
+#include <vector>
+#include "Quaternion.hpp"
+
+namespace Xna {
+
+	// Quaternions stored one component per array, the layout the batch blending kernels load directly.
+	struct QuaternionSoA {
+		std::vector<float> X;
+		std::vector<float> Y;
+		std::vector<float> Z;
+		std::vector<float> W;
+
+		QuaternionSoA();
+		QuaternionSoA(size_t size);
+		QuaternionSoA(std::vector<Quaternion> const& values);
+
+		size_t Size() const;
+		void Resize(size_t size);
+
+		Quaternion Get(size_t index) const;
+		void Set(size_t index, Quaternion const& value);
+		std::vector<Quaternion> ToArray() const;
+	};
+}
+
+#endif
@@ -3,9 +3,49 @@
 #include "BoundingBox.hpp"
 #include "BoundingSphere.hpp"
 #include "Plane.hpp"
+#include "Profiler.hpp"
+#include "SimdLanes.hpp"
+#include "Vector3A.hpp"
 
 using CSharp::Nullable;
 using CSharp::csnull;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+
+		// One slab of Ray::Intersects(BoundingBox). The direction is shared by every lane, so the near-parallel branch
+		// stays a branch; tMin and tMax hold NaN while null, exactly as Nullable<float> does.
+		template <typename TLanes>
+		void intersectSlab(float position, float direction, typename TLanes::Float min, typename TLanes::Float max,
+			typename TLanes::Float& tMin, typename TLanes::Float& tMax, typename TLanes::Float& miss) {
+			using L = TLanes;
+			auto origin = L::Set(position);
+
+			if (std::abs(direction) < 1e-6f) {
+				miss = L::Select(L::Less(origin, min), L::Equal(origin, origin), miss);
+				miss = L::Select(L::Greater(origin, max), L::Equal(origin, origin), miss);
+				return;
+			}
+
+			auto t1 = L::Div(L::Sub(min, origin), L::Set(direction));
+			auto t2 = L::Div(L::Sub(max, origin), L::Set(direction));
+			auto swap = L::Greater(t1, t2);
+			auto nearest = L::Select(swap, t2, t1);
+			auto farthest = L::Select(swap, t1, t2);
+
+			miss = L::Select(L::Greater(tMin, farthest), L::Equal(origin, origin), miss);
+			miss = L::Select(L::Greater(nearest, tMax), L::Equal(origin, origin), miss);
+			tMin = L::Select(L::Equal(tMin, tMin), L::Select(L::Greater(nearest, tMin), nearest, tMin), nearest);
+			tMax = L::Select(L::Equal(tMax, tMax), L::Select(L::Less(farthest, tMax), farthest, tMax), farthest);
+		}
+	}
+}
 
 namespace Xna {
 	Ray::Ray() {}
@@ -127,7 +167,7 @@ namespace Xna {
         
         auto dist = sphereRadiusSquared + distanceAlongRay * distanceAlongRay - differenceLengthSquared;
 
-        return (dist < 0) ? csnull : Nullable<float>(distanceAlongRay - sqrt(dist));
+        return (dist < 0) ? csnull : Nullable<float>(distanceAlongRay - std::sqrt(dist));
     }
 
     Nullable<float> Ray::Intersects(Plane const& plane) const {
@@ -150,6 +190,115 @@ namespace Xna {
         return result;
     }
 
+	void Ray::Intersects(vector<BoundingBox> const& boxes, size_t sourceIndex, vector<Nullable<float>>& results,
+		size_t destinationIndex, size_t length) const {
+		XNA_PROFILE_ZONE("Ray::Intersects");
+
+		if (!validRange(boxes.size(), sourceIndex, results.size(), destinationIndex, length))
+			return;
+
+		using L = Simd::BatchLanes;
+		constexpr auto width = L::Width;
+		auto null = L::Set(std::numeric_limits<float>::quiet_NaN());
+		auto zero = L::Set(0.0f);
+		size_t i = 0;
+
+		for (; i + width <= length; i += width) {
+			float bounds[6][width];
+
+			for (size_t j = 0; j < width; ++j) {
+				auto const& box = boxes[sourceIndex + i + j];
+				bounds[0][j] = box.Min.X;
+				bounds[1][j] = box.Min.Y;
+				bounds[2][j] = box.Min.Z;
+				bounds[3][j] = box.Max.X;
+				bounds[4][j] = box.Max.Y;
+				bounds[5][j] = box.Max.Z;
+			}
+
+			auto tMin = null;
+			auto tMax = null;
+			auto miss = zero;
+			intersectSlab<L>(Position.X, Direction.X, L::Load(bounds[0]), L::Load(bounds[3]), tMin, tMax, miss);
+			intersectSlab<L>(Position.Y, Direction.Y, L::Load(bounds[1]), L::Load(bounds[4]), tMin, tMax, miss);
+			intersectSlab<L>(Position.Z, Direction.Z, L::Load(bounds[2]), L::Load(bounds[5]), tMin, tMax, miss);
+
+			// Starting inside the box gives 0; a box behind the ray or a null tMin gives null.
+			auto result = L::Select(L::Less(tMin, zero), null, tMin);
+			result = L::Select(L::Less(tMin, zero), L::Select(L::Greater(tMax, zero), zero, result), result);
+			result = L::Select(miss, null, result);
+
+			float values[width];
+			L::Store(values, result);
+
+			for (size_t j = 0; j < width; ++j)
+				results[destinationIndex + i + j] = values[j];
+		}
+
+		for (; i < length; ++i)
+			results[destinationIndex + i] = Intersects(boxes[sourceIndex + i]);
+	}
+
+	void Ray::Intersects(vector<BoundingBox> const& boxes, vector<Nullable<float>>& results) const {
+		Intersects(boxes, 0, results, 0, results.size());
+	}
+
+	void Ray::Intersects(AlignedVector<Vector3A> const& spheres, size_t sourceIndex, vector<Nullable<float>>& results,
+		size_t destinationIndex, size_t length) const {
+		XNA_PROFILE_ZONE("Ray::Intersects");
+
+		if (!validRange(spheres.size(), sourceIndex, results.size(), destinationIndex, length))
+			return;
+
+		using L = Simd::BatchLanes;
+		constexpr auto width = L::Width;
+		auto null = L::Set(std::numeric_limits<float>::quiet_NaN());
+		auto zero = L::Set(0.0f);
+		size_t i = 0;
+
+		for (; i + width <= length; i += width) {
+			float packed[4][width];
+
+			for (size_t j = 0; j < width; ++j) {
+				auto const& sphere = spheres[sourceIndex + i + j];
+				packed[0][j] = sphere.X;
+				packed[1][j] = sphere.Y;
+				packed[2][j] = sphere.Z;
+				packed[3][j] = sphere.W;
+			}
+
+			auto x = L::Sub(L::Load(packed[0]), L::Set(Position.X));
+			auto y = L::Sub(L::Load(packed[1]), L::Set(Position.Y));
+			auto z = L::Sub(L::Load(packed[2]), L::Set(Position.Z));
+			auto radius = L::Load(packed[3]);
+
+			auto lengthSquared = L::Add(L::Add(L::Mul(x, x), L::Mul(y, y)), L::Mul(z, z));
+			auto radiusSquared = L::Mul(radius, radius);
+			auto along = L::Add(L::Add(L::Mul(L::Set(Direction.X), x), L::Mul(L::Set(Direction.Y), y)), L::Mul(L::Set(Direction.Z), z));
+			auto distance = L::Sub(L::Add(radiusSquared, L::Mul(along, along)), lengthSquared);
+
+			auto result = L::Sub(along, L::Sqrt(distance));
+			result = L::Select(L::Less(distance, zero), null, result);
+			result = L::Select(L::Less(along, zero), null, result);
+			result = L::Select(L::Less(lengthSquared, radiusSquared), zero, result);
+
+			float values[width];
+			L::Store(values, result);
+
+			for (size_t j = 0; j < width; ++j)
+				results[destinationIndex + i + j] = values[j];
+		}
+
+		for (; i < length; ++i) {
+			auto const& sphere = spheres[sourceIndex + i];
+			results[destinationIndex + i] = Intersects(BoundingSphere(sphere.ToVector3(), sphere.W));
+		}
+	}
+
+	void Ray::Intersects(AlignedVector<Vector3A> const& spheres, vector<Nullable<float>>& results) const {
+		Intersects(spheres, 0, results, 0, results.size());
+	}
+
     void Ray::Deconstruct(Vector3& position, Vector3& direction) const {
         position = Position;
         direction = Direction;
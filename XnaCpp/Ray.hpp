@@ -1,6 +1,9 @@
 #ifndef _RAY_HPP_
 #define _RAY_HPP_
 
+#include <cstddef>
+#include <vector>
+#include "Aligned.hpp"
 #include "Vector3.hpp"
 #include "CSharp/Nullable.hpp"
 
@@ -9,6 +12,7 @@ namespace Xna {
 	struct BoundingBox;
 	struct BoundingSphere;
 	struct Plane;
+	struct Vector3A;
 
 	struct Ray {
 		Vector3 Direction{ Vector3::Zero };
@@ -24,6 +28,14 @@ namespace Xna {
 		CSharp::Nullable<float> Intersects(BoundingBox const& box) const;
 		CSharp::Nullable<float> Intersects(BoundingSphere const& sphere) const;
 		CSharp::Nullable<float> Intersects(Plane const& plane) const;
+		// The same tests against arrays, several volumes per SIMD step, with identical results. Spheres are packed as
+		// Vector3A centers with the radius in W.
+		void Intersects(std::vector<BoundingBox> const& boxes, size_t sourceIndex, std::vector<CSharp::Nullable<float>>& results,
+			size_t destinationIndex, size_t length) const;
+		void Intersects(std::vector<BoundingBox> const& boxes, std::vector<CSharp::Nullable<float>>& results) const;
+		void Intersects(AlignedVector<Vector3A> const& spheres, size_t sourceIndex, std::vector<CSharp::Nullable<float>>& results,
+			size_t destinationIndex, size_t length) const;
+		void Intersects(AlignedVector<Vector3A> const& spheres, std::vector<CSharp::Nullable<float>>& results) const;
 
 		void Deconstruct(Vector3& position, Vector3& direction) const;
 	};
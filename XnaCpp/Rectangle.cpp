@@ -2,9 +2,24 @@
 #include "Rectangle.hpp"
 #include "Point.hpp"
 #include "Vector2.hpp"
+#include "Matrix3x2.hpp"
+#include "Profiler.hpp"
+#include "SimdDispatch.hpp"
+#include "SimdKernels.hpp"
 
 using std::min;
 using std::max;
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+	}
+}
 
 namespace Xna {
 	const Rectangle Rectangle::Empty = Rectangle();
@@ -58,6 +73,24 @@ namespace Xna {
 			max(a.Right(), b.Right()) - x,
 			max(a.Bottom(), b.Bottom()) - y);
 	}
+
+	Rectangle Rectangle::Transform(Rectangle const& rectangle, Matrix3x2 const& matrix) {
+		Rectangle result;
+		transformRectangles<Simd::ScalarLanes>(&rectangle, matrix, &result);
+		return result;
+	}
+
+	void Rectangle::Transform(vector<Rectangle> const& sourceArray, size_t sourceIndex, Matrix3x2 const& matrix,
+		vector<Rectangle>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Rectangle::Transform");
+
+		if (length != 0 && validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			Simd::Dispatch::Active().TransformRectangles(&sourceArray[sourceIndex], matrix, &destinationArray[destinationIndex], length);
+	}
+
+	void Rectangle::Transform(vector<Rectangle> const& sourceArray, Matrix3x2 const& matrix, vector<Rectangle>& destinationArray) {
+		Transform(sourceArray, 0, matrix, destinationArray, 0, destinationArray.size());
+	}
 }
 
 //Functions
@@ -2,9 +2,12 @@
 #define _RECTANGLE_HPP_
 
 #include <stdint.h>
+#include <cstddef>
+#include <vector>
 
 namespace Xna {
 
+	struct Matrix3x2;
 	struct Point;
 	struct Vector2;
 
@@ -26,6 +29,13 @@ namespace Xna {
 
 		static Rectangle Intersect(Rectangle a, Rectangle b);
 		static Rectangle Union(Rectangle a, Rectangle b);
+		// Smallest rectangle holding the four transformed corners, edges rounded outward. NaN edges give 0 and
+		// coordinates beyond the int32_t range saturate.
+		static Rectangle Transform(Rectangle const& rectangle, Matrix3x2 const& matrix);
+		// Runs on SIMD lanes; does nothing for out-of-range indices.
+		static void Transform(std::vector<Rectangle> const& sourceArray, size_t sourceIndex, Matrix3x2 const& matrix,
+			std::vector<Rectangle>& destinationArray, size_t destinationIndex, size_t length);
+		static void Transform(std::vector<Rectangle> const& sourceArray, Matrix3x2 const& matrix, std::vector<Rectangle>& destinationArray);
 
 		int32_t Left() const;
 		int32_t Right() const;
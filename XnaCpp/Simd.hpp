@@ -0,0 +1,37 @@
+#ifndef _SIMD_HPP_
+#define _SIMD_HPP_
+
+// Compile-time instruction set detection shared by the batch kernels.
+// Every kernel keeps a scalar path, so the library still builds when none of these are defined.
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define XNA_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+#define XNA_SSE41 1
+#include <smmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define XNA_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define XNA_F16C 1
+#include <immintrin.h>
+#endif
+
+// Names an inline namespace for headers with inline SIMD code. SimdDispatch builds some translation units with
+// wider instruction sets than the rest; distinct symbols keep the linker from merging those copies into baseline code.
+#if XNA_AVX2
+#define XNA_SIMD_TARGET Avx2Target
+#elif XNA_SSE2
+#define XNA_SIMD_TARGET Sse2Target
+#else
+#define XNA_SIMD_TARGET ScalarTarget
+#endif
+
+#endif
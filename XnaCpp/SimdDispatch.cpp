@@ -0,0 +1,279 @@
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include "SimdDispatch.hpp"
+#include "SimdKernels.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define XNA_CPUID 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define XNA_CPUID 1
+#endif
+
+using std::string;
+
+//Private
+namespace Xna::Simd {
+#if XNA_DISPATCH_AVX2 && !XNA_AVX2
+	// Defined in SimdDispatchAvx2.cpp.
+	Kernels const* Avx2Kernels();
+#endif
+
+	namespace {
+#if XNA_CPUID
+		void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t(&registers)[4]) {
+#if defined(_MSC_VER)
+			int values[4];
+			__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+			for (size_t i = 0; i < 4; ++i)
+				registers[i] = static_cast<uint32_t>(values[i]);
+#else
+			__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+		}
+
+		// XCR0: which register states the operating system saves on context switches.
+		uint64_t xgetbv() {
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			uint32_t low;
+			uint32_t high;
+			__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+		}
+
+		bool bit(uint32_t value, int32_t index) {
+			return ((value >> index) & 1) != 0;
+		}
+#endif
+
+		CpuFeatures const& features() {
+			static CpuFeatures const detected = CpuFeatures::Detect();
+			return detected;
+		}
+
+		// Null when the kernels for set were not built.
+		Kernels const* table(InstructionSet set) {
+			static Kernels const scalar = makeKernels<ScalarLanes>(InstructionSet::Scalar);
+
+			switch (set) {
+			case InstructionSet::Scalar:
+				return &scalar;
+			case InstructionSet::Sse2: {
+#if XNA_SSE2
+				static Kernels const sse2 = makeKernels<Sse2Lanes>(InstructionSet::Sse2);
+				return &sse2;
+#else
+				return nullptr;
+#endif
+			}
+			case InstructionSet::Avx2: {
+#if XNA_AVX2
+				static Kernels const avx2 = makeKernels<Avx2Lanes>(InstructionSet::Avx2);
+				return &avx2;
+#elif XNA_DISPATCH_AVX2
+				return Avx2Kernels();
+#else
+				return nullptr;
+#endif
+			}
+			}
+
+			return nullptr;
+		}
+
+		bool built(InstructionSet set) {
+			switch (set) {
+			case InstructionSet::Scalar:
+				return true;
+			case InstructionSet::Sse2:
+#if XNA_SSE2
+				return true;
+#else
+				return false;
+#endif
+			case InstructionSet::Avx2:
+#if XNA_AVX2 || XNA_DISPATCH_AVX2
+				return true;
+#else
+				return false;
+#endif
+			}
+
+			return false;
+		}
+
+		bool supported(InstructionSet set) {
+			switch (set) {
+			case InstructionSet::Scalar:
+				return true;
+			case InstructionSet::Sse2:
+				return features().Sse2;
+			case InstructionSet::Avx2:
+				// The AVX2 translation unit is also built with F16C for the half float kernels.
+				return features().Avx2 && features().F16c;
+			}
+
+			return false;
+		}
+
+		InstructionSet automatic() {
+			for (auto set : { InstructionSet::Avx2, InstructionSet::Sse2 }) {
+				if (Dispatch::IsAvailable(set))
+					return set;
+			}
+
+			return InstructionSet::Scalar;
+		}
+
+		bool parse(char const* text, InstructionSet& set) {
+			string name;
+
+			for (; *text != '\0'; ++text)
+				name.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*text))));
+
+			for (auto candidate : { InstructionSet::Scalar, InstructionSet::Sse2, InstructionSet::Avx2 }) {
+				if (name == Dispatch::Name(candidate)) {
+					set = candidate;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		std::atomic<bool> forced{ false };
+
+		Kernels const* initial() {
+			auto set = automatic();
+			auto name = std::getenv("XNA_FORCE_ISA");
+			InstructionSet requested;
+
+			if (name != nullptr && parse(name, requested) && Dispatch::IsAvailable(requested)) {
+				set = requested;
+				forced = true;
+			}
+
+			return table(set);
+		}
+
+		std::atomic<Kernels const*>& active() {
+			static std::atomic<Kernels const*> kernels{ initial() };
+			return kernels;
+		}
+	}
+}
+
+//Static
+namespace Xna::Simd {
+	CpuFeatures CpuFeatures::Detect() {
+		CpuFeatures result;
+#if XNA_CPUID
+		uint32_t registers[4];
+		cpuid(0, 0, registers);
+		auto maxLeaf = registers[0];
+
+		if (maxLeaf < 1)
+			return result;
+
+		cpuid(1, 0, registers);
+		auto ecx = registers[2];
+		auto state = bit(ecx, 27) ? xgetbv() : 0;
+		// AVX needs the XMM and YMM states saved; AVX-512 also the opmask and ZMM states.
+		auto ymm = (state & 0x06) == 0x06;
+		auto zmm = (state & 0xE6) == 0xE6;
+
+		result.Sse2 = bit(registers[3], 26);
+		result.Sse41 = bit(ecx, 19);
+		result.Avx = ymm && bit(ecx, 28);
+		result.Fma = result.Avx && bit(ecx, 12);
+		result.F16c = result.Avx && bit(ecx, 29);
+
+		if (maxLeaf >= 7) {
+			cpuid(7, 0, registers);
+			result.Avx2 = result.Avx && bit(registers[1], 5);
+			result.Avx512F = zmm && bit(registers[1], 16);
+		}
+#endif
+		return result;
+	}
+
+	Kernels const& Dispatch::Active() {
+		return *active().load(std::memory_order_acquire);
+	}
+
+	InstructionSet Dispatch::Selected() {
+		return Active().Set;
+	}
+
+	InstructionSet Dispatch::Supported() {
+		return automatic();
+	}
+
+	bool Dispatch::IsAvailable(InstructionSet set) {
+		// The processor is checked first: building the AVX2 table already runs AVX2 code.
+		return built(set) && supported(set) && table(set) != nullptr;
+	}
+
+	bool Dispatch::Force(InstructionSet set) {
+		if (!IsAvailable(set))
+			return false;
+
+		active().store(table(set), std::memory_order_release);
+		forced = true;
+		return true;
+	}
+
+	void Dispatch::Reset() {
+		active().store(table(automatic()), std::memory_order_release);
+		forced = false;
+	}
+
+	string Dispatch::Report() {
+		auto const& cpu = features();
+		string report = "SIMD: processor";
+		std::pair<bool, char const*> const flags[] = {
+			{ cpu.Sse2, " sse2" }, { cpu.Sse41, " sse4.1" }, { cpu.Avx, " avx" }, { cpu.Avx2, " avx2" },
+			{ cpu.Fma, " fma" }, { cpu.F16c, " f16c" }, { cpu.Avx512F, " avx512f" } };
+
+		for (auto const& flag : flags) {
+			if (flag.first)
+				report += flag.second;
+		}
+
+		report += "; kernels built";
+
+		for (auto set : { InstructionSet::Scalar, InstructionSet::Sse2, InstructionSet::Avx2 }) {
+			if (built(set)) {
+				report += ' ';
+				report += Name(set);
+			}
+		}
+
+		report += "; selected ";
+		report += Name(Selected());
+		report += forced ? " (forced)" : " (automatic)";
+
+		return report;
+	}
+
+	char const* Dispatch::Name(InstructionSet set) {
+		switch (set) {
+		case InstructionSet::Scalar:
+			return "scalar";
+		case InstructionSet::Sse2:
+			return "sse2";
+		case InstructionSet::Avx2:
+			return "avx2";
+		}
+
+		return "unknown";
+	}
+}
@@ -0,0 +1,86 @@
+#ifndef _SIMDDISPATCH_HPP_
+#define _SIMDDISPATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Xna {
+	struct Matrix;
+	struct Matrix3x2;
+	struct Plane;
+	struct Rectangle;
+	struct Vector2;
+	struct Vector3;
+	struct Vector3A;
+	enum class ContainmentType;
+}
+
+namespace Xna::Simd {
+
+	// Instruction sets with a kernel table, from least to most capable.
+	enum class InstructionSet {
+		Scalar,
+		Sse2,
+		Avx2
+	};
+
+	// What the running processor and operating system support, from CPUID and XGETBV.
+	struct CpuFeatures {
+		bool Sse2{ false };
+		bool Sse41{ false };
+		bool Avx{ false };
+		bool Avx2{ false };
+		bool Fma{ false };
+		bool F16c{ false };
+		bool Avx512F{ false };
+
+		static CpuFeatures Detect();
+	};
+
+	// Batch kernels built for one instruction set. Each gives the same bits as the scalar functions it replaces.
+	struct Kernels {
+		InstructionSet Set{ InstructionSet::Scalar };
+		void (*TransformVector2)(Vector2 const* source, Matrix3x2 const& matrix, Vector2* destination, size_t length){ nullptr };
+		void (*TransformNormalVector2)(Vector2 const* source, Matrix3x2 const& matrix, Vector2* destination, size_t length){ nullptr };
+		void (*TransformVector3)(Vector3 const* source, Matrix const& matrix, Vector3* destination, size_t length){ nullptr };
+		void (*MultiplyMatrix)(Matrix const* source, Matrix const& matrix, Matrix* destination, size_t length){ nullptr };
+		void (*MultiplyMatrices)(Matrix const* source1, Matrix const* source2, Matrix* destination, size_t length){ nullptr };
+		// Writes each inverse and its determinant; singular inputs give non-finite results.
+		void (*InvertMatrices)(Matrix const* source, Matrix* destination, float* determinants, size_t length){ nullptr };
+		// planes holds BoundingFrustum::PlaneCount planes; spheres are centers with the radius in W.
+		void (*ContainsSpheres)(Plane const* planes, Vector3A const* spheres, ContainmentType* results, size_t length){ nullptr };
+		// Writes the smallest rectangle holding each source rectangle's four transformed corners.
+		void (*TransformRectangles)(Rectangle const* source, Matrix3x2 const& matrix, Rectangle* destination, size_t length){ nullptr };
+		void (*SrgbToLinear)(float const* source, float* destination, size_t count){ nullptr };
+		void (*LinearToSrgb)(float const* source, float* destination, size_t count){ nullptr };
+		// FixedVector3<Fixed16>::Transform over raw Q16.16 X, Y, Z triples. matrix holds the three columns of the
+		// upper 3x3, then the translation, also raw. Null in the scalar table.
+		void (*TransformFixed16)(int32_t const* source, int32_t const* matrix, int32_t* destination, size_t length){ nullptr };
+		// Convert the longest prefix they can to or from half floats and return its length. Null in tables built
+		// without F16C.
+		size_t (*ToHalf)(float const* source, void* destination, size_t count){ nullptr };
+		size_t (*FromHalf)(void const* source, float* destination, size_t count){ nullptr };
+	};
+
+	// Picks the kernel table on first use: the best instruction set both built into the library and supported by the
+	// processor, unless the XNA_FORCE_ISA environment variable names another one (scalar, sse2 or avx2).
+	// The AVX2 kernels are compiled in their own translation unit, so one binary serves processors with and without it.
+	class Dispatch {
+	public:
+		static Kernels const& Active();
+		static InstructionSet Selected();
+		// Best instruction set usable on this processor.
+		static InstructionSet Supported();
+		static bool IsAvailable(InstructionSet set);
+		// Switches every batch kernel to set; returns false, leaving the selection unchanged, when set is unavailable.
+		static bool Force(InstructionSet set);
+		// Returns to the automatic choice, ignoring XNA_FORCE_ISA.
+		static void Reset();
+		// One line naming the processor features and the selected kernels, for startup logs.
+		static std::string Report();
+		static char const* Name(InstructionSet set);
+	};
+}
+
+#endif
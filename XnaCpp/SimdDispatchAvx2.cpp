@@ -0,0 +1,16 @@
+// Built with AVX2 enabled (see CMakeLists.txt); only reached after SimdDispatch has checked the processor.
+#include "SimdDispatch.hpp"
+#include "SimdKernels.hpp"
+
+#if XNA_DISPATCH_AVX2
+#if !XNA_AVX2
+#error "SimdDispatchAvx2.cpp must be compiled with AVX2 enabled"
+#endif
+
+namespace Xna::Simd {
+	Kernels const* Avx2Kernels() {
+		static Kernels const kernels = makeKernels<Avx2Lanes>(InstructionSet::Avx2);
+		return &kernels;
+	}
+}
+#endif
@@ -0,0 +1,828 @@
+#ifndef _SIMDKERNELS_HPP_
+#define _SIMDKERNELS_HPP_
+
+// Kernel bodies for the SimdDispatch tables, included by translation units built with different instruction set
+// flags. Everything has internal linkage so the copies never merge at link time; SimdLanes.hpp keeps its lane types
+// apart the same way.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "ContainmentType.hpp"
+#include "Graphics/PackedVector/HalfTypeHelper.hpp"
+#include "Matrix.hpp"
+#include "Matrix3x2.hpp"
+#include "Plane.hpp"
+#include "Rectangle.hpp"
+#include "SimdDispatch.hpp"
+#include "SimdLanes.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector3A.hpp"
+
+namespace Xna {
+	namespace {
+#if XNA_SSE2
+		// Matrix rows held in 128-bit registers; the AVX type carries two matrices, one per 128-bit half.
+		struct Sse2Rows {
+			using Float = __m128;
+
+			static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+			static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+			static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+			static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+			static Float AdjugateSigns() { return _mm_setr_ps(1.0F, -1.0F, -1.0F, 1.0F); }
+
+			template <int TMask>
+			static Float Shuffle(Float a, Float b) { return _mm_shuffle_ps(a, b, TMask); }
+		};
+#endif
+
+#if XNA_AVX2
+		struct Avx2Rows {
+			using Float = __m256;
+
+			static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+			static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+			static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+			static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+			static Float AdjugateSigns() { return _mm256_setr_ps(1.0F, -1.0F, -1.0F, 1.0F, 1.0F, -1.0F, -1.0F, 1.0F); }
+
+			template <int TMask>
+			static Float Shuffle(Float a, Float b) { return _mm256_shuffle_ps(a, b, TMask); }
+		};
+#endif
+
+#if XNA_SSE2
+		template <typename TRows, int TX, int TY, int TZ, int TW>
+		typename TRows::Float shuffle(typename TRows::Float a, typename TRows::Float b) {
+			return TRows::template Shuffle<TX | (TY << 2) | (TZ << 4) | (TW << 6)>(a, b);
+		}
+
+		// 2x2 blocks are stored row-major in one register; # is the adjugate.
+		// A * B
+		template <typename TRows>
+		typename TRows::Float multiply2(typename TRows::Float a, typename TRows::Float b) {
+			return TRows::Add(TRows::Mul(a, shuffle<TRows, 0, 3, 0, 3>(b, b)),
+				TRows::Mul(shuffle<TRows, 1, 0, 3, 2>(a, a), shuffle<TRows, 2, 1, 2, 1>(b, b)));
+		}
+
+		// A# * B
+		template <typename TRows>
+		typename TRows::Float adjugateMultiply2(typename TRows::Float a, typename TRows::Float b) {
+			return TRows::Sub(TRows::Mul(shuffle<TRows, 3, 3, 0, 0>(a, a), b),
+				TRows::Mul(shuffle<TRows, 1, 1, 2, 2>(a, a), shuffle<TRows, 2, 3, 0, 1>(b, b)));
+		}
+
+		// A * B#
+		template <typename TRows>
+		typename TRows::Float multiplyAdjugate2(typename TRows::Float a, typename TRows::Float b) {
+			return TRows::Sub(TRows::Mul(a, shuffle<TRows, 3, 0, 3, 0>(b, b)),
+				TRows::Mul(shuffle<TRows, 1, 0, 3, 2>(a, a), shuffle<TRows, 2, 1, 2, 1>(b, b)));
+		}
+
+		// Blocked inverse of M = | A B ; C D |: |M| = |A||D| + |B||C| - tr((A#B)(D#C)), and each block of the
+		// adjugate reuses the products A#B and D#C. Replaces rows with the inverse and returns |M| in every lane.
+		template <typename TRows>
+		typename TRows::Float invertRows(typename TRows::Float(&rows)[4]) {
+			using T = TRows;
+
+			auto a = shuffle<T, 0, 1, 0, 1>(rows[0], rows[1]);
+			auto b = shuffle<T, 2, 3, 2, 3>(rows[0], rows[1]);
+			auto c = shuffle<T, 0, 1, 0, 1>(rows[2], rows[3]);
+			auto d = shuffle<T, 2, 3, 2, 3>(rows[2], rows[3]);
+
+			// (|A|, |B|, |C|, |D|)
+			auto determinants = T::Sub(
+				T::Mul(shuffle<T, 0, 2, 0, 2>(rows[0], rows[2]), shuffle<T, 1, 3, 1, 3>(rows[1], rows[3])),
+				T::Mul(shuffle<T, 1, 3, 1, 3>(rows[0], rows[2]), shuffle<T, 0, 2, 0, 2>(rows[1], rows[3])));
+			auto detA = shuffle<T, 0, 0, 0, 0>(determinants, determinants);
+			auto detB = shuffle<T, 1, 1, 1, 1>(determinants, determinants);
+			auto detC = shuffle<T, 2, 2, 2, 2>(determinants, determinants);
+			auto detD = shuffle<T, 3, 3, 3, 3>(determinants, determinants);
+
+			auto dc = adjugateMultiply2<T>(d, c);
+			auto ab = adjugateMultiply2<T>(a, b);
+			auto x = T::Sub(T::Mul(detD, a), multiply2<T>(b, dc));
+			auto w = T::Sub(T::Mul(detA, d), multiply2<T>(c, ab));
+			auto y = T::Sub(T::Mul(detB, c), multiplyAdjugate2<T>(d, ab));
+			auto z = T::Sub(T::Mul(detC, b), multiplyAdjugate2<T>(a, dc));
+
+			auto trace = T::Mul(ab, shuffle<T, 0, 2, 1, 3>(dc, dc));
+			trace = T::Add(trace, shuffle<T, 1, 0, 3, 2>(trace, trace));
+			trace = T::Add(trace, shuffle<T, 2, 3, 0, 1>(trace, trace));
+
+			auto determinant = T::Sub(T::Add(T::Mul(detA, detD), T::Mul(detB, detC)), trace);
+			auto reciprocal = T::Div(T::AdjugateSigns(), determinant);
+			x = T::Mul(x, reciprocal);
+			y = T::Mul(y, reciprocal);
+			z = T::Mul(z, reciprocal);
+			w = T::Mul(w, reciprocal);
+
+			// The final shuffles also turn each adjugate block back into rows.
+			rows[0] = shuffle<T, 3, 1, 3, 1>(x, y);
+			rows[1] = shuffle<T, 2, 0, 2, 0>(x, y);
+			rows[2] = shuffle<T, 3, 1, 3, 1>(z, w);
+			rows[3] = shuffle<T, 2, 0, 2, 0>(z, w);
+
+			return determinant;
+		}
+#endif
+
+		inline float invertScalar(Matrix const& matrix, Matrix& result) {
+			auto num1 = matrix.M11;
+			auto num2 = matrix.M12;
+			auto num3 = matrix.M13;
+			auto num4 = matrix.M14;
+			auto num5 = matrix.M21;
+			auto num6 = matrix.M22;
+			auto num7 = matrix.M23;
+			auto num8 = matrix.M24;
+			auto num9 = matrix.M31;
+			auto num10 = matrix.M32;
+			auto num11 = matrix.M33;
+			auto num12 = matrix.M34;
+			auto num13 = matrix.M41;
+			auto num14 = matrix.M42;
+			auto num15 = matrix.M43;
+			auto num16 = matrix.M44;
+
+			auto num17 = (num11 * num16 - num12 * num15);
+			auto num18 = (num10 * num16 - num12 * num14);
+			auto num19 = (num10 * num15 - num11 * num14);
+			auto num20 = (num9 * num16 - num12 * num13);
+			auto num21 = (num9 * num15 - num11 * num13);
+			auto num22 = (num9 * num14 - num10 * num13);
+			auto num23 = (num6 * num17 - num7 * num18 + num8 * num19);
+			auto num24 = -(num5 * num17 - num7 * num20 + num8 * num21);
+			auto num25 = (num5 * num18 - num6 * num20 + num8 * num22);
+			auto num26 = -(num5 * num19 - num6 * num21 + num7 * num22);
+			auto determinant = num1 * num23 + num2 * num24 + num3 * num25 + num4 * num26;
+			auto num27 = 1.0F / determinant;
+
+			result.M11 = num23 * num27;
+			result.M21 = num24 * num27;
+			result.M31 = num25 * num27;
+			result.M41 = num26 * num27;
+			result.M12 = -(num2 * num17 - num3 * num18 + num4 * num19) * num27;
+			result.M22 = (num1 * num17 - num3 * num20 + num4 * num21) * num27;
+			result.M32 = -(num1 * num18 - num2 * num20 + num4 * num22) * num27;
+			result.M42 = (num1 * num19 - num2 * num21 + num3 * num22) * num27;
+
+			auto num28 = (num7 * num16 - num8 * num15);
+			auto num29 = (num6 * num16 - num8 * num14);
+			auto num30 = (num6 * num15 - num7 * num14);
+			auto num31 = (num5 * num16 - num8 * num13);
+			auto num32 = (num5 * num15 - num7 * num13);
+			auto num33 = (num5 * num14 - num6 * num13);
+			result.M13 = (num2 * num28 - num3 * num29 + num4 * num30) * num27;
+			result.M23 = -(num1 * num28 - num3 * num31 + num4 * num32) * num27;
+			result.M33 = (num1 * num29 - num2 * num31 + num4 * num33) * num27;
+			result.M43 = -(num1 * num30 - num2 * num32 + num3 * num33) * num27;
+
+			auto num34 = (num7 * num12 - num8 * num11);
+			auto num35 = (num6 * num12 - num8 * num10);
+			auto num36 = (num6 * num11 - num7 * num10);
+			auto num37 = (num5 * num12 - num8 * num9);
+			auto num38 = (num5 * num11 - num7 * num9);
+			auto num39 = (num5 * num10 - num6 * num9);
+			result.M14 = -(num2 * num34 - num3 * num35 + num4 * num36) * num27;
+			result.M24 = (num1 * num34 - num3 * num37 + num4 * num38) * num27;
+			result.M34 = -(num1 * num35 - num2 * num37 + num4 * num39) * num27;
+			result.M44 = (num1 * num36 - num2 * num38 + num3 * num39) * num27;
+
+			return determinant;
+		}
+
+#if XNA_SSE2
+		inline float invertSse2(Matrix const& matrix, Matrix& result) {
+			auto source = &matrix.M11;
+			__m128 rows[4] = { _mm_load_ps(source), _mm_load_ps(source + 4), _mm_load_ps(source + 8), _mm_load_ps(source + 12) };
+			auto determinant = invertRows<Sse2Rows>(rows);
+
+			auto destination = &result.M11;
+			_mm_store_ps(destination, rows[0]);
+			_mm_store_ps(destination + 4, rows[1]);
+			_mm_store_ps(destination + 8, rows[2]);
+			_mm_store_ps(destination + 12, rows[3]);
+
+			return _mm_cvtss_f32(determinant);
+		}
+#endif
+
+		// Inverts into result and returns the determinant; singular inputs give non-finite results.
+		inline float invert(Matrix const& matrix, Matrix& result) {
+#if XNA_SSE2
+			return invertSse2(matrix, result);
+#else
+			return invertScalar(matrix, result);
+#endif
+		}
+
+		// Row i of the product is a_i1 * b_1 + a_i2 * b_2 + a_i3 * b_3 + a_i4 * b_4, summed in the order Multiply uses,
+		// so every path gives the same bits. The rows of b are loaded first, so destination may alias either input.
+		inline void multiply(Simd::ScalarLanes, Matrix const& matrix1, Matrix const& matrix2, Matrix& destination) {
+			destination = Matrix::Multiply(matrix1, matrix2);
+		}
+
+#if XNA_SSE2
+		inline void multiply(Simd::Sse2Lanes, Matrix const& matrix1, Matrix const& matrix2, Matrix& destination) {
+			auto a = &matrix1.M11;
+			auto b = &matrix2.M11;
+			auto b1 = _mm_load_ps(b);
+			auto b2 = _mm_load_ps(b + 4);
+			auto b3 = _mm_load_ps(b + 8);
+			auto b4 = _mm_load_ps(b + 12);
+
+			for (size_t row = 0; row < 16; row += 4) {
+				auto values = _mm_load_ps(a + row);
+				auto result = _mm_mul_ps(_mm_shuffle_ps(values, values, 0x00), b1);
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(values, values, 0x55), b2));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(values, values, 0xAA), b3));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(values, values, 0xFF), b4));
+				_mm_store_ps(&destination.M11 + row, result);
+			}
+		}
+#endif
+
+#if XNA_AVX2
+		inline void multiply(Simd::Avx2Lanes, Matrix const& matrix1, Matrix const& matrix2, Matrix& destination) {
+			auto a = &matrix1.M11;
+			auto b = reinterpret_cast<__m128 const*>(&matrix2.M11);
+			auto b1 = _mm256_broadcast_ps(b);
+			auto b2 = _mm256_broadcast_ps(b + 1);
+			auto b3 = _mm256_broadcast_ps(b + 2);
+			auto b4 = _mm256_broadcast_ps(b + 3);
+
+			// Two rows per register.
+			for (size_t row = 0; row < 16; row += 8) {
+				auto rows = _mm256_loadu_ps(a + row);
+				auto result = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x00), b1);
+				result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0x55), b2));
+				result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xAA), b3));
+				result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, 0xFF), b4));
+				_mm256_storeu_ps(&destination.M11 + row, result);
+			}
+		}
+#endif
+
+		// The widest form this translation unit is built for.
+		inline void multiply(Matrix const& matrix1, Matrix const& matrix2, Matrix& destination) {
+			multiply(Simd::BatchLanes(), matrix1, matrix2, destination);
+		}
+
+		// Matrix::Invert's own path, so a forced scalar table still matches the single-matrix results.
+		inline void invertMatrices(Simd::ScalarLanes, Matrix const* source, Matrix* destination, float* determinants, size_t length) {
+			for (size_t i = 0; i < length; ++i)
+				determinants[i] = invert(source[i], destination[i]);
+		}
+
+#if XNA_SSE2
+		inline void invertMatrices(Simd::Sse2Lanes, Matrix const* source, Matrix* destination, float* determinants, size_t length) {
+			for (size_t i = 0; i < length; ++i)
+				determinants[i] = invertSse2(source[i], destination[i]);
+		}
+#endif
+
+#if XNA_AVX2
+		// Two matrices per register, one in each 128-bit half.
+		inline void invertMatrices(Simd::Avx2Lanes, Matrix const* source, Matrix* destination, float* determinants, size_t length) {
+			size_t i = 0;
+
+			for (; i + 2 <= length; i += 2) {
+				auto first = &source[i].M11;
+				__m256 rows[4];
+
+				for (size_t row = 0; row < 4; ++row)
+					rows[row] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(first + row * 4)), _mm_load_ps(first + 16 + row * 4), 1);
+
+				auto values = invertRows<Avx2Rows>(rows);
+				auto result = &destination[i].M11;
+
+				for (size_t row = 0; row < 4; ++row) {
+					_mm_store_ps(result + row * 4, _mm256_castps256_ps128(rows[row]));
+					_mm_store_ps(result + 16 + row * 4, _mm256_extractf128_ps(rows[row], 1));
+				}
+
+				determinants[i] = _mm256_cvtss_f32(values);
+				determinants[i + 1] = _mm_cvtss_f32(_mm256_extractf128_ps(values, 1));
+			}
+
+			for (; i < length; ++i)
+				determinants[i] = invertSse2(source[i], destination[i]);
+		}
+#endif
+
+		inline void loadSpheres(Simd::ScalarLanes, Vector3A const* spheres, float& x, float& y, float& z, float& radius) {
+			x = spheres->X;
+			y = spheres->Y;
+			z = spheres->Z;
+			radius = spheres->W;
+		}
+
+#if XNA_SSE2
+		// Four aligned loads transpose into center X, Y, Z and radius registers.
+		inline void loadSpheres(Simd::Sse2Lanes, Vector3A const* spheres, __m128& x, __m128& y, __m128& z, __m128& radius) {
+			x = _mm_load_ps(&spheres[0].X);
+			y = _mm_load_ps(&spheres[1].X);
+			z = _mm_load_ps(&spheres[2].X);
+			radius = _mm_load_ps(&spheres[3].X);
+			_MM_TRANSPOSE4_PS(x, y, z, radius);
+		}
+#endif
+
+#if XNA_AVX2
+		inline void loadSpheres(Simd::Avx2Lanes, Vector3A const* spheres, __m256& x, __m256& y, __m256& z, __m256& radius) {
+			__m128 low[4];
+			__m128 high[4];
+			loadSpheres(Simd::Sse2Lanes(), spheres, low[0], low[1], low[2], low[3]);
+			loadSpheres(Simd::Sse2Lanes(), spheres + 4, high[0], high[1], high[2], high[3]);
+
+			x = _mm256_insertf128_ps(_mm256_castps128_ps256(low[0]), high[0], 1);
+			y = _mm256_insertf128_ps(_mm256_castps128_ps256(low[1]), high[1], 1);
+			z = _mm256_insertf128_ps(_mm256_castps128_ps256(low[2]), high[2], 1);
+			radius = _mm256_insertf128_ps(_mm256_castps128_ps256(low[3]), high[3], 1);
+		}
+#endif
+
+		// BoundingFrustum::Contains(BoundingSphere) for TLanes::Width spheres.
+		template <typename TLanes>
+		void containsSpheres(Plane const* planes, Vector3A const* spheres, ContainmentType* results) {
+			using L = TLanes;
+			typename L::Float x, y, z, radius;
+			loadSpheres(L(), spheres, x, y, z, radius);
+
+			auto negativeRadius = L::Xor(radius, L::Set(-0.0F));
+			auto front = L::Set(0.0F);
+			auto clear = L::Equal(front, front);
+
+			for (size_t p = 0; p < 6; ++p) {
+				auto distance = L::Add(L::Mul(L::Set(planes[p].Normal.X), x), L::Mul(L::Set(planes[p].Normal.Y), y));
+				distance = L::Add(L::Add(distance, L::Mul(L::Set(planes[p].Normal.Z), z)), L::Set(planes[p].D));
+				auto outside = L::Greater(distance, radius);
+				front = L::Select(outside, outside, front);
+				clear = L::And(clear, L::Select(outside, outside, L::Less(distance, negativeRadius)));
+			}
+
+			float frontLanes[L::Width];
+			float clearLanes[L::Width];
+			L::Store(frontLanes, front);
+			L::Store(clearLanes, clear);
+
+			for (size_t j = 0; j < L::Width; ++j) {
+				if (Simd::ScalarLanes::Bits(frontLanes[j]) != 0)
+					results[j] = ContainmentType::Disjoint;
+				else
+					results[j] = Simd::ScalarLanes::Bits(clearLanes[j]) != 0 ? ContainmentType::Contains : ContainmentType::Intersects;
+			}
+		}
+
+		// NaN gives 0 and values beyond the int32_t range saturate.
+		inline int32_t toInt32(float value) {
+			if (value != value)
+				return 0;
+
+			if (value <= -2147483648.0F)
+				return INT32_MIN;
+
+			return value >= 2147483648.0F ? INT32_MAX : static_cast<int32_t>(value);
+		}
+
+		// Rounds the edges outward to whole units. Uses the C functions, as ScalarLanes does, so that no inline std
+		// overload is emitted from the AVX2 translation unit.
+		inline Rectangle boundingRectangle(float left, float top, float right, float bottom) {
+			auto x = ::floorf(left);
+			auto y = ::floorf(top);
+			return Rectangle(toInt32(x), toInt32(y), toInt32(::ceilf(right) - x), toInt32(::ceilf(bottom) - y));
+		}
+
+		// Bounds of TLanes::Width rectangles' transformed corners, each corner in Vector2::Transform's order.
+		template <typename TLanes>
+		void transformRectangles(Rectangle const* source, Matrix3x2 const& matrix, Rectangle* destination) {
+			using L = TLanes;
+			float edges[4][L::Width];
+
+			for (size_t j = 0; j < L::Width; ++j) {
+				edges[0][j] = static_cast<float>(source[j].Left());
+				edges[1][j] = static_cast<float>(source[j].Top());
+				edges[2][j] = static_cast<float>(source[j].Right());
+				edges[3][j] = static_cast<float>(source[j].Bottom());
+			}
+
+			auto left = L::Load(edges[0]);
+			auto top = L::Load(edges[1]);
+			auto right = L::Load(edges[2]);
+			auto bottom = L::Load(edges[3]);
+
+			auto leftX = L::Mul(left, L::Set(matrix.M11));
+			auto rightX = L::Mul(right, L::Set(matrix.M11));
+			auto topX = L::Mul(top, L::Set(matrix.M21));
+			auto bottomX = L::Mul(bottom, L::Set(matrix.M21));
+			auto m31 = L::Set(matrix.M31);
+			auto x1 = L::Add(L::Add(leftX, topX), m31);
+			auto x2 = L::Add(L::Add(rightX, topX), m31);
+			auto x3 = L::Add(L::Add(leftX, bottomX), m31);
+			auto x4 = L::Add(L::Add(rightX, bottomX), m31);
+
+			auto leftY = L::Mul(left, L::Set(matrix.M12));
+			auto rightY = L::Mul(right, L::Set(matrix.M12));
+			auto topY = L::Mul(top, L::Set(matrix.M22));
+			auto bottomY = L::Mul(bottom, L::Set(matrix.M22));
+			auto m32 = L::Set(matrix.M32);
+			auto y1 = L::Add(L::Add(leftY, topY), m32);
+			auto y2 = L::Add(L::Add(rightY, topY), m32);
+			auto y3 = L::Add(L::Add(leftY, bottomY), m32);
+			auto y4 = L::Add(L::Add(rightY, bottomY), m32);
+
+			L::Store(edges[0], L::Min(L::Min(x1, x2), L::Min(x3, x4)));
+			L::Store(edges[1], L::Min(L::Min(y1, y2), L::Min(y3, y4)));
+			L::Store(edges[2], L::Max(L::Max(x1, x2), L::Max(x3, x4)));
+			L::Store(edges[3], L::Max(L::Max(y1, y2), L::Max(y3, y4)));
+
+			for (size_t j = 0; j < L::Width; ++j)
+				destination[j] = boundingRectangle(edges[0][j], edges[1][j], edges[2][j], edges[3][j]);
+		}
+
+		// Same steps as ColorSpace's scalar fastDecode and fastEncode.
+		template <typename TLanes>
+		typename TLanes::Float srgbDecode(typename TLanes::Float value) {
+			using L = TLanes;
+			value = L::Select(L::Greater(value, L::Set(1.0F)), L::Set(1.0F), value);
+			value = L::Select(L::Less(value, L::Set(0.0F)), L::Set(0.0F), value);
+
+			auto low = L::Mul(value, L::Set(1.0F / 12.92F));
+			auto high = L::Add(L::Mul(value, L::Set(0.305306011F)), L::Set(0.682171111F));
+			high = L::Add(L::Mul(value, high), L::Set(0.012522878F));
+			high = L::Mul(value, high);
+
+			return L::Select(L::Greater(value, L::Set(0.04045F)), high, low);
+		}
+
+		template <typename TLanes>
+		typename TLanes::Float srgbEncode(typename TLanes::Float value) {
+			using L = TLanes;
+			value = L::Select(L::Greater(value, L::Set(1.0F)), L::Set(1.0F), value);
+			value = L::Select(L::Less(value, L::Set(0.0F)), L::Set(0.0F), value);
+
+			auto s1 = L::Sqrt(value);
+			auto s2 = L::Sqrt(s1);
+			auto s3 = L::Sqrt(s2);
+
+			auto low = L::Mul(value, L::Set(12.92F));
+			auto high = L::Mul(L::Set(0.662002687F), s1);
+			high = L::Add(high, L::Mul(L::Set(0.684122060F), s2));
+			high = L::Sub(high, L::Mul(L::Set(0.323583601F), s3));
+			high = L::Sub(high, L::Mul(L::Set(0.0225411470F), value));
+
+			return L::Select(L::Greater(value, L::Set(0.0031308F)), high, low);
+		}
+
+		template <typename TLanes>
+		void transformVector3(Vector3 const* source, Matrix const& matrix, Vector3* destination, size_t length) {
+			using L = TLanes;
+			constexpr auto width = L::Width;
+			size_t i = 0;
+
+			if constexpr (width > 1) {
+				auto m11 = L::Set(matrix.M11);
+				auto m12 = L::Set(matrix.M12);
+				auto m13 = L::Set(matrix.M13);
+				auto m21 = L::Set(matrix.M21);
+				auto m22 = L::Set(matrix.M22);
+				auto m23 = L::Set(matrix.M23);
+				auto m31 = L::Set(matrix.M31);
+				auto m32 = L::Set(matrix.M32);
+				auto m33 = L::Set(matrix.M33);
+				auto m41 = L::Set(matrix.M41);
+				auto m42 = L::Set(matrix.M42);
+				auto m43 = L::Set(matrix.M43);
+
+				for (; i + width <= length; i += width) {
+					float components[3][width];
+
+					for (size_t j = 0; j < width; ++j) {
+						components[0][j] = source[i + j].X;
+						components[1][j] = source[i + j].Y;
+						components[2][j] = source[i + j].Z;
+					}
+
+					auto x = L::Load(components[0]);
+					auto y = L::Load(components[1]);
+					auto z = L::Load(components[2]);
+
+					// Vector3::Transform's order: ((x * M1j + y * M2j) + z * M3j) + M4j.
+					L::Store(components[0], L::Add(L::Add(L::Add(L::Mul(x, m11), L::Mul(y, m21)), L::Mul(z, m31)), m41));
+					L::Store(components[1], L::Add(L::Add(L::Add(L::Mul(x, m12), L::Mul(y, m22)), L::Mul(z, m32)), m42));
+					L::Store(components[2], L::Add(L::Add(L::Add(L::Mul(x, m13), L::Mul(y, m23)), L::Mul(z, m33)), m43));
+
+					for (size_t j = 0; j < width; ++j)
+						destination[i + j] = Vector3(components[0][j], components[1][j], components[2][j]);
+				}
+			}
+
+			for (; i < length; ++i)
+				destination[i] = Vector3::Transform(source[i], matrix);
+		}
+
+		template <typename TLanes, bool TTranslate>
+		void transformVector2(Vector2 const* source, Matrix3x2 const& matrix, Vector2* destination, size_t length) {
+			using L = TLanes;
+			constexpr auto width = L::Width;
+			size_t i = 0;
+
+			if constexpr (width > 1) {
+				auto m11 = L::Set(matrix.M11);
+				auto m12 = L::Set(matrix.M12);
+				auto m21 = L::Set(matrix.M21);
+				auto m22 = L::Set(matrix.M22);
+				auto m31 = L::Set(matrix.M31);
+				auto m32 = L::Set(matrix.M32);
+
+				for (; i + width <= length; i += width) {
+					float components[2][width];
+
+					for (size_t j = 0; j < width; ++j) {
+						components[0][j] = source[i + j].X;
+						components[1][j] = source[i + j].Y;
+					}
+
+					auto x = L::Load(components[0]);
+					auto y = L::Load(components[1]);
+					// Vector2::Transform's order: (x * M1j + y * M2j) + M3j.
+					auto resultX = L::Add(L::Mul(x, m11), L::Mul(y, m21));
+					auto resultY = L::Add(L::Mul(x, m12), L::Mul(y, m22));
+
+					if constexpr (TTranslate) {
+						resultX = L::Add(resultX, m31);
+						resultY = L::Add(resultY, m32);
+					}
+
+					L::Store(components[0], resultX);
+					L::Store(components[1], resultY);
+
+					for (size_t j = 0; j < width; ++j)
+						destination[i + j] = Vector2(components[0][j], components[1][j]);
+				}
+			}
+
+			for (; i < length; ++i)
+				destination[i] = TTranslate ? Vector2::Transform(source[i], matrix) : Vector2::TransformNormal(source[i], matrix);
+		}
+
+		template <typename TLanes>
+		void multiplyMatrix(Matrix const* source, Matrix const& matrix, Matrix* destination, size_t length) {
+			for (size_t i = 0; i < length; ++i)
+				multiply(TLanes(), source[i], matrix, destination[i]);
+		}
+
+		template <typename TLanes>
+		void multiplyMatrices(Matrix const* source1, Matrix const* source2, Matrix* destination, size_t length) {
+			for (size_t i = 0; i < length; ++i)
+				multiply(TLanes(), source1[i], source2[i], destination[i]);
+		}
+
+		template <typename TLanes>
+		void invertMatrices(Matrix const* source, Matrix* destination, float* determinants, size_t length) {
+			invertMatrices(TLanes(), source, destination, determinants, length);
+		}
+
+		template <typename TLanes>
+		void containsSpheres(Plane const* planes, Vector3A const* spheres, ContainmentType* results, size_t length) {
+			size_t i = 0;
+
+			for (; i + TLanes::Width <= length; i += TLanes::Width)
+				containsSpheres<TLanes>(planes, spheres + i, results + i);
+
+			for (; i < length; ++i)
+				containsSpheres<Simd::ScalarLanes>(planes, spheres + i, results + i);
+		}
+
+		template <typename TLanes>
+		void transformRectangles(Rectangle const* source, Matrix3x2 const& matrix, Rectangle* destination, size_t length) {
+			size_t i = 0;
+
+			for (; i + TLanes::Width <= length; i += TLanes::Width)
+				transformRectangles<TLanes>(source + i, matrix, destination + i);
+
+			for (; i < length; ++i)
+				transformRectangles<Simd::ScalarLanes>(source + i, matrix, destination + i);
+		}
+
+		template <typename TLanes>
+		void srgbToLinear(float const* source, float* destination, size_t count) {
+			size_t i = 0;
+
+			for (; i + TLanes::Width <= count; i += TLanes::Width)
+				TLanes::Store(destination + i, srgbDecode<TLanes>(TLanes::Load(source + i)));
+
+			for (; i < count; ++i)
+				destination[i] = srgbDecode<Simd::ScalarLanes>(source[i]);
+		}
+
+		template <typename TLanes>
+		void linearToSrgb(float const* source, float* destination, size_t count) {
+			size_t i = 0;
+
+			for (; i + TLanes::Width <= count; i += TLanes::Width)
+				TLanes::Store(destination + i, srgbEncode<TLanes>(TLanes::Load(source + i)));
+
+			for (; i < count; ++i)
+				destination[i] = srgbEncode<Simd::ScalarLanes>(source[i]);
+		}
+
+#if XNA_SSE2
+		// Q16.16 transforms: each lane sums three 32x32->64-bit products plus the rounding bias, shifts right by 16 and
+		// adds the translation. The 64-bit sums wrap like the scalar accumulator, and a logical shift leaves the same
+		// low 32 bits as its arithmetic shift. Even and odd lanes are multiplied separately.
+		inline __m128i multiplyEven(__m128i a, __m128i b) {
+#if XNA_SSE41
+			return _mm_mul_epi32(a, b);
+#else
+			// The unsigned product less b << 32 when a is negative and a << 32 when b is negative.
+			auto correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+			return _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(correction, 32));
+#endif
+		}
+
+		inline __m128i transformFixed16(__m128i x, __m128i y, __m128i z, int32_t const* column, int32_t translation) {
+			auto m1 = _mm_set1_epi32(column[0]);
+			auto m2 = _mm_set1_epi32(column[1]);
+			auto m3 = _mm_set1_epi32(column[2]);
+			auto rounding = _mm_set1_epi64x(int64_t(1) << 15);
+
+			auto even = _mm_add_epi64(_mm_add_epi64(multiplyEven(x, m1), multiplyEven(y, m2)),
+				_mm_add_epi64(multiplyEven(z, m3), rounding));
+			auto odd = _mm_add_epi64(_mm_add_epi64(multiplyEven(_mm_srli_epi64(x, 32), m1), multiplyEven(_mm_srli_epi64(y, 32), m2)),
+				_mm_add_epi64(multiplyEven(_mm_srli_epi64(z, 32), m3), rounding));
+
+			auto low = _mm_and_si128(_mm_srli_epi64(even, 16), _mm_set1_epi64x(0xFFFFFFFF));
+			auto result = _mm_or_si128(low, _mm_slli_epi64(_mm_srli_epi64(odd, 16), 32));
+			return _mm_add_epi32(result, _mm_set1_epi32(translation));
+		}
+
+		inline void transformFixed16Block(Simd::Sse2Lanes, int32_t const* x, int32_t const* y, int32_t const* z,
+			int32_t const* matrix, int32_t* output) {
+			auto vx = _mm_loadu_si128(reinterpret_cast<__m128i const*>(x));
+			auto vy = _mm_loadu_si128(reinterpret_cast<__m128i const*>(y));
+			auto vz = _mm_loadu_si128(reinterpret_cast<__m128i const*>(z));
+
+			for (size_t j = 0; j < 3; ++j)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + j * 4), transformFixed16(vx, vy, vz, matrix + j * 3, matrix[9 + j]));
+		}
+#endif
+
+#if XNA_AVX2
+		inline __m256i transformFixed16(__m256i x, __m256i y, __m256i z, int32_t const* column, int32_t translation) {
+			auto m1 = _mm256_set1_epi32(column[0]);
+			auto m2 = _mm256_set1_epi32(column[1]);
+			auto m3 = _mm256_set1_epi32(column[2]);
+			auto rounding = _mm256_set1_epi64x(int64_t(1) << 15);
+
+			auto even = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(x, m1), _mm256_mul_epi32(y, m2)),
+				_mm256_add_epi64(_mm256_mul_epi32(z, m3), rounding));
+			auto odd = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(x, 32), m1), _mm256_mul_epi32(_mm256_srli_epi64(y, 32), m2)),
+				_mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(z, 32), m3), rounding));
+
+			auto result = _mm256_blend_epi32(_mm256_srli_epi64(even, 16), _mm256_slli_epi64(_mm256_srli_epi64(odd, 16), 32), 0xAA);
+			return _mm256_add_epi32(result, _mm256_set1_epi32(translation));
+		}
+
+		inline void transformFixed16Block(Simd::Avx2Lanes, int32_t const* x, int32_t const* y, int32_t const* z,
+			int32_t const* matrix, int32_t* output) {
+			auto vx = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(x));
+			auto vy = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(y));
+			auto vz = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(z));
+
+			for (size_t j = 0; j < 3; ++j)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + j * 8), transformFixed16(vx, vy, vz, matrix + j * 3, matrix[9 + j]));
+		}
+#endif
+
+		// Gathers TLanes::Width vectors into component arrays, zero padding the last block.
+		template <typename TLanes>
+		void transformFixed16(int32_t const* source, int32_t const* matrix, int32_t* destination, size_t length) {
+			constexpr size_t width = TLanes::Width;
+
+			for (size_t i = 0; i < length; i += width) {
+				auto count = length - i < width ? length - i : width;
+				int32_t x[width] = {};
+				int32_t y[width] = {};
+				int32_t z[width] = {};
+				int32_t output[3 * width];
+
+				for (size_t k = 0; k < count; ++k) {
+					x[k] = source[(i + k) * 3];
+					y[k] = source[(i + k) * 3 + 1];
+					z[k] = source[(i + k) * 3 + 2];
+				}
+
+				transformFixed16Block(TLanes(), x, y, z, matrix, output);
+
+				for (size_t k = 0; k < count; ++k) {
+					destination[(i + k) * 3] = output[k];
+					destination[(i + k) * 3 + 1] = output[width + k];
+					destination[(i + k) * 3 + 2] = output[2 * width + k];
+				}
+			}
+		}
+
+#if XNA_F16C
+		// F16C rounds to nearest even, as HalfTypeHelper does, but quiets signalling NaNs where HalfTypeHelper keeps
+		// their payload. Steps holding a NaN are redone with HalfTypeHelper.
+		inline void toHalfScalar(float const* source, uint8_t* output, size_t count) {
+			for (size_t i = 0; i < count; ++i) {
+				auto half = HalfTypeHelper::Convert(source[i]);
+				std::memcpy(output + i * 2, &half, sizeof(half));
+			}
+		}
+
+		inline void fromHalfScalar(uint8_t const* input, float* destination, size_t count) {
+			for (size_t i = 0; i < count; ++i) {
+				uint16_t half;
+				std::memcpy(&half, input + i * 2, sizeof(half));
+				destination[i] = HalfTypeHelper::Convert(half);
+			}
+		}
+
+		template <typename TLanes>
+		size_t toHalf(float const* source, void* destination, size_t count) {
+			auto output = static_cast<uint8_t*>(destination);
+			size_t i = 0;
+
+			if constexpr (TLanes::Width == 8) {
+				for (; i + 8 <= count; i += 8) {
+					auto value = _mm256_loadu_ps(source + i);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * 2), _mm256_cvtps_ph(value, 0));
+
+					if (_mm256_movemask_ps(_mm256_cmp_ps(value, value, _CMP_UNORD_Q)) != 0)
+						toHalfScalar(source + i, output + i * 2, 8);
+				}
+			}
+
+			for (; i + 4 <= count; i += 4) {
+				auto value = _mm_loadu_ps(source + i);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(output + i * 2), _mm_cvtps_ph(value, 0));
+
+				if (_mm_movemask_ps(_mm_cmpunord_ps(value, value)) != 0)
+					toHalfScalar(source + i, output + i * 2, 4);
+			}
+
+			return i;
+		}
+
+		template <typename TLanes>
+		size_t fromHalf(void const* source, float* destination, size_t count) {
+			auto input = static_cast<uint8_t const*>(source);
+			size_t i = 0;
+
+			if constexpr (TLanes::Width == 8) {
+				for (; i + 8 <= count; i += 8) {
+					auto value = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(input + i * 2)));
+					_mm256_storeu_ps(destination + i, value);
+
+					if (_mm256_movemask_ps(_mm256_cmp_ps(value, value, _CMP_UNORD_Q)) != 0)
+						fromHalfScalar(input + i * 2, destination + i, 8);
+				}
+			}
+
+			for (; i + 4 <= count; i += 4) {
+				auto value = _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(input + i * 2)));
+				_mm_storeu_ps(destination + i, value);
+
+				if (_mm_movemask_ps(_mm_cmpunord_ps(value, value)) != 0)
+					fromHalfScalar(input + i * 2, destination + i, 4);
+			}
+
+			return i;
+		}
+#endif
+
+		template <typename TLanes>
+		Simd::Kernels makeKernels(Simd::InstructionSet set) {
+			Simd::Kernels kernels;
+			kernels.Set = set;
+			kernels.TransformVector2 = &transformVector2<TLanes, true>;
+			kernels.TransformNormalVector2 = &transformVector2<TLanes, false>;
+			kernels.TransformVector3 = &transformVector3<TLanes>;
+			kernels.MultiplyMatrix = &multiplyMatrix<TLanes>;
+			kernels.MultiplyMatrices = &multiplyMatrices<TLanes>;
+			kernels.InvertMatrices = &invertMatrices<TLanes>;
+			kernels.ContainsSpheres = &containsSpheres<TLanes>;
+			kernels.TransformRectangles = &transformRectangles<TLanes>;
+			kernels.SrgbToLinear = &srgbToLinear<TLanes>;
+			kernels.LinearToSrgb = &linearToSrgb<TLanes>;
+			if constexpr (TLanes::Width > 1)
+				kernels.TransformFixed16 = &transformFixed16<TLanes>;
+#if XNA_F16C
+			if constexpr (TLanes::Width >= 4) {
+				kernels.ToHalf = &toHalf<TLanes>;
+				kernels.FromHalf = &fromHalf<TLanes>;
+			}
+#endif
+			return kernels;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef _SIMDLANES_HPP_
+#define _SIMDLANES_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "Simd.hpp"
+
+namespace Xna::Simd::inline XNA_SIMD_TARGET {
+
+	// Lane types let a kernel be written once for plain floats and for SSE2/AVX2 registers.
+	// BatchLanes is the widest type the build enables.
+	// Masks are floats with every bit set or clear, as the SIMD compares produce.
+	// ScalarLanes calls the C library and memcpy rather than the inline std overloads: unoptimized builds emit those
+	// as weak symbols, and the linker could keep a copy compiled with AVX2.
+	struct ScalarLanes {
+		using Float = float;
+		using Int = int32_t;
+		static constexpr size_t Width = 1;
+
+		static Float Load(float const* source) { return *source; }
+		static void Store(float* destination, Float value) { *destination = value; }
+		static Float Set(float value) { return value; }
+		static Float Add(Float a, Float b) { return a + b; }
+		static Float Sub(Float a, Float b) { return a - b; }
+		static Float Mul(Float a, Float b) { return a * b; }
+		static Float Div(Float a, Float b) { return a / b; }
+		static Float Min(Float a, Float b) { return a < b ? a : b; }
+		static Float Max(Float a, Float b) { return a > b ? a : b; }
+		static Float Sqrt(Float a) { return ::sqrtf(a); }
+		static Float Bits(uint32_t value) { Float result; std::memcpy(&result, &value, sizeof(result)); return result; }
+		static uint32_t Bits(Float value) { uint32_t result; std::memcpy(&result, &value, sizeof(result)); return result; }
+		static Float And(Float a, Float b) { return Bits(Bits(a) & Bits(b)); }
+		static Float Xor(Float a, Float b) { return Bits(Bits(a) ^ Bits(b)); }
+		static Float Select(Float mask, Float a, Float b) { return Bits((Bits(mask) & Bits(a)) | (~Bits(mask) & Bits(b))); }
+		static Float Mask(bool value) { return Bits(value ? 0xFFFFFFFFu : 0u); }
+		static Float Greater(Float a, Float b) { return Mask(a > b); }
+		static Float Less(Float a, Float b) { return Mask(a < b); }
+		static Float Equal(Float a, Float b) { return Mask(a == b); }
+		static Float SignMask(Float a) { return Mask((Bits(a) >> 31) != 0); }
+		static Int Round(Float a) { return static_cast<Int>(::nearbyintf(a)); }
+		static Float ToFloat(Int a) { return static_cast<float>(a); }
+		static Int AddInt(Int a, int32_t b) { return a + b; }
+		static Int SubInt(Int a, Int b) { return a - b; }
+		static Int HalfInt(Int a) { return a >> 1; }
+		static Float TestBit(Int a, int32_t bit) { return Mask((a & bit) != 0); }
+		static Float Pow2(Int n) { return Bits(static_cast<uint32_t>(n + 127) << 23); }
+
+		static Float ReciprocalSqrtEstimate(Float a) {
+#if XNA_SSE2
+			return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+#else
+			// Bit-level initial guess refined twice; the kernel adds the final Newton step.
+			auto estimate = Bits(0x5F375A86u - (Bits(a) >> 1));
+			estimate = estimate * (1.5f - 0.5f * a * estimate * estimate);
+			return estimate * (1.5f - 0.5f * a * estimate * estimate);
+#endif
+		}
+	};
+
+#if XNA_SSE2
+	struct Sse2Lanes {
+		using Float = __m128;
+		using Int = __m128i;
+		static constexpr size_t Width = 4;
+
+		static Float Load(float const* source) { return _mm_loadu_ps(source); }
+		static void Store(float* destination, Float value) { _mm_storeu_ps(destination, value); }
+		static Float Set(float value) { return _mm_set1_ps(value); }
+		static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+		static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+		static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+		static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+		static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+		static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+		static Float Sqrt(Float a) { return _mm_sqrt_ps(a); }
+		static Float And(Float a, Float b) { return _mm_and_ps(a, b); }
+		static Float Xor(Float a, Float b) { return _mm_xor_ps(a, b); }
+		static Float Select(Float mask, Float a, Float b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+		static Float Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+		static Float Less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+		static Float Equal(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+		static Float SignMask(Float a) { return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(a), 31)); }
+		static Int Round(Float a) { return _mm_cvtps_epi32(a); }
+		static Float ToFloat(Int a) { return _mm_cvtepi32_ps(a); }
+		static Int AddInt(Int a, int32_t b) { return _mm_add_epi32(a, _mm_set1_epi32(b)); }
+		static Int SubInt(Int a, Int b) { return _mm_sub_epi32(a, b); }
+		static Int HalfInt(Int a) { return _mm_srai_epi32(a, 1); }
+
+		static Float TestBit(Int a, int32_t bit) {
+			auto masked = _mm_and_si128(a, _mm_set1_epi32(bit));
+			return _mm_castsi128_ps(_mm_cmpeq_epi32(masked, _mm_set1_epi32(bit)));
+		}
+
+		static Float Pow2(Int n) { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)); }
+		static Float ReciprocalSqrtEstimate(Float a) { return _mm_rsqrt_ps(a); }
+	};
+#endif
+
+#if XNA_AVX2
+	struct Avx2Lanes {
+		using Float = __m256;
+		using Int = __m256i;
+		static constexpr size_t Width = 8;
+
+		static Float Load(float const* source) { return _mm256_loadu_ps(source); }
+		static void Store(float* destination, Float value) { _mm256_storeu_ps(destination, value); }
+		static Float Set(float value) { return _mm256_set1_ps(value); }
+		static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+		static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+		static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+		static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+		static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+		static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+		static Float Sqrt(Float a) { return _mm256_sqrt_ps(a); }
+		static Float And(Float a, Float b) { return _mm256_and_ps(a, b); }
+		static Float Xor(Float a, Float b) { return _mm256_xor_ps(a, b); }
+		static Float Select(Float mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+		static Float Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		static Float Less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static Float Equal(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		static Float SignMask(Float a) { return _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(a), 31)); }
+		static Int Round(Float a) { return _mm256_cvtps_epi32(a); }
+		static Float ToFloat(Int a) { return _mm256_cvtepi32_ps(a); }
+		static Int AddInt(Int a, int32_t b) { return _mm256_add_epi32(a, _mm256_set1_epi32(b)); }
+		static Int SubInt(Int a, Int b) { return _mm256_sub_epi32(a, b); }
+		static Int HalfInt(Int a) { return _mm256_srai_epi32(a, 1); }
+
+		static Float TestBit(Int a, int32_t bit) {
+			auto masked = _mm256_and_si256(a, _mm256_set1_epi32(bit));
+			return _mm256_castsi256_ps(_mm256_cmpeq_epi32(masked, _mm256_set1_epi32(bit)));
+		}
+
+		static Float Pow2(Int n) { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(127)), 23)); }
+		static Float ReciprocalSqrtEstimate(Float a) { return _mm256_rsqrt_ps(a); }
+	};
+
+	using BatchLanes = Avx2Lanes;
+#elif XNA_SSE2
+	using BatchLanes = Sse2Lanes;
+#else
+	using BatchLanes = ScalarLanes;
+#endif
+}
+
+#endif
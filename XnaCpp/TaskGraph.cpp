@@ -0,0 +1,34 @@
+#include <algorithm>
+#include "TaskGraph.hpp"
+
+namespace Xna {
+	size_t TaskGraph::Add(std::function<void()> task) {
+		Node node;
+		node.Task = std::move(task);
+		_nodes.push_back(std::move(node));
+
+		return _nodes.size() - 1;
+	}
+
+	void TaskGraph::Precede(size_t before, size_t after) {
+		// Only forward edges are accepted, which keeps every graph acyclic.
+		if (before >= after || after >= _nodes.size())
+			return;
+
+		auto& successors = _nodes[before].Successors;
+
+		if (std::find(successors.begin(), successors.end(), after) != successors.end())
+			return;
+
+		successors.push_back(after);
+		++_nodes[after].Predecessors;
+	}
+
+	size_t TaskGraph::Count() const {
+		return _nodes.size();
+	}
+
+	void TaskGraph::Clear() {
+		_nodes.clear();
+	}
+}
@@ -0,0 +1,35 @@
+#ifndef _TASKGRAPH_HPP_
+#define _TASKGRAPH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Xna {
+
+	// A directed acyclic graph of tasks, built once and executed any number of times by WorkStealingExecutor.
+	class TaskGraph {
+	public:
+		size_t Add(std::function<void()> task);
+
+		// after only starts once before has finished. Edges that would point backwards are ignored.
+		void Precede(size_t before, size_t after);
+
+		size_t Count() const;
+		void Clear();
+
+	private:
+		friend class WorkStealingExecutor;
+
+		struct Node {
+			std::function<void()> Task;
+			std::vector<size_t> Successors;
+			int32_t Predecessors{ 0 };
+		};
+
+		std::vector<Node> _nodes;
+	};
+}
+
+#endif
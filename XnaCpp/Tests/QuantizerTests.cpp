@@ -0,0 +1,156 @@
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+#include "../BitReader.hpp"
+#include "../BitWriter.hpp"
+#include "../BoundingBox.hpp"
+#include "../Quaternion.hpp"
+#include "../QuaternionQuantizer.hpp"
+#include "../Vector3.hpp"
+#include "../Vector3Quantizer.hpp"
+
+using namespace Xna;
+using std::vector;
+
+namespace {
+	int failures = 0;
+
+	void check(bool condition, char const* what, int32_t bits) {
+		if (condition)
+			return;
+
+		std::printf("FAILED: %s (%d bits)\n", what, bits);
+		++failures;
+	}
+
+	Quaternion randomRotation(std::mt19937& random) {
+		std::normal_distribution<float> normal;
+		auto value = Quaternion(normal(random), normal(random), normal(random), normal(random));
+		value.Normalize();
+		return value;
+	}
+
+	// Largest per-component difference, up to sign, since q and -q are the same rotation.
+	float difference(Quaternion const& a, Quaternion const& b) {
+		auto same = std::fmax(std::fmax(std::fabs(a.X - b.X), std::fabs(a.Y - b.Y)), std::fmax(std::fabs(a.Z - b.Z), std::fabs(a.W - b.W)));
+		auto flipped = std::fmax(std::fmax(std::fabs(a.X + b.X), std::fabs(a.Y + b.Y)), std::fmax(std::fabs(a.Z + b.Z), std::fabs(a.W + b.W)));
+		return std::fmin(same, flipped);
+	}
+
+	void testQuaternionQuantizer() {
+		std::mt19937 random(1);
+		auto nan = std::numeric_limits<float>::quiet_NaN();
+		auto infinity = std::numeric_limits<float>::infinity();
+
+		for (auto bits = QuaternionQuantizer::MinBitsPerComponent; bits <= QuaternionQuantizer::MaxBitsPerComponent; ++bits) {
+			QuaternionQuantizer quantizer(bits);
+			auto maxError = quantizer.MaxError();
+			auto withinError = true;
+
+			vector<Quaternion> values(2000);
+			vector<Quaternion> baseline(values.size());
+
+			for (size_t i = 0; i < values.size(); ++i) {
+				values[i] = randomRotation(random);
+				// Mostly small changes, as between two snapshots, with some unchanged and some unrelated values.
+				baseline[i] = i % 5 == 0 ? values[i] : i % 7 == 0 ? randomRotation(random)
+					: Quaternion::Normalize(values[i] + Quaternion(0.001f * (i % 3), 0.002f, -0.001f, 0.0f));
+				withinError &= difference(quantizer.Decode(quantizer.Encode(values[i])), values[i]) <= maxError;
+			}
+
+			check(withinError, "QuaternionQuantizer round trip within MaxError()", bits);
+
+			BitWriter writer;
+			quantizer.Encode(values, writer);
+			quantizer.EncodeDelta(values, baseline, writer);
+			auto data = writer.ToArray();
+			BitReader reader(data);
+			vector<Quaternion> decoded(values.size());
+			vector<Quaternion> deltaDecoded(values.size());
+			quantizer.Decode(reader, decoded);
+			quantizer.DecodeDelta(reader, baseline, deltaDecoded);
+
+			auto streamsMatch = true;
+
+			for (size_t i = 0; i < values.size(); ++i) {
+				auto expected = quantizer.Decode(quantizer.Encode(values[i]));
+				streamsMatch &= decoded[i] == expected && deltaDecoded[i] == expected;
+			}
+
+			check(streamsMatch, "QuaternionQuantizer stream and delta stream decode like Encode/Decode", bits);
+
+			auto identity = true;
+
+			for (auto const& special : { Quaternion(nan, 0, 0, 1), Quaternion(nan, nan, nan, nan),
+				Quaternion(infinity, 0, 0, 0), Quaternion(0, 0, 0, 0) })
+				identity &= difference(quantizer.Decode(quantizer.Encode(special)), Quaternion::Identity) <= maxError;
+
+			check(identity, "QuaternionQuantizer stores NaN, infinite and zero quaternions as the identity", bits);
+		}
+	}
+
+	void testVector3Quantizer() {
+		std::mt19937 random(2);
+		BoundingBox bounds(Vector3(-100.0f, -5.0f, 0.0f), Vector3(100.0f, 5.0f, 1000.0f));
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		auto nan = std::numeric_limits<float>::quiet_NaN();
+
+		for (int32_t bits = 1; bits <= Vector3Quantizer::MaxBitsPerComponent; ++bits) {
+			Vector3Quantizer quantizer(bounds, bits);
+			auto maxError = quantizer.MaxError();
+			auto withinError = true;
+
+			vector<Vector3> values(2000);
+			vector<Vector3> baseline(values.size());
+
+			for (size_t i = 0; i < values.size(); ++i) {
+				values[i] = bounds.Min + (bounds.Max - bounds.Min) * Vector3(unit(random), unit(random), unit(random));
+				baseline[i] = i % 5 == 0 ? values[i] : values[i] + Vector3(0.01f, -0.02f, 0.5f) * static_cast<float>(i % 4);
+
+				auto decoded = quantizer.Quantize(values[i]);
+				// MaxError() leaves out the rounding of the decoded float.
+				auto slack = [](float value) { return std::fabs(value) * std::numeric_limits<float>::epsilon(); };
+				withinError &= std::fabs(decoded.X - values[i].X) <= maxError.X + slack(values[i].X)
+					&& std::fabs(decoded.Y - values[i].Y) <= maxError.Y + slack(values[i].Y)
+					&& std::fabs(decoded.Z - values[i].Z) <= maxError.Z + slack(values[i].Z);
+			}
+
+			check(withinError, "Vector3Quantizer round trip within MaxError()", bits);
+
+			BitWriter writer;
+			quantizer.Encode(values, writer);
+			quantizer.EncodeDelta(values, baseline, writer);
+			auto data = writer.ToArray();
+			BitReader reader(data);
+			vector<Vector3> decoded(values.size());
+			vector<Vector3> deltaDecoded(values.size());
+			quantizer.Decode(reader, decoded);
+			quantizer.DecodeDelta(reader, baseline, deltaDecoded);
+
+			auto streamsMatch = true;
+
+			for (size_t i = 0; i < values.size(); ++i) {
+				auto expected = quantizer.Quantize(values[i]);
+				streamsMatch &= decoded[i] == expected && deltaDecoded[i] == expected;
+			}
+
+			check(streamsMatch, "Vector3Quantizer stream and delta stream decode like Quantize", bits);
+
+			auto special = quantizer.Quantize(Vector3(nan, 1.0f, nan));
+			check(special.X == bounds.Min.X && special.Z == bounds.Min.Z && !std::isnan(special.Y),
+				"Vector3Quantizer stores NaN components as the minimum", bits);
+		}
+	}
+}
+
+int main() {
+	testQuaternionQuantizer();
+	testVector3Quantizer();
+
+	if (failures == 0)
+		std::printf("All quantizer tests passed.\n");
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,315 @@
+#include <algorithm>
+#include <atomic>
+#include "TransformHierarchy.hpp"
+#include "Parallel.hpp"
+#include "Profiler.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		constexpr size_t chunkSize = 4096;
+
+		// Scale * Rotation * Translation without the two full matrix products.
+		Matrix localMatrix(Vector3 const& scale, Quaternion const& rotation, Vector3 const& translation) {
+			auto result = Matrix::CreateFromQuaternion(rotation);
+			result.M11 *= scale.X;
+			result.M12 *= scale.X;
+			result.M13 *= scale.X;
+			result.M21 *= scale.Y;
+			result.M22 *= scale.Y;
+			result.M23 *= scale.Y;
+			result.M31 *= scale.Z;
+			result.M32 *= scale.Z;
+			result.M33 *= scale.Z;
+			result.M41 = translation.X;
+			result.M42 = translation.Y;
+			result.M43 = translation.Z;
+
+			return result;
+		}
+
+		template <typename T>
+		void permute(vector<T>& values, vector<size_t> const& order) {
+			vector<T> sorted(values.size());
+
+			for (size_t i = 0; i < order.size(); ++i)
+				sorted[i] = values[order[i]];
+
+			values.swap(sorted);
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	TransformHierarchy::TransformHierarchy() {}
+}
+
+//Functions
+namespace Xna {
+	int32_t TransformHierarchy::Add(int32_t parent, Vector3 const& scale, Quaternion const& rotation, Vector3 const& translation,
+		BoundingSphere const& localBounds) {
+		uint32_t depth = 0;
+
+		if (parent != NoParent) {
+			auto parentSlot = slot(parent);
+
+			if (parentSlot < 0)
+				return NoParent;
+
+			depth = _depths[parentSlot] + 1;
+			parent = parentSlot;
+		}
+
+		// Appending keeps depth order unless the node is shallower than the last one.
+		if (!_depths.empty() && depth < _depths.back())
+			_sorted = false;
+
+		auto node = static_cast<int32_t>(_slots.size());
+		auto nodeSlot = static_cast<int32_t>(_parents.size());
+
+		_parents.push_back(parent);
+		_depths.push_back(depth);
+		_scales.push_back(scale);
+		_rotations.push_back(rotation);
+		_translations.push_back(translation);
+		_localBounds.push_back(localBounds);
+		_worlds.push_back(Matrix::Identity);
+		_worldBounds.push_back(localBounds);
+		_dirty.push_back(1);
+		_handles.push_back(node);
+		_slots.push_back(nodeSlot);
+
+		if (_sorted) {
+			if (_levels.empty())
+				_levels.push_back(0);
+
+			if (depth + 1 == _levels.size())
+				_levels.push_back(_parents.size());
+			else
+				_levels.back() = _parents.size();
+		}
+
+		return node;
+	}
+
+	void TransformHierarchy::Clear() {
+		_parents.clear();
+		_depths.clear();
+		_scales.clear();
+		_rotations.clear();
+		_translations.clear();
+		_localBounds.clear();
+		_worlds.clear();
+		_worldBounds.clear();
+		_dirty.clear();
+		_handles.clear();
+		_slots.clear();
+		_levels.clear();
+		_sorted = true;
+	}
+
+	size_t TransformHierarchy::Count() const {
+		return _slots.size();
+	}
+
+	int32_t TransformHierarchy::Parent(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 || _parents[index] < 0 ? NoParent : _handles[_parents[index]];
+	}
+
+	Vector3 TransformHierarchy::Scale(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 ? Vector3::One : _scales[index];
+	}
+
+	void TransformHierarchy::Scale(int32_t node, Vector3 const& value) {
+		auto index = slot(node);
+
+		if (index >= 0) {
+			_scales[index] = value;
+			_dirty[index] = 1;
+		}
+	}
+
+	Quaternion TransformHierarchy::Rotation(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 ? Quaternion::Identity : _rotations[index];
+	}
+
+	void TransformHierarchy::Rotation(int32_t node, Quaternion const& value) {
+		auto index = slot(node);
+
+		if (index >= 0) {
+			_rotations[index] = value;
+			_dirty[index] = 1;
+		}
+	}
+
+	Vector3 TransformHierarchy::Translation(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 ? Vector3::Zero : _translations[index];
+	}
+
+	void TransformHierarchy::Translation(int32_t node, Vector3 const& value) {
+		auto index = slot(node);
+
+		if (index >= 0) {
+			_translations[index] = value;
+			_dirty[index] = 1;
+		}
+	}
+
+	void TransformHierarchy::LocalTransform(int32_t node, Vector3 const& scale, Quaternion const& rotation, Vector3 const& translation) {
+		auto index = slot(node);
+
+		if (index >= 0) {
+			_scales[index] = scale;
+			_rotations[index] = rotation;
+			_translations[index] = translation;
+			_dirty[index] = 1;
+		}
+	}
+
+	BoundingSphere TransformHierarchy::LocalBounds(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 ? BoundingSphere() : _localBounds[index];
+	}
+
+	void TransformHierarchy::LocalBounds(int32_t node, BoundingSphere const& value) {
+		auto index = slot(node);
+
+		if (index >= 0) {
+			_localBounds[index] = value;
+			_dirty[index] = 1;
+		}
+	}
+
+	Matrix TransformHierarchy::World(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 ? Matrix::Identity : _worlds[index];
+	}
+
+	BoundingSphere TransformHierarchy::WorldBounds(int32_t node) const {
+		auto index = slot(node);
+		return index < 0 ? BoundingSphere() : _worldBounds[index];
+	}
+
+	bool TransformHierarchy::CopyAbsoluteTransformsTo(vector<Matrix>& destinationArray) const {
+		if (destinationArray.size() < _slots.size())
+			return false;
+
+		for (size_t node = 0; node < _slots.size(); ++node)
+			destinationArray[node] = _worlds[_slots[node]];
+
+		return true;
+	}
+
+	size_t TransformHierarchy::ThreadCount() const {
+		return _threadCount;
+	}
+
+	void TransformHierarchy::ThreadCount(size_t value) {
+		_threadCount = value;
+	}
+
+	size_t TransformHierarchy::Update() {
+		XNA_PROFILE_ZONE("TransformHierarchy::Update");
+
+		if (!_sorted)
+			sortByDepth();
+
+		std::atomic<size_t> updated{ 0 };
+
+		// A level only reads the previous one, so its nodes can be split freely.
+		for (size_t level = 0; level + 1 < _levels.size(); ++level) {
+			auto begin = _levels[level];
+			auto end = _levels[level + 1];
+			auto chunks = (end - begin + chunkSize - 1) / chunkSize;
+
+			Parallel::For(0, chunks, _threadCount, [&](size_t chunk) {
+				auto first = begin + chunk * chunkSize;
+				updated.fetch_add(updateRange(first, std::min(end, first + chunkSize)), std::memory_order_relaxed);
+				});
+		}
+
+		std::fill(_dirty.begin(), _dirty.end(), uint8_t(0));
+
+		return updated.load();
+	}
+}
+
+//Private
+namespace Xna {
+	int32_t TransformHierarchy::slot(int32_t node) const {
+		return node < 0 || static_cast<size_t>(node) >= _slots.size() ? -1 : _slots[node];
+	}
+
+	void TransformHierarchy::sortByDepth() {
+		XNA_PROFILE_ZONE("TransformHierarchy::sortByDepth");
+
+		// Counting sort on depth; stable, so parents still precede their children.
+		auto levelCount = static_cast<size_t>(*std::max_element(_depths.begin(), _depths.end())) + 1;
+		_levels.assign(levelCount + 1, 0);
+
+		for (auto depth : _depths)
+			++_levels[depth + 1];
+
+		for (size_t level = 1; level <= levelCount; ++level)
+			_levels[level] += _levels[level - 1];
+
+		auto next = _levels;
+		vector<size_t> order(_depths.size());
+		vector<int32_t> newSlots(_depths.size());
+
+		for (size_t oldSlot = 0; oldSlot < _depths.size(); ++oldSlot) {
+			auto newSlot = next[_depths[oldSlot]]++;
+			order[newSlot] = oldSlot;
+			newSlots[oldSlot] = static_cast<int32_t>(newSlot);
+		}
+
+		for (auto& parent : _parents) {
+			if (parent >= 0)
+				parent = newSlots[parent];
+		}
+
+		permute(_parents, order);
+		permute(_depths, order);
+		permute(_scales, order);
+		permute(_rotations, order);
+		permute(_translations, order);
+		permute(_localBounds, order);
+		permute(_worlds, order);
+		permute(_worldBounds, order);
+		permute(_dirty, order);
+		permute(_handles, order);
+
+		for (size_t index = 0; index < _handles.size(); ++index)
+			_slots[_handles[index]] = static_cast<int32_t>(index);
+
+		_sorted = true;
+	}
+
+	size_t TransformHierarchy::updateRange(size_t begin, size_t end) {
+		size_t count = 0;
+
+		for (auto index = begin; index < end; ++index) {
+			auto parent = _parents[index];
+
+			// Parents were handled by the previous level and kept their flag, so a change reaches the whole subtree.
+			if (!_dirty[index] && (parent < 0 || !_dirty[parent]))
+				continue;
+
+			_dirty[index] = 1;
+
+			auto local = localMatrix(_scales[index], _rotations[index], _translations[index]);
+			_worlds[index] = parent < 0 ? local : Matrix::Multiply(local, _worlds[parent]);
+			_worldBounds[index] = _localBounds[index].Transform(_worlds[index]);
+			++count;
+		}
+
+		return count;
+	}
+}
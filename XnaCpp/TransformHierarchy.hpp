@@ -0,0 +1,80 @@
+#ifndef _TRANSFORMHIERARCHY_HPP_
+#define _TRANSFORMHIERARCHY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BoundingSphere.hpp"
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Vector3.hpp"
+
+namespace Xna {
+
+	// Parent-child transforms kept in flat arrays sorted by depth, so each level is a contiguous range that follows
+	// all of its parents. A node's world matrix is Scale * Rotation * Translation * parent world, as with
+	// Model.CopyAbsoluteBoneTransformsTo. Setters only mark nodes dirty; Update() recomputes the dirty nodes and their
+	// descendants level by level, splitting each level over ThreadCount() threads.
+	// Nodes are addressed by the handle Add() returns, which stays valid when the arrays are re-sorted.
+	class TransformHierarchy {
+	public:
+		static constexpr int32_t NoParent = -1;
+
+		TransformHierarchy();
+
+		// Returns the new node's handle, or NoParent when parent is neither NoParent nor an existing handle.
+		int32_t Add(int32_t parent, Vector3 const& scale, Quaternion const& rotation, Vector3 const& translation,
+			BoundingSphere const& localBounds = BoundingSphere());
+		void Clear();
+		size_t Count() const;
+		int32_t Parent(int32_t node) const;
+
+		// Getters return defaults and setters do nothing for invalid handles.
+		Vector3 Scale(int32_t node) const;
+		void Scale(int32_t node, Vector3 const& value);
+		Quaternion Rotation(int32_t node) const;
+		void Rotation(int32_t node, Quaternion const& value);
+		Vector3 Translation(int32_t node) const;
+		void Translation(int32_t node, Vector3 const& value);
+		void LocalTransform(int32_t node, Vector3 const& scale, Quaternion const& rotation, Vector3 const& translation);
+		BoundingSphere LocalBounds(int32_t node) const;
+		void LocalBounds(int32_t node, BoundingSphere const& value);
+
+		// World values as of the last Update().
+		Matrix World(int32_t node) const;
+		BoundingSphere WorldBounds(int32_t node) const;
+		// Copies every world matrix in handle order; returns false when destinationArray is shorter than Count().
+		bool CopyAbsoluteTransformsTo(std::vector<Matrix>& destinationArray) const;
+
+		size_t ThreadCount() const;
+		void ThreadCount(size_t value);
+
+		// Returns the number of nodes recomputed.
+		size_t Update();
+
+	private:
+		// Indexed by slot, the position in depth order.
+		std::vector<int32_t> _parents;
+		std::vector<uint32_t> _depths;
+		std::vector<Vector3> _scales;
+		std::vector<Quaternion> _rotations;
+		std::vector<Vector3> _translations;
+		std::vector<BoundingSphere> _localBounds;
+		std::vector<Matrix> _worlds;
+		std::vector<BoundingSphere> _worldBounds;
+		std::vector<uint8_t> _dirty;
+		std::vector<int32_t> _handles;
+		// Indexed by handle.
+		std::vector<int32_t> _slots;
+		// Start slot of each depth level, followed by Count().
+		std::vector<size_t> _levels;
+		bool _sorted{ true };
+		size_t _threadCount{ 1 };
+
+		int32_t slot(int32_t node) const;
+		void sortByDepth();
+		size_t updateRange(size_t begin, size_t end);
+	};
+}
+
+#endif
@@ -4,10 +4,23 @@
 #include "Point.hpp"
 #include "MathHelper.hpp"
 #include "Matrix.hpp"
+#include "Matrix3x2.hpp"
 #include "Quaternion.hpp"
+#include "Profiler.hpp"
+#include "SimdDispatch.hpp"
 
 using std::vector;
 
+//Private
+namespace Xna {
+	namespace {
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+	}
+}
+
 //Constructors
 namespace Xna {
 	const Vector2 Vector2::Zero = Vector2(0);
@@ -16,7 +29,7 @@ namespace Xna {
 	const Vector2 Vector2::UnitY = Vector2(0, 1);
 
 	Vector2::Vector2() {}
-	Vector2::Vector2(float x, float y) : X(X), Y(y) {}
+	Vector2::Vector2(float x, float y) : X(x), Y(y) {}
 	Vector2::Vector2(float value) : X(value), Y(value) {}
 }
 
@@ -47,7 +60,7 @@ namespace Xna {
 	}
 
 	Vector2 operator /(Vector2 const& value1, float divider) {
-		return Vector2::Multiply(value1, divider);
+		return Vector2::Divide(value1, divider);
 	}
 
 	bool operator ==(Vector2 const& value1, Vector2 const& value2) {
@@ -227,6 +240,7 @@ namespace Xna {
 
 	void Vector2::Transform(vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
 		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector2::Transform");
 
 		//TODO: Verificar excees
 
@@ -243,6 +257,7 @@ namespace Xna {
 
 	void Vector2::Transform(vector<Vector2> const& sourceArray, size_t sourceIndex, Quaternion const& rotation,
 		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector2::Transform");
 
 		//TODO: Verificar excees
 
@@ -271,6 +286,8 @@ namespace Xna {
 
 	void Vector2::TransformNormal(std::vector<Vector2> sourceArray, size_t sourceIndex, Matrix const& matrix,
 		std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector2::TransformNormal");
+
 		//TODO: verificar excees
 
 		for (size_t i = 0; i < length; i++)
@@ -286,6 +303,42 @@ namespace Xna {
 		TransformNormal(sourceArray, 0, matrix, destinationArray, 0, sourceArray.size());
 	}
 
+	Vector2 Vector2::Transform(Vector2 const& position, Matrix3x2 const& matrix) {
+		return Vector2(
+			(position.X * matrix.M11) + (position.Y * matrix.M21) + matrix.M31,
+			(position.X * matrix.M12) + (position.Y * matrix.M22) + matrix.M32);
+	}
+
+	void Vector2::Transform(vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix3x2 const& matrix,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector2::Transform");
+
+		if (length != 0 && validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			Simd::Dispatch::Active().TransformVector2(&sourceArray[sourceIndex], matrix, &destinationArray[destinationIndex], length);
+	}
+
+	void Vector2::Transform(vector<Vector2> const& sourceArray, Matrix3x2 const& matrix, vector<Vector2>& destinationArray) {
+		Transform(sourceArray, 0, matrix, destinationArray, 0, destinationArray.size());
+	}
+
+	Vector2 Vector2::TransformNormal(Vector2 const& normal, Matrix3x2 const& matrix) {
+		return Vector2(
+			(normal.X * matrix.M11) + (normal.Y * matrix.M21),
+			(normal.X * matrix.M12) + (normal.Y * matrix.M22));
+	}
+
+	void Vector2::TransformNormal(vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix3x2 const& matrix,
+		vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector2::TransformNormal");
+
+		if (length != 0 && validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			Simd::Dispatch::Active().TransformNormalVector2(&sourceArray[sourceIndex], matrix, &destinationArray[destinationIndex], length);
+	}
+
+	void Vector2::TransformNormal(vector<Vector2> const& sourceArray, Matrix3x2 const& matrix, vector<Vector2>& destinationArray) {
+		TransformNormal(sourceArray, 0, matrix, destinationArray, 0, destinationArray.size());
+	}
+
 }
 
 //Functions
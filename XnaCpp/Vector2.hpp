@@ -7,6 +7,7 @@ namespace Xna {
 
 	struct Point;
 	struct Matrix;
+	struct Matrix3x2;
 	struct Quaternion;
 
 	struct Vector2 {
@@ -72,6 +73,16 @@ namespace Xna {
 		static void TransformNormal(std::vector<Vector2> sourceArray, size_t sourceIndex, Matrix const& matrix,
 			std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
 		static void TransformNormal(std::vector<Vector2> sourceArray, Matrix const& matrix,	std::vector<Vector2>& destinationArray);
+		// 2D affine forms: the same bits as the Matrix overloads with matrix.ToMatrix(), without the 4x4 work.
+		// The batch forms run on SIMD lanes and do nothing for out-of-range indices.
+		static Vector2 Transform(Vector2 const& position, Matrix3x2 const& matrix);
+		static void Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix3x2 const& matrix,
+			std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Transform(std::vector<Vector2> const& sourceArray, Matrix3x2 const& matrix, std::vector<Vector2>& destinationArray);
+		static Vector2 TransformNormal(Vector2 const& normal, Matrix3x2 const& matrix);
+		static void TransformNormal(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix3x2 const& matrix,
+			std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void TransformNormal(std::vector<Vector2> const& sourceArray, Matrix3x2 const& matrix, std::vector<Vector2>& destinationArray);
 
 		void Ceiling();
 		bool Equals(Vector2 const& other) const;
@@ -5,6 +5,8 @@
 #include "MathHelper.hpp"
 #include "Matrix.hpp"
 #include "Quaternion.hpp"
+#include "Profiler.hpp"
+#include "SimdDispatch.hpp"
 
 using std::ceil;
 using std::numeric_limits;
@@ -63,7 +65,7 @@ namespace Xna {
 	}
 
 	Vector3 operator /(Vector3 const& value1, float divider) {
-		return Vector3::Multiply(value1, divider);
+		return Vector3::Divide(value1, divider);
 	}
 
 	bool operator ==(Vector3 const& value1, Vector3 const& value2) {
@@ -269,22 +271,19 @@ namespace Xna {
 
 	void Vector3::Transform(std::vector<Vector3> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
 		std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector3::Transform");
 
 		//TODO: verificar excees
 
-		for (size_t i = 0; i < length; i++)
-		{
-			Vector3 position = sourceArray[sourceIndex + i];
+		if (length == 0)
+			return;
 
-			destinationArray[destinationIndex + i] = Vector3(
-				(position.X * matrix.M11) + (position.Y * matrix.M21) + (position.Z * matrix.M31) + matrix.M41,
-				(position.X * matrix.M12) + (position.Y * matrix.M22) + (position.Z * matrix.M32) + matrix.M42,
-				(position.X * matrix.M13) + (position.Y * matrix.M23) + (position.Z * matrix.M33) + matrix.M43);
-		}
+		Simd::Dispatch::Active().TransformVector3(&sourceArray[sourceIndex], matrix, &destinationArray[destinationIndex], length);
 	}
 
 	void Vector3::Transform(std::vector<Vector3> const& sourceArray, size_t sourceIndex, Quaternion const& rotation,
 		std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector3::Transform");
 
 		//TODO: verificar excees
 
@@ -320,6 +319,8 @@ namespace Xna {
 
 	void Vector3::TransformNormal(std::vector<Vector3> sourceArray, size_t sourceIndex, Matrix const& matrix,
 		std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector3::TransformNormal");
+
 		//TODO: verificar excees
 
 		for (size_t x = 0; x < length; x++)
@@ -0,0 +1,121 @@
+#include "Vector3A.hpp"
+#include "Matrix.hpp"
+#include "Profiler.hpp"
+#include "Simd.hpp"
+
+using std::vector;
+
+//Private
+namespace Xna {
+	namespace {
+		bool validRange(size_t sourceSize, size_t sourceIndex, size_t destinationSize, size_t destinationIndex, size_t length) {
+			return sourceIndex <= sourceSize && length <= sourceSize - sourceIndex
+				&& destinationIndex <= destinationSize && length <= destinationSize - destinationIndex;
+		}
+
+		// x * row1 + y * row2 + z * row3 (+ row4 for positions) in the scalar order, with W taken from the source.
+		template <bool TTranslate>
+		void transform(Vector3A const* source, Matrix const& matrix, Vector3A* destination, size_t length) {
+#if XNA_SSE2
+			auto row1 = _mm_load_ps(&matrix.M11);
+			auto row2 = _mm_load_ps(&matrix.M21);
+			auto row3 = _mm_load_ps(&matrix.M31);
+			auto row4 = _mm_load_ps(&matrix.M41);
+			auto xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+			for (size_t i = 0; i < length; ++i) {
+				auto value = _mm_load_ps(&source[i].X);
+				auto result = _mm_mul_ps(_mm_shuffle_ps(value, value, 0x00), row1);
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(value, value, 0x55), row2));
+				result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(value, value, 0xAA), row3));
+
+				if constexpr (TTranslate)
+					result = _mm_add_ps(result, row4);
+
+				_mm_store_ps(&destination[i].X, _mm_or_ps(_mm_and_ps(xyz, result), _mm_andnot_ps(xyz, value)));
+			}
+#else
+			for (size_t i = 0; i < length; ++i)
+				destination[i] = TTranslate ? Vector3A::Transform(source[i], matrix) : Vector3A::TransformNormal(source[i], matrix);
+#endif
+		}
+	}
+}
+
+//Constructors
+namespace Xna {
+	Vector3A::Vector3A() {}
+
+	Vector3A::Vector3A(float x, float y, float z, float w) :
+		X(x), Y(y), Z(z), W(w) {}
+
+	Vector3A::Vector3A(Vector3 const& value, float w) :
+		X(value.X), Y(value.Y), Z(value.Z), W(w) {}
+}
+
+//Operators
+namespace Xna {
+	bool operator ==(Vector3A const& value1, Vector3A const& value2) {
+		return value1.X == value2.X && value1.Y == value2.Y && value1.Z == value2.Z && value1.W == value2.W;
+	}
+
+	bool operator !=(Vector3A const& value1, Vector3A const& value2) {
+		return !(value1 == value2);
+	}
+}
+
+//Functions
+namespace Xna {
+	Vector3 Vector3A::ToVector3() const {
+		return Vector3(X, Y, Z);
+	}
+}
+
+//Static
+namespace Xna {
+	Vector3A Vector3A::Transform(Vector3A const& position, Matrix const& matrix) {
+		return Vector3A(Vector3::Transform(position.ToVector3(), matrix), position.W);
+	}
+
+	void Vector3A::Transform(AlignedVector<Vector3A> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
+		AlignedVector<Vector3A>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector3A::Transform");
+
+		if (validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			transform<true>(sourceArray.data() + sourceIndex, matrix, destinationArray.data() + destinationIndex, length);
+	}
+
+	void Vector3A::Transform(AlignedVector<Vector3A> const& sourceArray, Matrix const& matrix, AlignedVector<Vector3A>& destinationArray) {
+		Transform(sourceArray, 0, matrix, destinationArray, 0, destinationArray.size());
+	}
+
+	Vector3A Vector3A::TransformNormal(Vector3A const& normal, Matrix const& matrix) {
+		return Vector3A(Vector3::TransformNormal(normal.ToVector3(), matrix), normal.W);
+	}
+
+	void Vector3A::TransformNormal(AlignedVector<Vector3A> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
+		AlignedVector<Vector3A>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector3A::TransformNormal");
+
+		if (validRange(sourceArray.size(), sourceIndex, destinationArray.size(), destinationIndex, length))
+			transform<false>(sourceArray.data() + sourceIndex, matrix, destinationArray.data() + destinationIndex, length);
+	}
+
+	void Vector3A::TransformNormal(AlignedVector<Vector3A> const& sourceArray, Matrix const& matrix, AlignedVector<Vector3A>& destinationArray) {
+		TransformNormal(sourceArray, 0, matrix, destinationArray, 0, destinationArray.size());
+	}
+
+	void Vector3A::FromVector3(vector<Vector3> const& sourceArray, AlignedVector<Vector3A>& destinationArray) {
+		destinationArray.resize(sourceArray.size());
+
+		for (size_t i = 0; i < sourceArray.size(); ++i)
+			destinationArray[i] = Vector3A(sourceArray[i]);
+	}
+
+	void Vector3A::ToVector3(AlignedVector<Vector3A> const& sourceArray, vector<Vector3>& destinationArray) {
+		destinationArray.resize(sourceArray.size());
+
+		for (size_t i = 0; i < sourceArray.size(); ++i)
+			destinationArray[i] = sourceArray[i].ToVector3();
+	}
+}
@@ -0,0 +1,47 @@
+#ifndef _VECTOR3A_HPP_
+#define _VECTOR3A_HPP_
+
+#include <cstddef>
+#include <vector>
+#include "Aligned.hpp"
+#include "Vector3.hpp"
+
+namespace Xna {
+
+	struct Matrix;
+
+	// Vector3 padded to 16 bytes and aligned to them, so a single aligned SIMD load reads one vector and arrays never
+	// split a vector across cache lines. W is padding the transforms carry through unchanged; the batch culling
+	// functions read it as a bounding sphere radius.
+	struct alignas(16) Vector3A {
+		float X{ 0 };
+		float Y{ 0 };
+		float Z{ 0 };
+		float W{ 0 };
+
+		Vector3A();
+		Vector3A(float x, float y, float z, float w = 0);
+		explicit Vector3A(Vector3 const& value, float w = 0);
+
+		friend bool operator ==(Vector3A const& value1, Vector3A const& value2);
+		friend bool operator !=(Vector3A const& value1, Vector3A const& value2);
+
+		Vector3 ToVector3() const;
+
+		// Same arithmetic as Vector3::Transform and Vector3::TransformNormal, so the results match bit for bit.
+		static Vector3A Transform(Vector3A const& position, Matrix const& matrix);
+		static void Transform(AlignedVector<Vector3A> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
+			AlignedVector<Vector3A>& destinationArray, size_t destinationIndex, size_t length);
+		static void Transform(AlignedVector<Vector3A> const& sourceArray, Matrix const& matrix, AlignedVector<Vector3A>& destinationArray);
+		static Vector3A TransformNormal(Vector3A const& normal, Matrix const& matrix);
+		static void TransformNormal(AlignedVector<Vector3A> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
+			AlignedVector<Vector3A>& destinationArray, size_t destinationIndex, size_t length);
+		static void TransformNormal(AlignedVector<Vector3A> const& sourceArray, Matrix const& matrix, AlignedVector<Vector3A>& destinationArray);
+
+		// Resize the destination to the source size.
+		static void FromVector3(std::vector<Vector3> const& sourceArray, AlignedVector<Vector3A>& destinationArray);
+		static void ToVector3(AlignedVector<Vector3A> const& sourceArray, std::vector<Vector3>& destinationArray);
+	};
+}
+
+#endif
@@ -0,0 +1,222 @@
+#include <cmath>
+#include "Vector3Quantizer.hpp"
+#include "BitReader.hpp"
+#include "BitWriter.hpp"
+#include "MathHelper.hpp"
+
+using std::vector;
+
+//Constructors
+namespace Xna {
+	Vector3Quantizer::Vector3Quantizer() {
+		initialize();
+	}
+
+	Vector3Quantizer::Vector3Quantizer(BoundingBox const& bounds, int32_t bitsPerComponent) :
+		Vector3Quantizer(bounds, bitsPerComponent, bitsPerComponent, bitsPerComponent) {}
+
+	Vector3Quantizer::Vector3Quantizer(BoundingBox const& bounds, int32_t bitsX, int32_t bitsY, int32_t bitsZ) :
+		_minimum{ bounds.Min.X, bounds.Min.Y, bounds.Min.Z },
+		_maximum{ bounds.Max.X, bounds.Max.Y, bounds.Max.Z },
+		_bits{ bitsX, bitsY, bitsZ } {
+		initialize();
+	}
+}
+
+//Static
+namespace Xna {
+	Vector3Quantizer Vector3Quantizer::FromMaxError(BoundingBox const& bounds, float maxError) {
+		float range[3] = { bounds.Max.X - bounds.Min.X, bounds.Max.Y - bounds.Min.Y, bounds.Max.Z - bounds.Min.Z };
+		int32_t bits[3] = { 0, 0, 0 };
+
+		for (int32_t axis = 0; axis < 3; ++axis) {
+			while (bits[axis] < MaxBitsPerComponent
+				&& range[axis] / static_cast<float>((1u << bits[axis]) - 1) * 0.5F > maxError) {
+				++bits[axis];
+			}
+		}
+
+		return Vector3Quantizer(bounds, bits[0], bits[1], bits[2]);
+	}
+}
+
+//Functions
+namespace Xna {
+	BoundingBox Vector3Quantizer::Bounds() const {
+		return BoundingBox(
+			Vector3(_minimum[0], _minimum[1], _minimum[2]),
+			Vector3(_maximum[0], _maximum[1], _maximum[2]));
+	}
+
+	int32_t Vector3Quantizer::BitsPerValue() const {
+		return _bits[0] + _bits[1] + _bits[2];
+	}
+
+	Vector3 Vector3Quantizer::MaxError() const {
+		return Vector3(
+			static_cast<float>(_step[0] * 0.5),
+			static_cast<float>(_step[1] * 0.5),
+			static_cast<float>(_step[2] * 0.5));
+	}
+
+	int32_t Vector3Quantizer::DeltaBits() const {
+		return _deltaBits;
+	}
+
+	void Vector3Quantizer::DeltaBits(int32_t value) {
+		_deltaBits = MathHelper::Clamp(value, 1, MaxBitsPerComponent);
+	}
+
+	Vector3 Vector3Quantizer::Quantize(Vector3 const& value) const {
+		uint32_t quantized[3];
+		quantize(value, quantized);
+		return dequantize(quantized);
+	}
+
+	void Vector3Quantizer::Write(BitWriter& writer, Vector3 const& value) const {
+		uint32_t quantized[3];
+		quantize(value, quantized);
+
+		for (int32_t axis = 0; axis < 3; ++axis)
+			writer.Write(quantized[axis], _bits[axis]);
+	}
+
+	Vector3 Vector3Quantizer::Read(BitReader& reader) const {
+		uint32_t quantized[3];
+
+		for (int32_t axis = 0; axis < 3; ++axis)
+			quantized[axis] = reader.Read(_bits[axis]);
+
+		return dequantize(quantized);
+	}
+
+	void Vector3Quantizer::Encode(vector<Vector3> const& sourceArray, size_t sourceIndex, size_t length, BitWriter& writer) const {
+		for (size_t i = 0; i < length; ++i)
+			Write(writer, sourceArray[sourceIndex + i]);
+	}
+
+	void Vector3Quantizer::Encode(vector<Vector3> const& sourceArray, BitWriter& writer) const {
+		Encode(sourceArray, 0, sourceArray.size(), writer);
+	}
+
+	void Vector3Quantizer::Decode(BitReader& reader, vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) const {
+		for (size_t i = 0; i < length; ++i)
+			destinationArray[destinationIndex + i] = Read(reader);
+	}
+
+	void Vector3Quantizer::Decode(BitReader& reader, vector<Vector3>& destinationArray) const {
+		Decode(reader, destinationArray, 0, destinationArray.size());
+	}
+
+	void Vector3Quantizer::EncodeDelta(vector<Vector3> const& sourceArray, vector<Vector3> const& baselineArray,
+		size_t sourceIndex, size_t length, BitWriter& writer) const {
+
+		for (size_t i = 0; i < length; ++i) {
+			uint32_t value[3], baseline[3];
+			quantize(sourceArray[sourceIndex + i], value);
+			quantize(baselineArray[sourceIndex + i], baseline);
+
+			auto changed = value[0] != baseline[0] || value[1] != baseline[1] || value[2] != baseline[2];
+			writer.Write(changed);
+
+			if (!changed)
+				continue;
+
+			for (int32_t axis = 0; axis < 3; ++axis) {
+				auto difference = static_cast<int32_t>(value[axis] - baseline[axis]);
+				writer.Write(difference != 0);
+
+				if (difference == 0)
+					continue;
+
+				auto zigzag = (static_cast<uint32_t>(difference) << 1) ^ static_cast<uint32_t>(difference >> 31);
+				auto small = _deltaBits < _bits[axis] && zigzag < (1u << _deltaBits);
+
+				writer.Write(small);
+
+				if (small)
+					writer.Write(zigzag, _deltaBits);
+				else
+					writer.Write(value[axis], _bits[axis]);
+			}
+		}
+	}
+
+	void Vector3Quantizer::EncodeDelta(vector<Vector3> const& sourceArray, vector<Vector3> const& baselineArray, BitWriter& writer) const {
+		EncodeDelta(sourceArray, baselineArray, 0, sourceArray.size(), writer);
+	}
+
+	void Vector3Quantizer::DecodeDelta(BitReader& reader, vector<Vector3> const& baselineArray,
+		vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) const {
+
+		for (size_t i = 0; i < length; ++i) {
+			auto index = destinationIndex + i;
+			uint32_t value[3];
+			quantize(baselineArray[index], value);
+
+			if (reader.ReadBoolean()) {
+				for (int32_t axis = 0; axis < 3; ++axis) {
+					if (!reader.ReadBoolean())
+						continue;
+
+					if (reader.ReadBoolean()) {
+						auto zigzag = reader.Read(_deltaBits);
+						auto difference = static_cast<int32_t>(zigzag >> 1) ^ -static_cast<int32_t>(zigzag & 1);
+						value[axis] += static_cast<uint32_t>(difference);
+					}
+					else {
+						value[axis] = reader.Read(_bits[axis]);
+					}
+				}
+			}
+
+			destinationArray[index] = dequantize(value);
+		}
+	}
+
+	void Vector3Quantizer::DecodeDelta(BitReader& reader, vector<Vector3> const& baselineArray, vector<Vector3>& destinationArray) const {
+		DecodeDelta(reader, baselineArray, destinationArray, 0, destinationArray.size());
+	}
+}
+
+//Private
+namespace Xna {
+	void Vector3Quantizer::initialize() {
+		for (int32_t axis = 0; axis < 3; ++axis) {
+			_bits[axis] = MathHelper::Clamp(_bits[axis], 0, MaxBitsPerComponent);
+
+			// Double precision keeps 24-bit components exact for large bounds.
+			auto range = static_cast<double>(_maximum[axis]) - _minimum[axis];
+
+			if (range < 0)
+				range = 0;
+
+			auto steps = static_cast<double>((1u << _bits[axis]) - 1);
+
+			_step[axis] = steps > 0 ? range / steps : 0.0;
+			_scale[axis] = range > 0 ? steps / range : 0.0;
+		}
+	}
+
+	void Vector3Quantizer::quantize(Vector3 const& value, uint32_t result[3]) const {
+		float components[3] = { value.X, value.Y, value.Z };
+
+		for (int32_t axis = 0; axis < 3; ++axis) {
+			// Clamp passes NaN through, and converting it to an integer is undefined.
+			auto component = std::isnan(components[axis]) ? _minimum[axis] : components[axis];
+			auto offset = static_cast<double>(MathHelper::Clamp(component, _minimum[axis], _maximum[axis])) - _minimum[axis];
+			auto steps = (1u << _bits[axis]) - 1;
+			auto quantized = static_cast<uint32_t>(offset * _scale[axis] + 0.5);
+
+			// Rounding at the top of a wide range can land one past the last step.
+			result[axis] = quantized < steps ? quantized : steps;
+		}
+	}
+
+	Vector3 Vector3Quantizer::dequantize(uint32_t const value[3]) const {
+		return Vector3(
+			static_cast<float>(_minimum[0] + value[0] * _step[0]),
+			static_cast<float>(_minimum[1] + value[1] * _step[1]),
+			static_cast<float>(_minimum[2] + value[2] * _step[2]));
+	}
+}
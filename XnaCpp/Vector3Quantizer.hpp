@@ -0,0 +1,74 @@
+#ifndef _VECTOR3QUANTIZER_HPP_
+#define _VECTOR3QUANTIZER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "BoundingBox.hpp"
+#include "Vector3.hpp"
+
+namespace Xna {
+
+	class BitReader;
+	class BitWriter;
+
+	// Fixed-point quantization of positions inside a bounding box. Each axis is stored with its own
+	// bit count; values outside the bounds are clamped, and NaN components are stored as the minimum.
+	class Vector3Quantizer {
+	public:
+		static constexpr int32_t MaxBitsPerComponent = 24;
+		static constexpr int32_t DefaultDeltaBits = 6;
+
+		Vector3Quantizer();
+		Vector3Quantizer(BoundingBox const& bounds, int32_t bitsPerComponent);
+		Vector3Quantizer(BoundingBox const& bounds, int32_t bitsX, int32_t bitsY, int32_t bitsZ);
+
+		// Uses the fewest bits per axis whose rounding error does not exceed maxError.
+		static Vector3Quantizer FromMaxError(BoundingBox const& bounds, float maxError);
+
+		BoundingBox Bounds() const;
+		int32_t BitsPerValue() const;
+
+		// Largest per-axis difference between a value inside the bounds and its decoded value,
+		// not counting the float rounding of the decoded value itself.
+		Vector3 MaxError() const;
+
+		// Zigzag-encoded differences below 2^DeltaBits() are sent in DeltaBits() bits by the delta encoder.
+		int32_t DeltaBits() const;
+		void DeltaBits(int32_t value);
+
+		// The value the decoder reconstructs for value.
+		Vector3 Quantize(Vector3 const& value) const;
+
+		void Write(BitWriter& writer, Vector3 const& value) const;
+		Vector3 Read(BitReader& reader) const;
+
+		void Encode(std::vector<Vector3> const& sourceArray, size_t sourceIndex, size_t length, BitWriter& writer) const;
+		void Encode(std::vector<Vector3> const& sourceArray, BitWriter& writer) const;
+		void Decode(BitReader& reader, std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) const;
+		void Decode(BitReader& reader, std::vector<Vector3>& destinationArray) const;
+
+		// Encodes each value against the baseline at the same index: one bit when unchanged, otherwise a
+		// bit per axis followed by a short difference or the full component. Decoding requires the same baseline.
+		void EncodeDelta(std::vector<Vector3> const& sourceArray, std::vector<Vector3> const& baselineArray,
+			size_t sourceIndex, size_t length, BitWriter& writer) const;
+		void EncodeDelta(std::vector<Vector3> const& sourceArray, std::vector<Vector3> const& baselineArray, BitWriter& writer) const;
+		void DecodeDelta(BitReader& reader, std::vector<Vector3> const& baselineArray,
+			std::vector<Vector3>& destinationArray, size_t destinationIndex, size_t length) const;
+		void DecodeDelta(BitReader& reader, std::vector<Vector3> const& baselineArray, std::vector<Vector3>& destinationArray) const;
+
+	private:
+		float _minimum[3]{ -1.0F, -1.0F, -1.0F };
+		float _maximum[3]{ 1.0F, 1.0F, 1.0F };
+		double _step[3]{ 0, 0, 0 };
+		double _scale[3]{ 0, 0, 0 };
+		int32_t _bits[3]{ 16, 16, 16 };
+		int32_t _deltaBits{ DefaultDeltaBits };
+
+		void initialize();
+		void quantize(Vector3 const& value, uint32_t result[3]) const;
+		Vector3 dequantize(uint32_t const value[3]) const;
+	};
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include "MathHelper.hpp"
 #include "Matrix.hpp"
 #include "Quaternion.hpp"
+#include "Profiler.hpp"
 
 namespace Xna {
 	const Vector4 Vector4::Zero = Vector4();
@@ -55,7 +56,7 @@ namespace Xna {
 	}
 
 	Vector4 operator /(Vector4 const& value1, float divider) {
-		return Vector4::Multiply(value1, divider);
+		return Vector4::Divide(value1, divider);
 	}
 
 	bool operator ==(Vector4 const& value1, Vector4 const& value2) {
@@ -122,18 +123,18 @@ namespace Xna {
 
 	Vector4 Vector4::Divide(Vector4 const& value1, Vector4 const& value2) {
 		return Vector4(
-			value1.W / value2.W,
 			value1.X / value2.X,
 			value1.Y / value2.Y,
-			value1.Z / value2.Z);
+			value1.Z / value2.Z,
+			value1.W / value2.W);
 	}
 
 	Vector4 Vector4::Divide(Vector4 const& value1, float divider) {
 		return Vector4(
-			value1.W / divider,
 			value1.X / divider,
 			value1.Y / divider,
-			value1.Z / divider);
+			value1.Z / divider,
+			value1.W / divider);
 	}
 
 	float Vector4::Dot(Vector4 const& value1, Vector4 const& value2) {
@@ -195,19 +196,19 @@ namespace Xna {
 
 	Vector4 Vector4::Multiply(Vector4 const& value1, Vector4 const& value2) {
 		return Vector4(
-			value1.W * value2.W,
 			value1.X * value2.X,
 			value1.Y * value2.Y,
-			value1.Z * value2.Z
+			value1.Z * value2.Z,
+			value1.W * value2.W
 		);
 	}
 
 	Vector4 Vector4::Multiply(Vector4 const& value1, float scaleFactor) {
 		return Vector4(
-			value1.W * scaleFactor,
 			value1.X * scaleFactor,
 			value1.Y * scaleFactor,
-			value1.Z * scaleFactor
+			value1.Z * scaleFactor,
+			value1.W * scaleFactor
 		);
 	}
 
@@ -284,6 +285,8 @@ namespace Xna {
 
 	void Vector4::Transform(std::vector<Vector4> const& sourceArray, size_t sourceIndex, Matrix const& matrix,
 		std::vector<Vector4>& destinationArray, size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Vector4::Transform");
+
 		//TODO: Verificar exceoes
 
 		for (size_t i = 0; i < length; i++)
@@ -0,0 +1,360 @@
+#ifndef _VECTOREXPRESSION_HPP_
+#define _VECTOREXPRESSION_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "Profiler.hpp"
+#include "SimdLanes.hpp"
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+
+namespace Xna::Expressions {
+
+	// Opt-in expression templates for Vector2, Vector3 and Vector4. Wrapping an operand in Lazy() makes +, -, *, /
+	// and the functions below build a tree instead of a temporary vector per operator. Converting the tree to the
+	// vector type evaluates every component in one pass; Evaluate() runs it over arrays, loading Lazy(array)
+	// operands on SIMD lanes across the flattened components. Each component goes through the same operations in
+	// the same order as the plain operators, so results are identical. Code that never calls Lazy() is unaffected.
+	//
+	//   Vector3 g = (Lazy(center) - radius * Lazy(direction) + point) / 2.0f;
+	//   Evaluate(Lazy(positions) + Lazy(velocities) * elapsed, positions);
+	template <typename TVector>
+	struct VectorTraits;
+
+	template <>
+	struct VectorTraits<Vector2> {
+		static constexpr size_t Components = 2;
+	};
+
+	template <>
+	struct VectorTraits<Vector3> {
+		static constexpr size_t Components = 3;
+	};
+
+	template <>
+	struct VectorTraits<Vector4> {
+		static constexpr size_t Components = 4;
+	};
+
+	template <typename T>
+	concept VectorOperand = requires { VectorTraits<T>::Components; };
+
+	template <typename T>
+	concept Expression = requires {
+		typename T::VectorType;
+		{ T::HasArrays } -> std::convertible_to<bool>;
+	};
+
+	template <Expression TExpression>
+	typename TExpression::VectorType Evaluate(TExpression const& expression);
+
+	// Supplies the conversion that ends a chain: Vector3 v = Lazy(a) + b;
+	template <typename TDerived, typename TVector>
+	struct Node {
+		using VectorType = TVector;
+		static constexpr size_t Components = VectorTraits<TVector>::Components;
+
+		operator TVector() const {
+			return Evaluate(static_cast<TDerived const&>(*this));
+		}
+	};
+
+	// A single vector broadcast to every element. The components are stored repeated so that a lane load at
+	// any component phase reads the right pattern.
+	template <typename TVector>
+	class Constant : public Node<Constant<TVector>, TVector> {
+	public:
+		static constexpr bool HasArrays = false;
+
+		explicit Constant(TVector const& value) {
+			static_assert(sizeof(TVector) == sizeof(float) * Constant::Components);
+			auto components = reinterpret_cast<float const*>(&value);
+
+			for (size_t i = 0; i < repeatedLength; ++i)
+				_repeated[i] = components[i % Constant::Components];
+		}
+
+		size_t Count() const { return std::numeric_limits<size_t>::max(); }
+
+		template <typename TLanes>
+		typename TLanes::Float Lanes(size_t index) const {
+			return TLanes::Load(_repeated + index % Constant::Components);
+		}
+
+	private:
+		static constexpr size_t repeatedLength = Constant::Components - 1 + Simd::BatchLanes::Width;
+		float _repeated[repeatedLength];
+	};
+
+	// A float applied to every component.
+	template <typename TVector>
+	class Scalar : public Node<Scalar<TVector>, TVector> {
+	public:
+		static constexpr bool HasArrays = false;
+
+		explicit Scalar(float value) : _value(value) {}
+
+		size_t Count() const { return std::numeric_limits<size_t>::max(); }
+
+		template <typename TLanes>
+		typename TLanes::Float Lanes(size_t) const {
+			return TLanes::Set(_value);
+		}
+
+	private:
+		float _value;
+	};
+
+	// One vector per element, read from an array starting at an index. Only valid inside Evaluate(expression, array).
+	template <typename TVector>
+	class Array : public Node<Array<TVector>, TVector> {
+	public:
+		static constexpr bool HasArrays = true;
+
+		Array(std::vector<TVector> const& array, size_t index) {
+			static_assert(sizeof(TVector) == sizeof(float) * Array::Components);
+
+			if (index <= array.size()) {
+				_data = reinterpret_cast<float const*>(array.data() + index);
+				_count = array.size() - index;
+			}
+		}
+
+		size_t Count() const { return _count; }
+
+		template <typename TLanes>
+		typename TLanes::Float Lanes(size_t index) const {
+			return TLanes::Load(_data + index);
+		}
+
+	private:
+		float const* _data{ nullptr };
+		size_t _count{ 0 };
+	};
+
+	template <typename TOperation, Expression TOperand>
+	class Unary : public Node<Unary<TOperation, TOperand>, typename TOperand::VectorType> {
+	public:
+		static constexpr bool HasArrays = TOperand::HasArrays;
+
+		explicit Unary(TOperand const& operand) : _operand(operand) {}
+
+		size_t Count() const { return _operand.Count(); }
+
+		template <typename TLanes>
+		typename TLanes::Float Lanes(size_t index) const {
+			return TOperation::template Apply<TLanes>(_operand.template Lanes<TLanes>(index));
+		}
+
+	private:
+		TOperand _operand;
+	};
+
+	template <typename TOperation, Expression TLeft, Expression TRight>
+	class Binary : public Node<Binary<TOperation, TLeft, TRight>, typename TLeft::VectorType> {
+	public:
+		static constexpr bool HasArrays = TLeft::HasArrays || TRight::HasArrays;
+
+		Binary(TLeft const& left, TRight const& right) : _left(left), _right(right) {}
+
+		size_t Count() const {
+			auto left = _left.Count();
+			auto right = _right.Count();
+			return left < right ? left : right;
+		}
+
+		template <typename TLanes>
+		typename TLanes::Float Lanes(size_t index) const {
+			return TOperation::template Apply<TLanes>(_left.template Lanes<TLanes>(index), _right.template Lanes<TLanes>(index));
+		}
+
+	private:
+		TLeft _left;
+		TRight _right;
+	};
+
+	struct NegateOperation {
+		// Flips the sign bit like unary minus, so -0 stays distinct from 0 - x.
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a) { return TLanes::Xor(a, TLanes::Set(-0.0f)); }
+	};
+
+	struct AddOperation {
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a, typename TLanes::Float b) { return TLanes::Add(a, b); }
+	};
+
+	struct SubtractOperation {
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a, typename TLanes::Float b) { return TLanes::Sub(a, b); }
+	};
+
+	struct MultiplyOperation {
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a, typename TLanes::Float b) { return TLanes::Mul(a, b); }
+	};
+
+	struct DivideOperation {
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a, typename TLanes::Float b) { return TLanes::Div(a, b); }
+	};
+
+	// a < b ? a : b, as MathHelper::Min.
+	struct MinOperation {
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a, typename TLanes::Float b) { return TLanes::Min(a, b); }
+	};
+
+	// a > b ? a : b, as MathHelper::Max.
+	struct MaxOperation {
+		template <typename TLanes>
+		static typename TLanes::Float Apply(typename TLanes::Float a, typename TLanes::Float b) { return TLanes::Max(a, b); }
+	};
+
+	template <typename TVector>
+	Constant<TVector> Lazy(TVector const& value) requires VectorOperand<TVector> {
+		return Constant<TVector>(value);
+	}
+
+	template <typename TVector>
+	Array<TVector> Lazy(std::vector<TVector> const& array, size_t index = 0) requires VectorOperand<TVector> {
+		return Array<TVector>(array, index);
+	}
+
+	namespace Detail {
+		template <typename T>
+		struct ExpressionVector {
+			using Type = void;
+		};
+
+		template <Expression T>
+		struct ExpressionVector<T> {
+			using Type = typename T::VectorType;
+		};
+
+		template <typename T, typename TVector>
+		concept OperandOf = (Expression<T> && std::same_as<typename ExpressionVector<T>::Type, TVector>)
+			|| std::same_as<T, TVector> || std::is_arithmetic_v<T>;
+
+		// At least one side must already be an expression, so plain vector arithmetic keeps its own operators.
+		template <typename TLeft, typename TRight>
+		concept Combinable = (Expression<TLeft> && OperandOf<TRight, typename ExpressionVector<TLeft>::Type>)
+			|| (Expression<TRight> && OperandOf<TLeft, typename ExpressionVector<TRight>::Type>);
+
+		template <typename TLeft, typename TRight>
+		using CommonVector = std::conditional_t<Expression<TLeft>,
+			typename ExpressionVector<TLeft>::Type, typename ExpressionVector<TRight>::Type>;
+
+		template <typename TVector, typename T>
+		auto operand(T const& value) {
+			if constexpr (Expression<T>)
+				return value;
+			else if constexpr (std::same_as<T, TVector>)
+				return Constant<TVector>(value);
+			else
+				return Scalar<TVector>(static_cast<float>(value));
+		}
+
+		template <typename TOperation, typename TLeft, typename TRight>
+		auto binary(TLeft const& left, TRight const& right) {
+			using TVector = CommonVector<TLeft, TRight>;
+			auto leftOperand = operand<TVector>(left);
+			auto rightOperand = operand<TVector>(right);
+			return Binary<TOperation, decltype(leftOperand), decltype(rightOperand)>(leftOperand, rightOperand);
+		}
+	}
+
+	template <Expression TOperand>
+	Unary<NegateOperation, TOperand> operator -(TOperand const& operand) {
+		return Unary<NegateOperation, TOperand>(operand);
+	}
+
+	template <typename TLeft, typename TRight> requires Detail::Combinable<TLeft, TRight>
+	auto operator +(TLeft const& left, TRight const& right) {
+		return Detail::binary<AddOperation>(left, right);
+	}
+
+	template <typename TLeft, typename TRight> requires Detail::Combinable<TLeft, TRight>
+	auto operator -(TLeft const& left, TRight const& right) {
+		return Detail::binary<SubtractOperation>(left, right);
+	}
+
+	template <typename TLeft, typename TRight> requires Detail::Combinable<TLeft, TRight>
+	auto operator *(TLeft const& left, TRight const& right) {
+		return Detail::binary<MultiplyOperation>(left, right);
+	}
+
+	template <typename TLeft, typename TRight> requires Detail::Combinable<TLeft, TRight>
+	auto operator /(TLeft const& left, TRight const& right) {
+		return Detail::binary<DivideOperation>(left, right);
+	}
+
+	template <typename TLeft, typename TRight> requires Detail::Combinable<TLeft, TRight>
+	auto Min(TLeft const& value1, TRight const& value2) {
+		return Detail::binary<MinOperation>(value1, value2);
+	}
+
+	template <typename TLeft, typename TRight> requires Detail::Combinable<TLeft, TRight>
+	auto Max(TLeft const& value1, TRight const& value2) {
+		return Detail::binary<MaxOperation>(value1, value2);
+	}
+
+	// Same comparisons as MathHelper::Clamp: the upper bound first, then the lower one.
+	template <Expression TValue, typename TMin, typename TMax>
+	auto Clamp(TValue const& value, TMin const& min, TMax const& max) {
+		return Max(Detail::operand<typename TValue::VectorType>(min), Min(Detail::operand<typename TValue::VectorType>(max), value));
+	}
+
+	// value1 + (value2 - value1) * amount, as MathHelper::Lerp.
+	template <Expression TValue1, typename TValue2, typename TAmount>
+	auto Lerp(TValue1 const& value1, TValue2 const& value2, TAmount const& amount) {
+		return value1 + (Detail::operand<typename TValue1::VectorType>(value2) - value1) * amount;
+	}
+
+	template <Expression TExpression>
+	typename TExpression::VectorType Evaluate(TExpression const& expression) {
+		static_assert(!TExpression::HasArrays, "Expressions over arrays are evaluated with Evaluate(expression, destinationArray).");
+
+		typename TExpression::VectorType result;
+		auto components = reinterpret_cast<float*>(&result);
+
+		for (size_t i = 0; i < TExpression::Components; ++i)
+			components[i] = expression.template Lanes<Simd::ScalarLanes>(i);
+
+		return result;
+	}
+
+	// Writes length elements starting at destinationIndex. Every Lazy(array) operand must hold at least length
+	// elements from its own index, otherwise nothing is written. An operand may be the destination itself at the
+	// same index; other overlaps are undefined.
+	template <Expression TExpression>
+	void Evaluate(TExpression const& expression, std::vector<typename TExpression::VectorType>& destinationArray,
+		size_t destinationIndex, size_t length) {
+		XNA_PROFILE_ZONE("Expressions::Evaluate");
+
+		if (destinationIndex > destinationArray.size() || length > destinationArray.size() - destinationIndex || length > expression.Count())
+			return;
+
+		using Lanes = Simd::BatchLanes;
+		auto destination = reinterpret_cast<float*>(destinationArray.data() + destinationIndex);
+		auto count = length * TExpression::Components;
+		size_t i = 0;
+
+		for (; i + Lanes::Width <= count; i += Lanes::Width)
+			Lanes::Store(destination + i, expression.template Lanes<Lanes>(i));
+
+		for (; i < count; ++i)
+			destination[i] = expression.template Lanes<Simd::ScalarLanes>(i);
+	}
+
+	template <Expression TExpression>
+	void Evaluate(TExpression const& expression, std::vector<typename TExpression::VectorType>& destinationArray) {
+		Evaluate(expression, destinationArray, 0, destinationArray.size());
+	}
+}
+
+#endif
@@ -0,0 +1,176 @@
+#include "WorkStealingExecutor.hpp"
+#include "Parallel.hpp"
+#include "TaskGraph.hpp"
+
+//Constructors
+namespace Xna {
+	WorkStealingExecutor::WorkStealingExecutor(size_t threadCount) {
+		if (threadCount == 0)
+			threadCount = Parallel::ProcessorCount();
+
+		_queues.reserve(threadCount);
+
+		for (size_t i = 0; i < threadCount; ++i)
+			_queues.push_back(std::make_unique<Queue>());
+
+		// Queue 0 belongs to the thread calling Run().
+		_threads.reserve(threadCount - 1);
+
+		for (size_t i = 1; i < threadCount; ++i)
+			_threads.emplace_back(&WorkStealingExecutor::workerLoop, this, i);
+	}
+
+	WorkStealingExecutor::~WorkStealingExecutor() {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stopping = true;
+		}
+
+		_wake.notify_all();
+
+		for (auto& t : _threads)
+			t.join();
+	}
+}
+
+//Functions
+namespace Xna {
+	size_t WorkStealingExecutor::ThreadCount() const {
+		return _queues.size();
+	}
+
+	void WorkStealingExecutor::Run(TaskGraph const& graph) {
+		auto const& nodes = graph._nodes;
+		auto count = nodes.size();
+
+		if (count == 0)
+			return;
+
+		// Edges only point forwards, so index order is already a valid schedule.
+		if (_threads.empty()) {
+			for (auto const& node : nodes) {
+				if (node.Task)
+					node.Task();
+			}
+
+			return;
+		}
+
+		if (_pendingCapacity < count) {
+			_pending = std::make_unique<std::atomic<int32_t>[]>(count);
+			_pendingCapacity = count;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+			_pending[i].store(nodes[i].Predecessors, std::memory_order_relaxed);
+
+		_graph = &graph;
+		_remaining.store(count, std::memory_order_release);
+
+		// Pushed in reverse so the owner pops the roots in graph order.
+		for (size_t i = count; i-- > 0;) {
+			if (nodes[i].Predecessors == 0)
+				push(0, i);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			++_generation;
+		}
+
+		_wake.notify_all();
+
+		execute(0);
+
+		// Workers still inside execute() may hold references to this graph.
+		while (_busy.load(std::memory_order_acquire) != 0)
+			std::this_thread::yield();
+
+		_graph = nullptr;
+	}
+}
+
+//Private
+namespace Xna {
+	void WorkStealingExecutor::workerLoop(size_t index) {
+		uint64_t seen = 0;
+
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_wake.wait(lock, [&]() { return _stopping || _generation != seen; });
+
+				if (_stopping)
+					return;
+
+				seen = _generation;
+				_busy.fetch_add(1, std::memory_order_acq_rel);
+			}
+
+			execute(index);
+			_busy.fetch_sub(1, std::memory_order_acq_rel);
+		}
+	}
+
+	void WorkStealingExecutor::execute(size_t index) {
+		while (_remaining.load(std::memory_order_acquire) != 0) {
+			size_t task;
+
+			if (!pop(index, task) && !steal(index, task)) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			auto const& node = _graph->_nodes[task];
+
+			if (node.Task)
+				node.Task();
+
+			for (auto successor : node.Successors) {
+				if (_pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+					push(index, successor);
+			}
+
+			// Successors are queued before the count drops, so it only reaches zero once the graph is done.
+			_remaining.fetch_sub(1, std::memory_order_acq_rel);
+		}
+	}
+
+	void WorkStealingExecutor::push(size_t index, size_t task) {
+		auto& queue = *_queues[index];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		queue.Items.push_back(task);
+	}
+
+	bool WorkStealingExecutor::pop(size_t index, size_t& task) {
+		auto& queue = *_queues[index];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+
+		if (queue.Items.empty())
+			return false;
+
+		task = queue.Items.back();
+		queue.Items.pop_back();
+
+		return true;
+	}
+
+	bool WorkStealingExecutor::steal(size_t index, size_t& task) {
+		auto count = _queues.size();
+
+		for (size_t i = 1; i < count; ++i) {
+			auto& queue = *_queues[(index + i) % count];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+
+			if (queue.Items.empty())
+				continue;
+
+			task = queue.Items.front();
+			queue.Items.pop_front();
+
+			return true;
+		}
+
+		return false;
+	}
+}
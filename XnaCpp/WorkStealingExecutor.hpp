@@ -0,0 +1,60 @@
+#ifndef _WORKSTEALINGEXECUTOR_HPP_
+#define _WORKSTEALINGEXECUTOR_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Xna {
+
+	class TaskGraph;
+
+	// Runs TaskGraphs on a persistent set of threads. Each thread owns a deque: it pushes the tasks it
+	// unblocks and pops them newest first, while idle threads steal the oldest task from the others.
+	class WorkStealingExecutor {
+	public:
+		// threadCount includes the calling thread; 0 uses every processor.
+		WorkStealingExecutor(size_t threadCount = 0);
+		~WorkStealingExecutor();
+
+		WorkStealingExecutor(WorkStealingExecutor const&) = delete;
+		WorkStealingExecutor& operator =(WorkStealingExecutor const&) = delete;
+
+		size_t ThreadCount() const;
+
+		// Blocks until every task of the graph has run. The calling thread takes part in the work.
+		void Run(TaskGraph const& graph);
+
+	private:
+		struct Queue {
+			std::mutex Mutex;
+			std::deque<size_t> Items;
+		};
+
+		std::vector<std::thread> _threads;
+		std::vector<std::unique_ptr<Queue>> _queues;
+		std::unique_ptr<std::atomic<int32_t>[]> _pending;
+		size_t _pendingCapacity{ 0 };
+		TaskGraph const* _graph{ nullptr };
+		std::atomic<size_t> _remaining{ 0 };
+		std::atomic<size_t> _busy{ 0 };
+		std::mutex _mutex;
+		std::condition_variable _wake;
+		uint64_t _generation{ 0 };
+		bool _stopping{ false };
+
+		void workerLoop(size_t index);
+		void execute(size_t index);
+		void push(size_t index, size_t task);
+		bool pop(size_t index, size_t& task);
+		bool steal(size_t index, size_t& task);
+	};
+}
+
+#endif